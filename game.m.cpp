@@ -3,11 +3,16 @@
 #include <game/controllers/player_controller.h>
 #include <engine/assets/handle.h>
 #include <assert.h>
+#include <cstdlib>
+#include <fstream>
 #include <game/base/game.h>
 #include "engine/build.g.h"
+#include "engine/events/event_bus.h"
 #include "engine/input/input.h"
+#include "engine/profiling/profiler.h"
 #include "engine/rendering/renderer.h"
 #include "engine/scene/scene.h"
+#include "engine/time/time_source.h"
 #include "engine/util/input_utils.h"
 #include "engine/util/game_utils.h"
 
@@ -18,6 +23,16 @@ int main( int argc, char *argv[] )
     using namespace StevensDev::sgdu;
 
     int i;
+    bool isHeadless = false;
+    bool hasEventStats = false;
+    float stepS = 0.0f;
+    unsigned long long frames = 0;
+    string recordPath;
+    string replayPath;
+    string profilePath;
+    sgdk::TimePoint start;
+    double elapsedS;
+    sgde::EventStats eventStats;
 
     // print out debug information
     cout << "CS 585 Intro to Game Development" << endl;
@@ -31,7 +46,90 @@ int main( int argc, char *argv[] )
     }
     cout << endl;
 
+    // --headless runs without a window, --step=S ticks S simulated seconds
+    // per update, --frames=N stops after N updates, --record=FILE records
+    // the frames into the file, --replay=FILE plays them back headless,
+    // --event-stats times the event listeners and warns about event storms
+    // and --profile=FILE writes a Chrome trace of the run into the file
+    for ( i = 1; i < argc; ++i )
+    {
+        string arg( argv[i] );
+
+        if ( arg == "--headless" )
+        {
+            isHeadless = true;
+        }
+        else if ( arg.compare( 0, 7, "--step=" ) == 0 )
+        {
+            stepS = static_cast<float>( atof( arg.c_str() + 7 ) );
+        }
+        else if ( arg.compare( 0, 9, "--frames=" ) == 0 )
+        {
+            frames = strtoull( arg.c_str() + 9, nullptr, 10 );
+        }
+        else if ( arg.compare( 0, 9, "--record=" ) == 0 )
+        {
+            recordPath = arg.substr( 9 );
+        }
+        else if ( arg.compare( 0, 9, "--replay=" ) == 0 )
+        {
+            replayPath = arg.substr( 9 );
+        }
+        else if ( arg == "--event-stats" )
+        {
+            hasEventStats = true;
+        }
+        else if ( arg.compare( 0, 10, "--profile=" ) == 0 )
+        {
+            profilePath = arg.substr( 10 );
+        }
+    }
+
     mgb::Game game;
+
+    if ( isHeadless )
+    {
+        game.setHeadless( stepS );
+    }
+
+    if ( !replayPath.empty() )
+    {
+        ifstream file( replayPath.c_str(), ios::binary );
+        sgdl::FrameLog log;
+
+        if ( !log.read( file ) ||
+             log.inputCount() != sgdi::Input::INPUT_TYPE_COUNT )
+        {
+            cerr << "Could not read a replay from " << replayPath << endl;
+            return 1;
+        }
+
+        game.setReplay( log );
+    }
+    else if ( !recordPath.empty() )
+    {
+        game.setRecording();
+    }
+
+    game.setFrameLimit( frames );
+
+    if ( hasEventStats )
+    {
+        // a type is a storm at a thousand events or a millisecond a frame
+        eventStats.setRateThreshold( 1000 );
+        eventStats.setTimeThreshold( sgdk::TimeUnits::NANOS_PER_MILLI );
+        eventStats.setStormListener(
+            []( sgde::EventTypeId type, const sgde::EventTypeStats& stats ) {
+                cerr << "Event storm: "
+                     << sgde::EventTypes::inst().name( type ) << " had "
+                     << stats.frameCount << " events taking "
+                     << sgdk::TimeUnits::toMilliseconds( stats.frameTime )
+                     << "ms, slowest listener " << stats.slowestHandle
+                     << endl;
+            } );
+        sgde::EventBus::dispatcher().setStats( &eventStats );
+    }
+
     game.initialize( "Simulation" );
     while ( game.poll() != mgb::Game::EngineEvent::STATUS_INITIALIZED )
     {
@@ -44,13 +142,62 @@ int main( int argc, char *argv[] )
         // wait for startup
     }
 
+    if ( !profilePath.empty() )
+    {
+#ifndef GAME_PROFILE
+        cerr << "Release builds do not record profiler zones" << endl;
+#endif
+        sgdp::Profiler::inst().start();
+    }
+
+    start = sgdk::TimeSource::now();
     while ( game.isRunning() )
     {
         game.update();
     }
+    elapsedS = sgdk::TimeUnits::toSeconds( sgdk::TimeSource::now() - start );
+
+    if ( game.replayer() != nullptr )
+    {
+        game.replayer()->writeReport( cout );
+        cout << endl;
+    }
 
     game.shutdown();
 
+    if ( hasEventStats )
+    {
+        sgde::EventBus::dispatcher().setStats( nullptr );
+        cout << "Events: " << eventStats << endl;
+    }
+
+    if ( !profilePath.empty() )
+    {
+        ofstream file( profilePath.c_str() );
+
+        sgdp::Profiler::inst().stop();
+        sgdp::Profiler::inst().writeChromeTrace( file );
+        cout << "Profiled " << sgdp::Profiler::inst().size()
+             << " zones to " << profilePath << endl;
+    }
+
+    if ( !recordPath.empty() && replayPath.empty() )
+    {
+        ofstream file( recordPath.c_str(), ios::binary );
+
+        game.log().write( file );
+        cout << "Recorded " << game.log().frames() << " frames to "
+             << recordPath << endl;
+    }
+
+    // report simulation throughput
+    cout << "Frames: " << game.frames() << " in " << elapsedS << "s";
+    if ( elapsedS > 0 )
+    {
+        cout << " (" << game.frames() / elapsedS << " frames/s)";
+    }
+    cout << endl;
+
     cout << "Finished. Exiting..." << endl;
 
     return 0;
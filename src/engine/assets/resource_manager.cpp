@@ -9,6 +9,9 @@ namespace StevensDev
 namespace sgda
 {
 
+// CONSTANTS
+const unsigned int ResourceManager::CLEAN_INTERVAL;
+
 // GLOBALS
 ResourceManager ResourceManager::d_manager = ResourceManager();
 ImageDataFactory ResourceManager::d_imageFactory = ImageDataFactory();
@@ -17,16 +20,13 @@ ConfigDataFactory ResourceManager::d_configFactory = ConfigDataFactory();
 // MEMBER FUNCTIONS
 void ResourceManager::postTick()
 {
-    if ( d_frame == ( unsigned int )-1 )
-    {
-        d_frame = 0;
-    }
-
-    if ( !( ++d_frame % 8 ) )
+    // the scene spaces calls out by the interval so alternating cleans
+    // each manager once every two intervals
+    if ( ++d_frame % 2 )
     {
         d_images.clean();
     }
-    else if ( ( d_frame + 4 ) % 8 )
+    else
     {
         d_configs.clean();
     }
@@ -53,7 +53,7 @@ class ResourceManager : public sgds::ITickable
       // The resource database
 
     unsigned int d_frame;
-      // Frame counter for scheduling garbage collection.
+      // The number of times the manager has been post-ticked.
 
     // CONSTRUCTORS
     ResourceManager();
@@ -69,6 +69,11 @@ class ResourceManager : public sgds::ITickable
     ResourceManager& operator=( const ResourceManager& manager );
       // Makes this a copy of another resource manager.
   public:
+    // CONSTANTS
+    static const unsigned int CLEAN_INTERVAL = 4;
+      // The update interval in steps that the manager should be added to
+      // the scene with.
+
     // GLOBAL FUNCTIONS
     static ResourceManager& inst();
       // Gets a reference to the resource manager.
@@ -124,7 +129,8 @@ class ResourceManager : public sgds::ITickable
       // Does nothing.
 
     virtual void postTick();
-      // Cleans up resources.
+      // Cleans up either the images or the configurations, alternating
+      // between them each time.
 };
 
 // FREE OPERATORS
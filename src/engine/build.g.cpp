@@ -0,0 +1,2 @@
+// build.g.cpp
+#include "build.g.h"
@@ -0,0 +1,24 @@
+// build.g.h
+#ifndef DEFINED_BUILD
+#define DEFINED_BUILD
+
+#define GAME_BUILD_RELEASE 0
+#define GAME_BUILD_STAGE 1
+#define GAME_BUILD_DEBUG 2
+
+#define GAME_VERSION_MAJOR 0
+#define GAME_VERSION_MINOR 1
+#define GAME_VERSION_PATCH 0
+#define GAME_VERSION "0.1.0"
+
+#define GAME_BUILD GAME_BUILD_STAGE
+
+#if GAME_BUILD == GAME_BUILD_DEBUG
+#define GAME_DEBUG
+#endif
+
+#if GAME_BUILD != GAME_BUILD_RELEASE
+#define GAME_PROFILE
+#endif
+
+#endif
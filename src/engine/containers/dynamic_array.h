@@ -8,6 +8,7 @@
 #include "../memory/mem.h"
 #include <assert.h>
 #include <stdexcept>
+#include <utility>
 
 namespace StevensDev
 {
@@ -45,7 +46,7 @@ class DynamicArray
       // fragmentation. This is to abide by the expectation that an array
       // be contiguous in memory. This reduces the number of cache clears
       // during iteration to at most one which is due to the wrapped nature of
-      // the array.
+      // the array. Elements are moved rather than copied into the new block.
 
     unsigned int wrap( int index ) const;
       // Wraps the index inside of the circular bounds.
@@ -109,6 +110,10 @@ class DynamicArray
     void push( const T& element );
       // Adds the element to the end of the collection and grows if necessary.
 
+    void push( T&& element );
+      // Moves the element to the end of the collection and grows if
+      // necessary.
+
     void pushFront( const T& element );
       // Adds the element to the front of the collection and grows if
       // necessary.
@@ -147,6 +152,9 @@ class DynamicArray
       // Throws runtime_error when:
       // index is out of bounds
 
+    void clear();
+      // Removes every element while keeping the capacity.
+
     bool doesContain( const T& value ) const;
       // Checks if the array contains the given value.
 
@@ -318,6 +326,17 @@ void DynamicArray<T>::push( const T& element )
     d_allocator.construct( d_array + wrap( d_size++ ),  element );
 }
 
+template<typename T>
+void DynamicArray<T>::push( T&& element )
+{
+    if ( d_size >= d_capacity )
+    {
+        grow();
+    }
+
+    d_allocator.construct( d_array + wrap( d_size++ ), std::move( element ) );
+}
+
 template<typename T>
 void DynamicArray<T>::pushFront( const T& element )
 {
@@ -342,7 +361,7 @@ T DynamicArray<T>::pop()
     assert( d_size > 0 );
 
     // get last and reduce size
-    return d_array[wrap( --d_size )];
+    return std::move( d_array[wrap( --d_size )] );
 }
 
 template<typename T>
@@ -356,7 +375,7 @@ T DynamicArray<T>::popFront()
 
     --d_size;
 
-    return d_array[front];
+    return std::move( d_array[front] );
 }
 
 template<typename T>
@@ -422,6 +441,14 @@ void DynamicArray<T>::insertAt( unsigned int index, const T& elem )
     ++d_size;
 }
 
+template<typename T>
+inline
+void DynamicArray<T>::clear()
+{
+    d_first = 0;
+    d_size = 0;
+}
+
 template<typename T>
 inline
 unsigned int DynamicArray<T>::size() const
@@ -458,12 +485,12 @@ void DynamicArray<T>::grow()
         unsigned int firstSize = ( d_capacity - d_first );
         unsigned int wrappedSize = ( d_size - firstSize );
 
-        sgdm::Mem::copy<>( expanded, d_array + d_first, firstSize );
-        sgdm::Mem::copy<>( expanded + firstSize, d_array, wrappedSize );
+        sgdm::Mem::move<>( expanded, d_array + d_first, firstSize );
+        sgdm::Mem::move<>( expanded + firstSize, d_array, wrappedSize );
     }
     else
     {
-        sgdm::Mem::copy<>( expanded, d_array + d_first, d_size );
+        sgdm::Mem::move<>( expanded, d_array + d_first, d_size );
     }
 
     d_allocator.release( d_array, d_capacity );
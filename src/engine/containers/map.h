@@ -622,7 +622,7 @@ T& Map<T>::operator[]( const std::string& key )
     if ( old != BIN_INVALID && doesContain( d_oldBins[old], code ) )
     {
         bin = d_oldBins[old];
-        d_oldBins[index] = BIN_DELETED;
+        d_oldBins[old] = BIN_DELETED;
     }
     else if ( isAvailable( bin ) )
     {
@@ -0,0 +1,2 @@
+// component_pool.cpp
+#include "component_pool.h"
@@ -0,0 +1,338 @@
+// component_pool.h
+//
+// Stores one type of component as a sparse set. The components and their
+// entities are packed densely in the same order so systems iterate them
+// linearly, while a sparse array indexed by entity finds any one component
+// in constant time.
+//
+// Removing a component moves the last one into its place so the order of
+// the dense arrays changes and references into them are invalidated by any
+// addition or removal.
+#ifndef INCLUDED_COMPONENT_POOL
+#define INCLUDED_COMPONENT_POOL
+
+#include "../containers/dynamic_array.h"
+#include <assert.h>
+#include "entity.h"
+
+namespace StevensDev
+{
+
+namespace sgdn
+{
+
+template <typename T>
+class ComponentPool
+{
+  private:
+    // CONSTANTS
+    static const unsigned int ABSENT = 0xffffffffu;
+      // Marks an entity index without a component.
+
+    // MEMBERS
+    sgdc::DynamicArray<unsigned int> d_sparse;
+      // The dense position of each entity index's component or ABSENT.
+
+    sgdc::DynamicArray<Entity> d_entities;
+      // The entity of each component.
+
+    sgdc::DynamicArray<T> d_components;
+      // The components.
+
+    // HELPER FUNCTIONS
+    unsigned int find( Entity entity ) const;
+      // Gets the dense position of the entity's component or ABSENT.
+
+  public:
+    // CONSTRUCTORS
+    ComponentPool();
+      // Constructs a new empty pool.
+
+    ComponentPool( const ComponentPool<T>& pool );
+      // Constructs a copy of the pool.
+
+    ~ComponentPool();
+      // Destructs the pool.
+
+    // OPERATORS
+    ComponentPool<T>& operator=( const ComponentPool<T>& pool );
+      // Makes this a copy of the pool.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int size() const;
+      // Gets the number of components.
+
+    bool has( Entity entity ) const;
+      // Checks if the entity has a component.
+
+    const T& get( Entity entity ) const;
+      // Gets the component of the entity.
+      //
+      // Requirements:
+      // the entity has a component
+
+    T& get( Entity entity );
+      // Gets the component of the entity.
+      //
+      // Requirements:
+      // the entity has a component
+
+    Entity entity( unsigned int index ) const;
+      // Gets the entity of the component at the dense index.
+
+    const T& at( unsigned int index ) const;
+      // Gets the component at the dense index.
+
+    T& at( unsigned int index );
+      // Gets the component at the dense index.
+
+    // MEMBER FUNCTIONS
+    T& add( Entity entity, const T& component );
+      // Sets the component of the entity, adding it if the entity has none.
+
+    bool remove( Entity entity );
+      // Removes the component of the entity and returns false if it had
+      // none.
+
+    void clear();
+      // Removes every component.
+};
+
+// CONSTANTS
+template <typename T>
+const unsigned int ComponentPool<T>::ABSENT;
+
+// GLOBAL FUNCTIONS
+template <typename A, typename B, typename F>
+void join( ComponentPool<A>& first, ComponentPool<B>& second,
+           const F& function );
+  // Calls the function with every entity that has both components and
+  // references to them.
+  //
+  // The smaller pool is iterated linearly. The function must not add or
+  // remove components from either pool.
+
+// FREE OPERATORS
+template <typename T>
+inline
+std::ostream& operator<<( std::ostream& stream,
+                          const ComponentPool<T>& pool )
+{
+    return stream << "{ \"size\": " << pool.size() << " }";
+}
+
+// CONSTRUCTORS
+template <typename T>
+inline
+ComponentPool<T>::ComponentPool() : d_sparse(), d_entities(), d_components()
+{
+}
+
+template <typename T>
+inline
+ComponentPool<T>::ComponentPool( const ComponentPool<T>& pool )
+    : d_sparse( pool.d_sparse ), d_entities( pool.d_entities ),
+      d_components( pool.d_components )
+{
+}
+
+template <typename T>
+inline
+ComponentPool<T>::~ComponentPool()
+{
+}
+
+// OPERATORS
+template <typename T>
+inline
+ComponentPool<T>& ComponentPool<T>::operator=( const ComponentPool<T>& pool )
+{
+    d_sparse = pool.d_sparse;
+    d_entities = pool.d_entities;
+    d_components = pool.d_components;
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+template <typename T>
+inline
+unsigned int ComponentPool<T>::size() const
+{
+    return d_components.size();
+}
+
+template <typename T>
+inline
+bool ComponentPool<T>::has( Entity entity ) const
+{
+    return find( entity ) != ABSENT;
+}
+
+template <typename T>
+inline
+const T& ComponentPool<T>::get( Entity entity ) const
+{
+    unsigned int index = find( entity );
+
+    assert( index != ABSENT );
+
+    return d_components[index];
+}
+
+template <typename T>
+inline
+T& ComponentPool<T>::get( Entity entity )
+{
+    unsigned int index = find( entity );
+
+    assert( index != ABSENT );
+
+    return d_components[index];
+}
+
+template <typename T>
+inline
+Entity ComponentPool<T>::entity( unsigned int index ) const
+{
+    assert( index < d_entities.size() );
+
+    return d_entities[index];
+}
+
+template <typename T>
+inline
+const T& ComponentPool<T>::at( unsigned int index ) const
+{
+    assert( index < d_components.size() );
+
+    return d_components[index];
+}
+
+template <typename T>
+inline
+T& ComponentPool<T>::at( unsigned int index )
+{
+    assert( index < d_components.size() );
+
+    return d_components[index];
+}
+
+// MEMBER FUNCTIONS
+template <typename T>
+T& ComponentPool<T>::add( Entity entity, const T& component )
+{
+    assert( entity != Entities::INVALID );
+
+    unsigned int sparse = Entities::index( entity );
+    unsigned int index = find( entity );
+
+    if ( index != ABSENT )
+    {
+        d_components[index] = component;
+        return d_components[index];
+    }
+
+    while ( d_sparse.size() <= sparse )
+    {
+        d_sparse.push( ABSENT );
+    }
+
+    d_sparse[sparse] = d_components.size();
+    d_entities.push( entity );
+    d_components.push( component );
+
+    return d_components[d_components.size() - 1];
+}
+
+template <typename T>
+bool ComponentPool<T>::remove( Entity entity )
+{
+    unsigned int index = find( entity );
+    unsigned int last;
+
+    if ( index == ABSENT )
+    {
+        return false;
+    }
+
+    // fill the hole with the last component to keep the arrays packed
+    last = d_components.size() - 1;
+    if ( index != last )
+    {
+        d_components[index] = d_components[last];
+        d_entities[index] = d_entities[last];
+        d_sparse[Entities::index( d_entities[index] )] = index;
+    }
+
+    d_sparse[Entities::index( entity )] = ABSENT;
+    d_components.pop();
+    d_entities.pop();
+
+    return true;
+}
+
+template <typename T>
+void ComponentPool<T>::clear()
+{
+    while ( d_components.size() > 0 )
+    {
+        d_sparse[Entities::index( d_entities.pop() )] = ABSENT;
+        d_components.pop();
+    }
+}
+
+// HELPER FUNCTIONS
+template <typename T>
+inline
+unsigned int ComponentPool<T>::find( Entity entity ) const
+{
+    unsigned int sparse = Entities::index( entity );
+
+    if ( entity == Entities::INVALID || sparse >= d_sparse.size() )
+    {
+        return ABSENT;
+    }
+
+    unsigned int index = d_sparse[sparse];
+
+    return index != ABSENT && d_entities[index] == entity ? index : ABSENT;
+}
+
+// GLOBAL FUNCTIONS
+template <typename A, typename B, typename F>
+void join( ComponentPool<A>& first, ComponentPool<B>& second,
+           const F& function )
+{
+    unsigned int i;
+    Entity entity;
+
+    if ( first.size() <= second.size() )
+    {
+        for ( i = 0; i < first.size(); ++i )
+        {
+            entity = first.entity( i );
+            if ( second.has( entity ) )
+            {
+                function( entity, first.at( i ), second.get( entity ) );
+            }
+        }
+    }
+    else
+    {
+        for ( i = 0; i < second.size(); ++i )
+        {
+            entity = second.entity( i );
+            if ( first.has( entity ) )
+            {
+                function( entity, first.get( entity ), second.at( i ) );
+            }
+        }
+    }
+}
+
+} // End nspc sgdn
+
+} // End nspc StevensDev
+
+#endif
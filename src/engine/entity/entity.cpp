@@ -0,0 +1,18 @@
+// entity.cpp
+#include "entity.h"
+
+namespace StevensDev
+{
+
+namespace sgdn
+{
+
+// CONSTANTS
+const Entity Entities::INVALID;
+const unsigned int Entities::INDEX_BITS;
+const unsigned int Entities::INDEX_MASK;
+const unsigned int Entities::MAX_GENERATION;
+
+} // End nspc sgdn
+
+} // End nspc StevensDev
@@ -0,0 +1,67 @@
+// entity.h
+//
+// An entity is only an identifier. Its data lives in component pools that
+// are indexed by the low bits of the identifier while the high bits hold a
+// generation so that the identifiers of destroyed entities are never
+// mistaken for those of later ones.
+#ifndef INCLUDED_ENTITY
+#define INCLUDED_ENTITY
+
+namespace StevensDev
+{
+
+namespace sgdn
+{
+
+typedef unsigned int Entity;
+  // Identifies an entity.
+
+struct Entities
+{
+    // CONSTANTS
+    static const Entity INVALID = 0xffffffffu;
+      // An entity that never exists.
+
+    static const unsigned int INDEX_BITS = 20;
+      // The number of bits that hold the index.
+
+    static const unsigned int INDEX_MASK = ( 1u << INDEX_BITS ) - 1;
+      // Extracts the index from an entity.
+
+    static const unsigned int MAX_GENERATION = ~0u >> INDEX_BITS;
+      // The largest generation before it wraps.
+
+    // GLOBAL FUNCTIONS
+    static Entity make( unsigned int index, unsigned int generation );
+      // Makes the entity with the index and generation.
+
+    static unsigned int index( Entity entity );
+      // Gets the index of the entity.
+
+    static unsigned int generation( Entity entity );
+      // Gets the generation of the entity.
+};
+
+inline
+Entity Entities::make( unsigned int index, unsigned int generation )
+{
+    return ( generation << INDEX_BITS ) | ( index & INDEX_MASK );
+}
+
+inline
+unsigned int Entities::index( Entity entity )
+{
+    return entity & INDEX_MASK;
+}
+
+inline
+unsigned int Entities::generation( Entity entity )
+{
+    return entity >> INDEX_BITS;
+}
+
+} // End nspc sgdn
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,66 @@
+// entity_store.cpp
+#include "entity_store.h"
+
+namespace StevensDev
+{
+
+namespace sgdn
+{
+
+// GLOBALS
+EntityStore EntityStore::d_instance = EntityStore();
+
+// MEMBER FUNCTIONS
+Entity EntityStore::create()
+{
+    unsigned int index;
+
+    if ( d_free.size() > 0 )
+    {
+        index = d_free.pop();
+    }
+    else
+    {
+        assert( d_generations.size() <= Entities::INDEX_MASK );
+
+        index = d_generations.size();
+        d_generations.push( 0 );
+    }
+
+    // the top generation of the top index is the invalid entity
+    if ( Entities::make( index, d_generations[index] ) ==
+         Entities::INVALID )
+    {
+        d_generations[index] = 0;
+    }
+
+    ++d_size;
+
+    return Entities::make( index, d_generations[index] );
+}
+
+bool EntityStore::destroy( Entity entity )
+{
+    unsigned int index = Entities::index( entity );
+
+    if ( !isAlive( entity ) )
+    {
+        return false;
+    }
+
+    d_bounds.remove( entity );
+    d_velocities.remove( entity );
+    d_sprites.remove( entity );
+    d_flags.remove( entity );
+
+    d_generations[index] =
+        ( d_generations[index] + 1 ) & Entities::MAX_GENERATION;
+    d_free.push( index );
+    --d_size;
+
+    return true;
+}
+
+} // End nspc sgdn
+
+} // End nspc StevensDev
@@ -0,0 +1,240 @@
+// entity_store.h
+//
+// Creates entities and keeps each of their components in a pool of its own
+// type, so the data of every entity with a component is packed together in
+// contiguous memory instead of being spread across objects.
+//
+// The position of an entity is the origin of its bounds.
+#ifndef INCLUDED_ENTITY_STORE
+#define INCLUDED_ENTITY_STORE
+
+#include "../containers/dynamic_array.h"
+#include "../scene/rectangle_bounds.h"
+#include <assert.h>
+#include "component_pool.h"
+#include "entity.h"
+#include <gel/math/vec.h>
+
+namespace StevensDev
+{
+
+namespace sgdr
+{
+
+class RenderableSprite;
+
+} // End nspc sgdr
+
+namespace sgdn
+{
+
+class EntityStore
+{
+  private:
+    // GLOBALS
+    static EntityStore d_instance;
+      // The singleton instance.
+
+    // MEMBERS
+    sgdc::DynamicArray<unsigned int> d_generations;
+      // The current generation of each entity index.
+
+    sgdc::DynamicArray<unsigned int> d_free;
+      // The entity indices that can be reused.
+
+    unsigned int d_size;
+      // The number of live entities.
+
+    ComponentPool<sgds::RectangleBounds> d_bounds;
+      // The bounds of each entity (WU).
+
+    ComponentPool<gel::math::Vec2> d_velocities;
+      // The velocity of each moving entity (WU/sec).
+
+    ComponentPool<sgdr::RenderableSprite*> d_sprites;
+      // The sprite of each drawn entity.
+
+    ComponentPool<unsigned short> d_flags;
+      // The collision flags of each entity.
+
+  public:
+    // CONSTRUCTORS
+    EntityStore();
+      // Constructs a new empty store.
+
+    EntityStore( const EntityStore& store );
+      // Constructs a copy of the store.
+
+    ~EntityStore();
+      // Destructs the store.
+
+    // OPERATORS
+    EntityStore& operator=( const EntityStore& store );
+      // Makes this a copy of the store.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int size() const;
+      // Gets the number of live entities.
+
+    bool isAlive( Entity entity ) const;
+      // Checks if the entity was created and not destroyed.
+
+    const ComponentPool<sgds::RectangleBounds>& bounds() const;
+      // Gets the bounds of the entities.
+
+    const ComponentPool<gel::math::Vec2>& velocities() const;
+      // Gets the velocities of the entities.
+
+    const ComponentPool<sgdr::RenderableSprite*>& sprites() const;
+      // Gets the sprites of the entities.
+
+    const ComponentPool<unsigned short>& flags() const;
+      // Gets the collision flags of the entities.
+
+    // MUTATOR FUNCTIONS
+    ComponentPool<sgds::RectangleBounds>& bounds();
+      // Gets the bounds of the entities.
+
+    ComponentPool<gel::math::Vec2>& velocities();
+      // Gets the velocities of the entities.
+
+    ComponentPool<sgdr::RenderableSprite*>& sprites();
+      // Gets the sprites of the entities.
+
+    ComponentPool<unsigned short>& flags();
+      // Gets the collision flags of the entities.
+
+    // MEMBER FUNCTIONS
+    Entity create();
+      // Creates an entity without any components.
+
+    bool destroy( Entity entity );
+      // Destroys the entity and its components and returns false if it was
+      // not alive.
+
+    // GLOBAL FUNCTIONS
+    static EntityStore& inst();
+      // Gets the shared store.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const EntityStore& store )
+{
+    return stream << "{ \"size\": " << store.size() << " }";
+}
+
+// CONSTRUCTORS
+inline
+EntityStore::EntityStore() : d_generations(), d_free(), d_size( 0 ),
+                             d_bounds(), d_velocities(), d_sprites(),
+                             d_flags()
+{
+}
+
+inline
+EntityStore::EntityStore( const EntityStore& store )
+    : d_generations( store.d_generations ), d_free( store.d_free ),
+      d_size( store.d_size ), d_bounds( store.d_bounds ),
+      d_velocities( store.d_velocities ), d_sprites( store.d_sprites ),
+      d_flags( store.d_flags )
+{
+}
+
+inline
+EntityStore::~EntityStore()
+{
+}
+
+// OPERATORS
+inline
+EntityStore& EntityStore::operator=( const EntityStore& store )
+{
+    d_generations = store.d_generations;
+    d_free = store.d_free;
+    d_size = store.d_size;
+    d_bounds = store.d_bounds;
+    d_velocities = store.d_velocities;
+    d_sprites = store.d_sprites;
+    d_flags = store.d_flags;
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int EntityStore::size() const
+{
+    return d_size;
+}
+
+inline
+bool EntityStore::isAlive( Entity entity ) const
+{
+    unsigned int index = Entities::index( entity );
+
+    return entity != Entities::INVALID && index < d_generations.size() &&
+           d_generations[index] == Entities::generation( entity );
+}
+
+inline
+const ComponentPool<sgds::RectangleBounds>& EntityStore::bounds() const
+{
+    return d_bounds;
+}
+
+inline
+const ComponentPool<gel::math::Vec2>& EntityStore::velocities() const
+{
+    return d_velocities;
+}
+
+inline
+const ComponentPool<sgdr::RenderableSprite*>& EntityStore::sprites() const
+{
+    return d_sprites;
+}
+
+inline
+const ComponentPool<unsigned short>& EntityStore::flags() const
+{
+    return d_flags;
+}
+
+// MUTATOR FUNCTIONS
+inline
+ComponentPool<sgds::RectangleBounds>& EntityStore::bounds()
+{
+    return d_bounds;
+}
+
+inline
+ComponentPool<gel::math::Vec2>& EntityStore::velocities()
+{
+    return d_velocities;
+}
+
+inline
+ComponentPool<sgdr::RenderableSprite*>& EntityStore::sprites()
+{
+    return d_sprites;
+}
+
+inline
+ComponentPool<unsigned short>& EntityStore::flags()
+{
+    return d_flags;
+}
+
+// GLOBAL FUNCTIONS
+inline
+EntityStore& EntityStore::inst()
+{
+    return d_instance;
+}
+
+} // End nspc sgdn
+
+} // End nspc StevensDev
+
+#endif
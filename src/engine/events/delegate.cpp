@@ -0,0 +1,2 @@
+// delegate.cpp
+#include "delegate.h"
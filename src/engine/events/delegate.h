@@ -0,0 +1,424 @@
+// delegate.h
+//
+// A callback that keeps the callable it wraps inside itself instead of on
+// the heap. Lambdas, binds and function objects are copied into a fixed
+// inline buffer, and one that does not fit fails to compile rather than
+// allocating:
+//
+//     Delegate<void( const IEvent* )> listener =
+//         [&count]( const IEvent* event ) { ++count; };
+//
+// Member functions are bound as template arguments so that only the
+// object pointer is stored:
+//
+//     listener = Delegate<void( const IEvent* )>::bind<
+//         Listener, &Listener::receive>( &object );
+//
+// Callables that are trivially copyable are copied and moved with the
+// buffer itself so most delegates never call through a manager.
+#ifndef INCLUDED_DELEGATE
+#define INCLUDED_DELEGATE
+
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+template<typename Signature>
+class Delegate;
+
+template<typename R, typename... Args>
+class Delegate<R( Args... )>
+{
+  public:
+    // CONSTANTS
+    static const unsigned int CAPACITY = 4 * sizeof( void* );
+      // The number of bytes available for the callable.
+
+  private:
+    // ENUMERATIONS
+    enum Operation
+    {
+        COPY,
+          // Copy constructs the destination from the source.
+
+        MOVE,
+          // Move constructs the destination from the source and destructs
+          // the source.
+
+        DESTROY
+          // Destructs the destination.
+    };
+
+    // TYPES
+    typedef R ( *Invoker )( void* storage, Args... args );
+      // Calls the callable held in the storage.
+
+    typedef void ( *Manager )( Operation operation, void* dst, void* src );
+      // Copies, moves or destructs the callable held in the storage.
+
+    typedef typename std::aligned_storage<
+        CAPACITY, alignof( std::max_align_t )>::type Storage;
+      // Defines the inline buffer that holds the callable.
+
+    // MEMBERS
+    mutable Storage d_storage;
+      // The callable.
+
+    Invoker d_invoker;
+      // Calls the callable or nullptr if the delegate is empty.
+
+    Manager d_manager;
+      // Manages the callable or nullptr if it is trivially copyable.
+
+    // HELPER FUNCTIONS
+    template<typename F>
+    static R invoke( void* storage, Args... args );
+      // Calls the callable of type F held in the storage.
+
+    template<typename C, R ( C::*M )( Args... )>
+    static R invokeMember( void* storage, Args... args );
+      // Calls the member function on the object held in the storage.
+
+    template<typename C, R ( C::*M )( Args... ) const>
+    static R invokeConstMember( void* storage, Args... args );
+      // Calls the const member function on the object held in the
+      // storage.
+
+    template<typename F>
+    static void manage( Operation operation, void* dst, void* src );
+      // Copies, moves or destructs the callable of type F.
+
+    void assign( const Delegate& delegate );
+      // Copies the other delegate into this empty one.
+
+    void take( Delegate& delegate );
+      // Moves the other delegate into this empty one and empties it.
+
+  public:
+    // CONSTRUCTORS
+    Delegate();
+      // Constructs a new empty delegate.
+
+    Delegate( std::nullptr_t );
+      // Constructs a new empty delegate.
+
+    template<typename F,
+             typename = typename std::enable_if<!std::is_same<
+                 typename std::decay<F>::type, Delegate>::value>::type>
+    Delegate( F&& callable );
+      // Constructs a new delegate that holds a copy of the callable.
+      //
+      // The callable must fit in CAPACITY bytes.
+
+    Delegate( const Delegate& delegate );
+      // Constructs a copy of the delegate.
+
+    Delegate( Delegate&& delegate );
+      // Constructs a delegate from another, leaving it empty.
+
+    ~Delegate();
+      // Destructs the delegate.
+
+    // OPERATORS
+    Delegate& operator=( const Delegate& delegate );
+      // Makes this a copy of the delegate.
+
+    Delegate& operator=( Delegate&& delegate );
+      // Takes the callable of the delegate, leaving it empty.
+
+    Delegate& operator=( std::nullptr_t );
+      // Empties the delegate.
+
+    explicit operator bool() const;
+      // Checks if the delegate holds a callable.
+
+    R operator()( Args... args ) const;
+      // Calls the callable.
+      //
+      // Behavior is undefined when:
+      // the delegate is empty
+
+    // MEMBER FUNCTIONS
+    void reset();
+      // Empties the delegate.
+
+    // GLOBAL FUNCTIONS
+    template<typename C, R ( C::*M )( Args... )>
+    static Delegate bind( C* object );
+      // Creates a delegate that calls the member function on the object,
+      // which must outlive it.
+
+    template<typename C, R ( C::*M )( Args... ) const>
+    static Delegate bind( const C* object );
+      // Creates a delegate that calls the const member function on the
+      // object, which must outlive it.
+};
+
+// FREE OPERATORS
+template<typename R, typename... Args>
+inline
+std::ostream& operator<<( std::ostream& stream,
+                          const Delegate<R( Args... )>& delegate )
+{
+    return stream << "{ \"isBound\": "
+                  << ( static_cast<bool>( delegate ) ? "true" : "false" )
+                  << " }";
+}
+
+// CONSTANTS
+template<typename R, typename... Args>
+const unsigned int Delegate<R( Args... )>::CAPACITY;
+
+// CONSTRUCTORS
+template<typename R, typename... Args>
+inline
+Delegate<R( Args... )>::Delegate() : d_storage(), d_invoker( nullptr ),
+                                    d_manager( nullptr )
+{
+}
+
+template<typename R, typename... Args>
+inline
+Delegate<R( Args... )>::Delegate( std::nullptr_t )
+    : d_storage(), d_invoker( nullptr ), d_manager( nullptr )
+{
+}
+
+template<typename R, typename... Args>
+template<typename F, typename>
+inline
+Delegate<R( Args... )>::Delegate( F&& callable )
+    : d_storage(), d_invoker( nullptr ), d_manager( nullptr )
+{
+    typedef typename std::decay<F>::type Callable;
+
+    static_assert( sizeof( Callable ) <= CAPACITY,
+                   "The callable is too large for a delegate." );
+    static_assert( alignof( Callable ) <= alignof( Storage ),
+                   "The callable is too strictly aligned for a delegate." );
+
+    new ( &d_storage ) Callable( std::forward<F>( callable ) );
+    d_invoker = &invoke<Callable>;
+
+    if ( !std::is_trivially_copyable<Callable>::value )
+    {
+        d_manager = &manage<Callable>;
+    }
+}
+
+template<typename R, typename... Args>
+inline
+Delegate<R( Args... )>::Delegate( const Delegate& delegate )
+    : d_storage(), d_invoker( nullptr ), d_manager( nullptr )
+{
+    assign( delegate );
+}
+
+template<typename R, typename... Args>
+inline
+Delegate<R( Args... )>::Delegate( Delegate&& delegate )
+    : d_storage(), d_invoker( nullptr ), d_manager( nullptr )
+{
+    take( delegate );
+}
+
+template<typename R, typename... Args>
+inline
+Delegate<R( Args... )>::~Delegate()
+{
+    reset();
+}
+
+// OPERATORS
+template<typename R, typename... Args>
+inline
+Delegate<R( Args... )>& Delegate<R( Args... )>::operator=(
+    const Delegate& delegate )
+{
+    if ( &delegate != this )
+    {
+        reset();
+        assign( delegate );
+    }
+
+    return *this;
+}
+
+template<typename R, typename... Args>
+inline
+Delegate<R( Args... )>& Delegate<R( Args... )>::operator=(
+    Delegate&& delegate )
+{
+    if ( &delegate != this )
+    {
+        reset();
+        take( delegate );
+    }
+
+    return *this;
+}
+
+template<typename R, typename... Args>
+inline
+Delegate<R( Args... )>& Delegate<R( Args... )>::operator=( std::nullptr_t )
+{
+    reset();
+
+    return *this;
+}
+
+template<typename R, typename... Args>
+inline
+Delegate<R( Args... )>::operator bool() const
+{
+    return d_invoker != nullptr;
+}
+
+template<typename R, typename... Args>
+inline
+R Delegate<R( Args... )>::operator()( Args... args ) const
+{
+    return d_invoker( &d_storage, std::forward<Args>( args )... );
+}
+
+// MEMBER FUNCTIONS
+template<typename R, typename... Args>
+inline
+void Delegate<R( Args... )>::reset()
+{
+    if ( d_manager != nullptr )
+    {
+        d_manager( DESTROY, &d_storage, nullptr );
+    }
+
+    d_invoker = nullptr;
+    d_manager = nullptr;
+}
+
+// GLOBAL FUNCTIONS
+template<typename R, typename... Args>
+template<typename C, R ( C::*M )( Args... )>
+inline
+Delegate<R( Args... )> Delegate<R( Args... )>::bind( C* object )
+{
+    Delegate delegate;
+
+    new ( &delegate.d_storage ) C*( object );
+    delegate.d_invoker = &invokeMember<C, M>;
+
+    return delegate;
+}
+
+template<typename R, typename... Args>
+template<typename C, R ( C::*M )( Args... ) const>
+inline
+Delegate<R( Args... )> Delegate<R( Args... )>::bind( const C* object )
+{
+    Delegate delegate;
+
+    new ( &delegate.d_storage ) const C*( object );
+    delegate.d_invoker = &invokeConstMember<C, M>;
+
+    return delegate;
+}
+
+// HELPER FUNCTIONS
+template<typename R, typename... Args>
+template<typename F>
+inline
+R Delegate<R( Args... )>::invoke( void* storage, Args... args )
+{
+    return ( *static_cast<F*>( storage ) )( std::forward<Args>( args )... );
+}
+
+template<typename R, typename... Args>
+template<typename C, R ( C::*M )( Args... )>
+inline
+R Delegate<R( Args... )>::invokeMember( void* storage, Args... args )
+{
+    return ( ( *static_cast<C**>( storage ) )->*M )(
+        std::forward<Args>( args )... );
+}
+
+template<typename R, typename... Args>
+template<typename C, R ( C::*M )( Args... ) const>
+inline
+R Delegate<R( Args... )>::invokeConstMember( void* storage, Args... args )
+{
+    return ( ( *static_cast<const C**>( storage ) )->*M )(
+        std::forward<Args>( args )... );
+}
+
+template<typename R, typename... Args>
+template<typename F>
+inline
+void Delegate<R( Args... )>::manage( Operation operation, void* dst,
+                                     void* src )
+{
+    switch ( operation )
+    {
+        case COPY:
+            new ( dst ) F( *static_cast<const F*>( src ) );
+            break;
+
+        case MOVE:
+            new ( dst ) F( std::move( *static_cast<F*>( src ) ) );
+            static_cast<F*>( src )->~F();
+            break;
+
+        case DESTROY:
+            static_cast<F*>( dst )->~F();
+            break;
+    }
+}
+
+template<typename R, typename... Args>
+inline
+void Delegate<R( Args... )>::assign( const Delegate& delegate )
+{
+    if ( delegate.d_manager != nullptr )
+    {
+        delegate.d_manager( COPY, &d_storage, &delegate.d_storage );
+    }
+    else
+    {
+        std::memcpy( &d_storage, &delegate.d_storage, sizeof( Storage ) );
+    }
+
+    d_invoker = delegate.d_invoker;
+    d_manager = delegate.d_manager;
+}
+
+template<typename R, typename... Args>
+inline
+void Delegate<R( Args... )>::take( Delegate& delegate )
+{
+    if ( delegate.d_manager != nullptr )
+    {
+        delegate.d_manager( MOVE, &d_storage, &delegate.d_storage );
+    }
+    else
+    {
+        std::memcpy( &d_storage, &delegate.d_storage, sizeof( Storage ) );
+    }
+
+    d_invoker = delegate.d_invoker;
+    d_manager = delegate.d_manager;
+    delegate.d_invoker = nullptr;
+    delegate.d_manager = nullptr;
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,2 @@
+// event_batch.cpp
+#include "event_batch.h"
@@ -0,0 +1,228 @@
+// event_batch.h
+//
+// Holds the queued events of one type until they are delivered. Events are
+// constructed in place in a frame arena, which owns them, and the batch
+// only keeps their addresses, so queueing an event never allocates once
+// the arena and the batch have grown to fit a frame. Events queued while a
+// batch is being delivered wait for the next delivery so that a listener
+// that queues more events cannot keep the current one going.
+#ifndef INCLUDED_EVENT_BATCH
+#define INCLUDED_EVENT_BATCH
+
+#include "../containers/dynamic_array.h"
+#include "../memory/frame_arena.h"
+#include <assert.h>
+#include "ievent_batch.h"
+#include <utility>
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+template<typename T>
+class EventBatch : public IEventBatch
+{
+  private:
+    // MEMBERS
+    sgdc::DynamicArray<T*> d_queued;
+      // The events waiting for the next flip.
+
+    sgdc::DynamicArray<T*> d_delivering;
+      // The events being delivered.
+
+  public:
+    // CONSTRUCTORS
+    EventBatch();
+      // Constructs a new empty batch.
+
+    EventBatch( const EventBatch<T>& batch );
+      // Constructs a batch that refers to the same events.
+
+    virtual ~EventBatch();
+      // Destructs the batch.
+
+    // OPERATORS
+    EventBatch<T>& operator=( const EventBatch<T>& batch );
+      // Makes this refer to the same events as the batch.
+
+    virtual const IEvent& operator[]( unsigned int index ) const;
+      // Gets an event being delivered.
+
+    // ACCESSOR FUNCTIONS
+    virtual unsigned int queued() const;
+      // Gets the number of events waiting for the next flip.
+
+    virtual unsigned int size() const;
+      // Gets the number of events being delivered.
+
+    const T& at( unsigned int index ) const;
+      // Gets an event being delivered without a virtual call.
+
+    // MEMBER FUNCTIONS
+    template<typename... Args>
+    T& emplace( sgdm::FrameArena* arena, Args&&... args );
+      // Constructs an event with the arguments in the arena and queues it.
+      //
+      // The arena must not be reset until the event has been delivered.
+
+    void push( sgdm::FrameArena* arena, const T& event );
+      // Queues a copy of the event made in the arena.
+
+    void push( T* event );
+      // Queues an event that must outlive its delivery.
+
+    virtual void flip();
+      // Makes the waiting events the ones being delivered and starts
+      // waiting for new ones.
+
+    virtual void clear();
+      // Forgets the events being delivered.
+
+    virtual IEventBatch* clone( sgdm::FrameArena* arena ) const;
+      // Creates a copy of the batch with copies of its events made in the
+      // arena that the caller must delete.
+};
+
+// FREE OPERATORS
+template<typename T>
+inline
+std::ostream& operator<<( std::ostream& stream, const EventBatch<T>& batch )
+{
+    return stream << "{ \"queued\": " << batch.queued()
+                  << ", \"size\": " << batch.size() << " }";
+}
+
+// CONSTRUCTORS
+template<typename T>
+inline
+EventBatch<T>::EventBatch() : d_queued(), d_delivering()
+{
+}
+
+template<typename T>
+inline
+EventBatch<T>::EventBatch( const EventBatch<T>& batch )
+    : d_queued( batch.d_queued ), d_delivering( batch.d_delivering )
+{
+}
+
+template<typename T>
+inline
+EventBatch<T>::~EventBatch()
+{
+}
+
+// OPERATORS
+template<typename T>
+inline
+EventBatch<T>& EventBatch<T>::operator=( const EventBatch<T>& batch )
+{
+    d_queued = batch.d_queued;
+    d_delivering = batch.d_delivering;
+
+    return *this;
+}
+
+template<typename T>
+inline
+const IEvent& EventBatch<T>::operator[]( unsigned int index ) const
+{
+    return *d_delivering[index];
+}
+
+// ACCESSOR FUNCTIONS
+template<typename T>
+inline
+unsigned int EventBatch<T>::queued() const
+{
+    return d_queued.size();
+}
+
+template<typename T>
+inline
+unsigned int EventBatch<T>::size() const
+{
+    return d_delivering.size();
+}
+
+template<typename T>
+inline
+const T& EventBatch<T>::at( unsigned int index ) const
+{
+    return *d_delivering[index];
+}
+
+// MEMBER FUNCTIONS
+template<typename T>
+template<typename... Args>
+inline
+T& EventBatch<T>::emplace( sgdm::FrameArena* arena, Args&&... args )
+{
+    assert( arena != nullptr );
+
+    T* event = arena->create<T>( std::forward<Args>( args )... );
+
+    push( event );
+
+    return *event;
+}
+
+template<typename T>
+inline
+void EventBatch<T>::push( sgdm::FrameArena* arena, const T& event )
+{
+    emplace( arena, event );
+}
+
+template<typename T>
+inline
+void EventBatch<T>::push( T* event )
+{
+    assert( event != nullptr );
+
+    d_queued.push( event );
+}
+
+template<typename T>
+inline
+void EventBatch<T>::flip()
+{
+    // both arrays keep their capacity so a steady stream never allocates
+    std::swap( d_queued, d_delivering );
+    d_queued.clear();
+}
+
+template<typename T>
+inline
+void EventBatch<T>::clear()
+{
+    d_delivering.clear();
+}
+
+template<typename T>
+inline
+IEventBatch* EventBatch<T>::clone( sgdm::FrameArena* arena ) const
+{
+    EventBatch<T>* batch = new EventBatch<T>();
+    unsigned int i;
+
+    for ( i = 0; i < d_queued.size(); ++i )
+    {
+        batch->push( arena, *d_queued[i] );
+    }
+
+    for ( i = 0; i < d_delivering.size(); ++i )
+    {
+        batch->d_delivering.push( arena->create<T>( *d_delivering[i] ) );
+    }
+
+    return batch;
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
+
+#endif
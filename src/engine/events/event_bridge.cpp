@@ -0,0 +1,61 @@
+// event_bridge.cpp
+#include "event_bridge.h"
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+// CONSTRUCTORS
+EventBridge::~EventBridge()
+{
+    unsigned int i;
+
+    for ( i = 0; i < d_sourceHandles.size(); ++i )
+    {
+        d_source->remove( d_sourceHandles[i] );
+    }
+
+    for ( i = 0; i < d_targetHandles.size(); ++i )
+    {
+        d_target->remove( d_targetHandles[i] );
+    }
+}
+
+// MEMBER FUNCTIONS
+void EventBridge::add( EventTypeId type )
+{
+    d_types.push( type );
+    d_sourceHandles.push( d_source->add(
+        type, EventListener::bind<EventBridge, &EventBridge::forward>(
+                  this ) ) );
+
+    if ( d_direction == BOTH_WAYS )
+    {
+        d_targetHandles.push( d_target->add(
+            type, EventListener::bind<EventBridge, &EventBridge::backward>(
+                      this ) ) );
+    }
+}
+
+// HELPER FUNCTIONS
+void EventBridge::pass( const IEvent* event, EventDispatcher* dispatcher )
+{
+    // an event heard while passing it on is its echo from the other side
+    if ( event == d_passing )
+    {
+        return;
+    }
+
+    const IEvent* passing = d_passing;
+
+    d_passing = event;
+    ++d_passed;
+    dispatcher->dispatch( event );
+    d_passing = passing;
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
@@ -0,0 +1,197 @@
+// event_bridge.h
+//
+// Passes the events of chosen types from one dispatcher on to another so
+// that scoped dispatchers can still share the few events that matter to
+// both, such as a world reporting a score to the process-wide interface:
+//
+//     EventBridge bridge( &world, &EventBus::globalDispatcher() );
+//
+//     bridge.add( "score" );
+//
+// A bridge listens for each added type, which takes in every type within
+// it when it is a category, and dispatches what it hears on the other
+// dispatcher right away, so queued events are passed on as they are
+// delivered. A bridge that goes both ways never passes an event back to
+// the dispatcher it came from.
+//
+// Like any listener, the bridge only hears events once the dispatchers
+// have post-ticked after an add. Its listeners are removed when it is
+// destructed, which is also applied at the next post-tick, so the bridge
+// must outlive any dispatching that happens before then.
+#ifndef INCLUDED_EVENT_BRIDGE
+#define INCLUDED_EVENT_BRIDGE
+
+#include "../containers/dynamic_array.h"
+#include <assert.h>
+#include "event_dispatcher.h"
+#include "event_types.h"
+#include "ievent.h"
+#include <iostream>
+#include <string>
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+class EventBridge
+{
+  public:
+    // ENUMERATIONS
+    enum Direction
+    {
+        FORWARD,
+          // Events are only passed from the source to the target.
+
+        BOTH_WAYS
+          // Events are passed from either dispatcher to the other.
+    };
+
+  private:
+    // MEMBERS
+    EventDispatcher* d_source;
+      // The dispatcher whose events are passed on.
+
+    EventDispatcher* d_target;
+      // The dispatcher that is given the events.
+
+    Direction d_direction;
+      // Which way events are passed.
+
+    sgdc::DynamicArray<EventTypeId> d_types;
+      // The types whose events are passed on.
+
+    sgdc::DynamicArray<EventHandle> d_sourceHandles;
+      // The bridge's listeners on the source.
+
+    sgdc::DynamicArray<EventHandle> d_targetHandles;
+      // The bridge's listeners on the target.
+
+    const IEvent* d_passing;
+      // The event being passed on or nullptr.
+
+    unsigned long long d_passed;
+      // The number of events that were passed on.
+
+    // HELPER FUNCTIONS
+    void forward( const IEvent* event );
+      // Passes the event on to the target.
+
+    void backward( const IEvent* event );
+      // Passes the event back to the source.
+
+    void pass( const IEvent* event, EventDispatcher* dispatcher );
+      // Dispatches the event on the dispatcher unless the bridge is
+      // already passing it.
+
+    // CONSTRUCTORS
+    EventBridge( const EventBridge& bridge );
+      // Bridges are listened to by address and cannot be copied.
+
+    // OPERATORS
+    EventBridge& operator=( const EventBridge& bridge );
+      // Bridges are listened to by address and cannot be copied.
+
+  public:
+    // CONSTRUCTORS
+    EventBridge( EventDispatcher* source, EventDispatcher* target,
+                 Direction direction = FORWARD );
+      // Constructs a bridge between the dispatchers that does not pass on
+      // any types yet.
+      //
+      // Requirements:
+      // source and target are different dispatchers that outlive the
+      // bridge
+
+    ~EventBridge();
+      // Removes the bridge's listeners from both dispatchers.
+
+    // ACCESSOR FUNCTIONS
+    Direction direction() const;
+      // Gets which way events are passed.
+
+    unsigned int size() const;
+      // Gets the number of types that are passed on.
+
+    unsigned long long passed() const;
+      // Gets the number of events that were passed on.
+
+    // MEMBER FUNCTIONS
+    void add( const std::string& type );
+      // Passes on the events of the type or of every type within the
+      // category.
+
+    void add( EventTypeId type );
+      // Passes on the events of the interned type or of every type within
+      // it.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const EventBridge& bridge )
+{
+    return stream << "{ \"direction\": "
+                  << ( bridge.direction() == EventBridge::FORWARD
+                       ? "\"forward\"" : "\"bothWays\"" )
+                  << ", \"size\": " << bridge.size()
+                  << ", \"passed\": " << bridge.passed() << " }";
+}
+
+// CONSTRUCTORS
+inline
+EventBridge::EventBridge( EventDispatcher* source, EventDispatcher* target,
+                          Direction direction )
+    : d_source( source ), d_target( target ), d_direction( direction ),
+      d_types(), d_sourceHandles(), d_targetHandles(), d_passing( nullptr ),
+      d_passed( 0 )
+{
+    assert( source != nullptr );
+    assert( target != nullptr );
+    assert( source != target );
+}
+
+// ACCESSOR FUNCTIONS
+inline
+EventBridge::Direction EventBridge::direction() const
+{
+    return d_direction;
+}
+
+inline
+unsigned int EventBridge::size() const
+{
+    return d_types.size();
+}
+
+inline
+unsigned long long EventBridge::passed() const
+{
+    return d_passed;
+}
+
+// MEMBER FUNCTIONS
+inline
+void EventBridge::add( const std::string& type )
+{
+    add( EventTypes::inst().intern( type ) );
+}
+
+// HELPER FUNCTIONS
+inline
+void EventBridge::forward( const IEvent* event )
+{
+    pass( event, d_target );
+}
+
+inline
+void EventBridge::backward( const IEvent* event )
+{
+    pass( event, d_source );
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
+
+#endif
@@ -11,6 +11,8 @@ namespace sgde
 // GLOBALS
 EventDispatcher EventBus::d_instance = EventDispatcher();
 
+EventQueue EventBus::d_queue( &EventBus::d_instance );
+
 } // End nspc StevensDev
 
 } // End nspc sgde
@@ -1,8 +1,16 @@
 // event_bus.h
+//
+// Finds the dispatcher and queue that code raising or listening to events
+// should use. By default these are shared by the whole process, but a
+// thread that opens an EventScope is given the scope's instead until it
+// is closed, so independent simulations never share listeners or queued
+// events.
 #ifndef INCLUDED_EVENT_BUS
 #define INCLUDED_EVENT_BUS
 
 #include "event_dispatcher.h"
+#include "event_queue.h"
+#include "event_scope.h"
 #include "ievent.h"
 
 namespace StevensDev
@@ -18,6 +26,9 @@ class EventBus
     static EventDispatcher d_instance;
       // The singleton instance of the dispatcher.
 
+    static EventQueue d_queue;
+      // The queue that other threads post to the dispatcher through.
+
     // CONSTRUCTORS
     EventBus();
       // Constructs a new event bus.
@@ -36,7 +47,19 @@ class EventBus
 
     // GLOBAL FUNCTIONS
     static EventDispatcher& dispatcher();
-      // Gets the event dispatcher acting as the event bus.
+      // Gets the event dispatcher acting as the event bus of the calling
+      // thread, which is that of its innermost scope or else the
+      // process-wide one.
+      //
+      // Only the main thread may use the process-wide dispatcher.
+
+    static EventQueue& queue();
+      // Gets the queue that any thread can post events to the bus of the
+      // calling thread through, which is that of its innermost scope or
+      // else the process-wide one.
+
+    static EventDispatcher& globalDispatcher();
+      // Gets the process-wide dispatcher whatever scope is open.
 };
 
 // FREE OPERATORS
@@ -74,6 +97,22 @@ EventBus& EventBus::operator=( const EventBus& other )
 // GLOBAL FUNCTIONS
 inline
 EventDispatcher& EventBus::dispatcher()
+{
+    EventScope* scope = EventScope::current();
+
+    return scope != nullptr ? *scope->dispatcher() : d_instance;
+}
+
+inline
+EventQueue& EventBus::queue()
+{
+    EventScope* scope = EventScope::current();
+
+    return scope != nullptr ? *scope->queue() : d_queue;
+}
+
+inline
+EventDispatcher& EventBus::globalDispatcher()
 {
     return d_instance;
 }
@@ -1,6 +1,7 @@
 // event_dispatcher.cpp
 #include "event_dispatcher.h"
-
+#include "../profiling/profile_scope.h"
+#include "../time/time_source.h"
 
 namespace StevensDev
 {
@@ -12,88 +13,203 @@ void EventDispatcher::dispatch( const IEvent* event )
 {
     assert( event != nullptr );
 
-    // ensure listeners exist
-    if ( !d_registered.has( event->type() ) )
+    if ( d_observer )
     {
-        return;
+        d_observer( event );
     }
 
-    const sgdc::DynamicArray<RegisteredListener>& registered =
-        d_registered[event->type()];
+    EventTypeId type = event->typeId();
 
+    sgdk::TimePoint start = 0;
     unsigned int i;
-    for ( i = 0; i < registered.size(); ++i )
+
+    route( type );
+
+    if ( d_stats != nullptr )
     {
-        ( registered[i].listener )( event );
+        d_stats->countEvents( type, 1 );
     }
-}
 
-void EventDispatcher::preTick()
-{
-    // does nothing
-}
+    for ( i = d_routes.begin( type ); i < d_routes.end( type ); ++i )
+    {
+        const RegisteredListener& registered = d_routes[i];
 
-void EventDispatcher::tick( float dtS )
-{
-    // does nothing
+        if ( d_stats != nullptr )
+        {
+            start = sgdk::TimeSource::now();
+        }
+
+        if ( registered.listener )
+        {
+            registered.listener( event );
+        }
+        else
+        {
+            registered.batchListener( EventSpan( type, event ) );
+        }
+
+        if ( d_stats != nullptr )
+        {
+            d_stats->timeListener( type, d_listeners.handle( registered.slot ),
+                                   sgdk::TimeSource::now() - start );
+        }
+    }
 }
 
-void EventDispatcher::postTick()
+void EventDispatcher::deliver()
 {
-    PendingAddition newItem;
-    PendingRemoval oldItem;
+    PROFILE_SCOPE( "EventDispatcher::deliver" );
 
-    while ( d_pendingAddition.size() > 0 )
+    sgdk::TimePoint start = 0;
+    unsigned int delivering = d_arena;
+    unsigned int type;
+    unsigned int i;
+    unsigned int j;
+
+    // only the events queued so far are delivered
+    for ( type = 0; type < d_queues.size(); ++type )
     {
-        newItem = d_pendingAddition.pop();
-        d_registered[newItem.first].push( newItem.second );
+        if ( d_queues[type] != nullptr )
+        {
+            d_queues[type]->flip();
+        }
     }
 
-    while ( d_pendingRemoval.size() > 0 )
+    // events queued by the listeners are made in the other arena
+    d_arena = 1 - d_arena;
+
+    for ( type = 0; type < d_queues.size(); ++type )
     {
-        oldItem = d_pendingRemoval.pop();
-        int pos = findListener( oldItem.first, oldItem.second );
+        IEventBatch* batch = d_queues[type];
 
-        if ( pos < 0 )
+        if ( batch == nullptr || batch->size() == 0 )
         {
             continue;
         }
 
-        d_registered[oldItem.first].removeAt( ( unsigned int )pos );
+        if ( d_observer )
+        {
+            for ( j = 0; j < batch->size(); ++j )
+            {
+                d_observer( &( *batch )[j] );
+            }
+        }
+
+        route( type );
+
+        if ( d_stats != nullptr )
+        {
+            d_stats->countEvents( type, batch->size() );
+        }
+
+        for ( i = d_routes.begin( type ); i < d_routes.end( type ); ++i )
+        {
+            const RegisteredListener& registered = d_routes[i];
+
+            if ( d_stats != nullptr )
+            {
+                start = sgdk::TimeSource::now();
+            }
+
+            if ( registered.listener )
+            {
+                for ( j = 0; j < batch->size(); ++j )
+                {
+                    registered.listener( &( *batch )[j] );
+                }
+            }
+            else
+            {
+                registered.batchListener( EventSpan( type, batch ) );
+            }
+
+            if ( d_stats != nullptr )
+            {
+                d_stats->timeListener( type,
+                                       d_listeners.handle( registered.slot ),
+                                       sgdk::TimeSource::now() - start );
+            }
+        }
+
+        batch->clear();
     }
+
+    d_arenas[delivering].reset();
 }
 
-// HELPER FUNCTIONS
-int EventDispatcher::findListener( const std::string& item,
-                                            EventHandle handle )
+void EventDispatcher::preTick()
+{
+    if ( d_phase == DELIVER_ON_PRE_TICK )
+    {
+        deliver();
+    }
+}
+
+void EventDispatcher::tick( float dtS )
 {
-    return findListener( d_registered[item], handle,
-                         0, d_registered[item].size() );
+    if ( d_phase == DELIVER_ON_TICK )
+    {
+        deliver();
+    }
 }
 
-int EventDispatcher::findListener(
-    const sgdc::DynamicArray<RegisteredListener>& listeners,
-    EventHandle handle, unsigned int start, unsigned int end )
+void EventDispatcher::postTick()
 {
-    if ( start >= end )
+    if ( d_phase == DELIVER_ON_POST_TICK )
+    {
+        deliver();
+    }
+
+    if ( d_listeners.flush() )
+    {
+        d_routes.rebuild( d_listeners );
+    }
+
+    if ( d_stats != nullptr )
     {
-        return -1;
+        d_stats->endFrame();
     }
+}
 
-    unsigned int middle = ( end + start ) / 2;
+// ACCESSOR FUNCTIONS
+unsigned int EventDispatcher::queued() const
+{
+    unsigned int count = 0;
+    unsigned int i;
 
-    if ( handle == listeners[middle].handle )
+    for ( i = 0; i < d_queues.size(); ++i )
     {
-        return middle;
+        count += d_queues[i] != nullptr ? d_queues[i]->queued() : 0;
     }
-    else if ( handle < listeners[middle].handle )
+
+    return count;
+}
+
+// HELPER FUNCTIONS
+void EventDispatcher::copyQueues(
+    const sgdc::DynamicArray<IEventBatch*>& queues )
+{
+    unsigned int i;
+
+    deleteQueues();
+
+    for ( i = 0; i < queues.size(); ++i )
     {
-        return findListener( listeners, handle, start, middle );
+        d_queues.push( queues[i] != nullptr ?
+                       queues[i]->clone( &d_arenas[d_arena] ) : nullptr );
     }
-    else
+}
+
+void EventDispatcher::deleteQueues()
+{
+    unsigned int i;
+
+    for ( i = 0; i < d_queues.size(); ++i )
     {
-        return findListener( listeners, handle, middle + 1, end );
+        delete d_queues[i];
     }
+
+    d_queues.clear();
 }
 
 } // End nspc sgde
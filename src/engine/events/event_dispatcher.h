@@ -1,12 +1,51 @@
 // event_dispatcher.h
+//
+// Delivers events to the listeners registered for their types and for the
+// categories their types are within, so a listener of "collision" is
+// given "collision.player" and "collision.wall" events alike. Types are
+// interned and the listeners of each are gathered into a routing table
+// whenever registrations change, so dispatching an event walks one flat
+// range found by indexing with its type identifier.
+//
+// Events are either dispatched, which calls every listener immediately,
+// or queued, which constructs them in a frame arena and lists them in a
+// buffer for their type to be delivered later in one go. Queued events
+// are delivered type by type in the order they were queued, during the
+// tick phase chosen with setDeliveryPhase or whenever deliver is called,
+// so a burst of events cannot cascade through the tickable that raised
+// it. Batch listeners are given every event of their type in a single
+// span.
+//
+// Queued events are owned by the dispatcher and live until the delivery
+// that gives them to the listeners has finished, when the arena they were
+// made in is reset, so queueing never allocates once the arenas have
+// grown to fit a frame:
+//
+//     dispatcher.emit<CollisionEvent>( first, second );
+//
+// Listeners are delegates that hold their captures inline, so neither
+// registering nor calling one allocates. They are kept in a registry whose
+// handles remove them in constant time, and additions and removals are
+// applied together after delivery in the post-tick phase.
+//
+// A dispatcher that is given EventStats counts the events of each type and
+// times every listener call so that a frame spike can be traced to the
+// type and listener that caused it. Each post-tick ends a frame of the
+// stats, which reports the types that went over their thresholds.
 #ifndef INCLUDED_EVENT_DISPATCHER
 #define INCLUDED_EVENT_DISPATCHER
 
 #include "../containers/dynamic_array.h"
-#include "../containers/map.h"
+#include "../memory/frame_arena.h"
 #include "../scene/itickable.h"
-#include <functional>
+#include "event_batch.h"
+#include "event_span.h"
+#include "event_stats.h"
+#include "event_types.h"
 #include "ievent.h"
+#include "ievent_batch.h"
+#include "listener_registry.h"
+#include "routing_table.h"
 #include <string>
 
 namespace StevensDev
@@ -15,51 +54,66 @@ namespace StevensDev
 namespace sgde
 {
 
-typedef unsigned int EventHandle;
-  // Defines a listener unique handle that is used to identify registered
-  // callbacks.
-
-typedef std::function<void( const IEvent* )> EventListener;
-  // Defines a listener callback..
-
 class EventDispatcher : public sgds::ITickable
 {
-  private:
-    struct RegisteredListener
+  public:
+    // ENUMERATIONS
+    enum DeliveryPhase
     {
-        EventHandle handle;
-        EventListener listener;
-    };
+        DELIVER_ON_PRE_TICK,
+          // Queued events are delivered before anything else ticks.
+
+        DELIVER_ON_TICK,
+          // Queued events are delivered when the dispatcher ticks.
 
-    // TYPES
-    typedef std::pair<std::string, RegisteredListener> PendingAddition;
-      // Defines an item that is pending for addition.
+        DELIVER_ON_POST_TICK,
+          // Queued events are delivered before listener changes apply.
 
-    typedef std::pair<std::string, EventHandle> PendingRemoval;
+        DELIVER_MANUALLY
+          // Queued events are only delivered by calling deliver.
+    };
 
+  private:
     // MEMBERS
-    sgdc::Map<sgdc::DynamicArray<RegisteredListener>> d_registered;
-      // A map of the registered event listeners to their event types.
+    ListenerRegistry d_listeners;
+      // The registered event listeners.
+
+    RoutingTable d_routes;
+      // The listeners given the events of each type.
+
+    EventListener d_observer;
+      // Sees every dispatched event before the listeners or is empty.
 
-    sgdc::DynamicArray<PendingAddition> d_pendingAddition;
-      // List of listeners to register during post-tick cycle.
+    sgdc::DynamicArray<IEventBatch*> d_queues;
+      // The queued events indexed by their event types or nullptr for
+      // types that have never been queued.
 
-    sgdc::DynamicArray<PendingRemoval> d_pendingRemoval;
-      // List of listeners to remove during post-tick cycle.
+    DeliveryPhase d_phase;
+      // When queued events are delivered.
 
-    EventHandle d_nextHandle;
+    sgdm::FrameArena d_arenas[2];
+      // Where queued events are made, one for the events waiting to be
+      // delivered and one for those being delivered.
+
+    unsigned int d_arena;
+      // The arena that newly queued events are made in.
+
+    EventStats* d_stats;
+      // Records the events and listener times or nullptr.
 
     // HELPER FUNCTIONS
-    int findListener( const std::string& item, EventHandle handle );
-      // Gets the index of the listener with the specified handle.
+    template<typename T>
+    EventBatch<T>* batch( EventTypeId type );
+      // Gets the batch of the type, creating it if needed.
+
+    void copyQueues( const sgdc::DynamicArray<IEventBatch*>& queues );
+      // Replaces the queues with copies of the others.
 
-    int findListener( const sgdc::DynamicArray<RegisteredListener>& listeners,
-                      EventHandle handle, unsigned int start,
-                      unsigned int end );
-      // Find the listener with the given handle using a binary search.
-      // A binary search can be used because items are always inserted
-      // chronologically from when they are created so ID's are always in
-      // ascending order.
+    void deleteQueues();
+      // Deletes every queue.
+
+    void route( EventTypeId type );
+      // Makes sure that the type has a route.
 
   public:
     // CONSTRUCTORS
@@ -75,28 +129,112 @@ class EventDispatcher : public sgds::ITickable
     // OPERATORS
     EventDispatcher& operator=( const EventDispatcher& dispatcher );
 
+    // ACCESSOR FUNCTIONS
+    DeliveryPhase deliveryPhase() const;
+      // Gets when queued events are delivered.
+
+    unsigned int queued() const;
+      // Gets the number of events waiting to be delivered.
+
+    const sgdm::FrameArena& arena() const;
+      // Gets the arena that newly queued events are made in.
+
+    const ListenerRegistry& listeners() const;
+      // Gets the registered listeners.
+
+    EventStats* stats() const;
+      // Gets the stats that events are recorded in or nullptr.
+
     // MEMBER FUNCTIONS
     EventHandle add( const std::string& type,
                      const EventListener& listener );
       // Registers a listener to for the specified event type and
       // returns a handle that can be later used to unregister the
       // listener.
+      //
+      // If the type is a category the listener is also given the events
+      // of every type within it.
+
+    EventHandle add( EventTypeId type, const EventListener& listener );
+      // Registers a listener for the interned event type and returns a
+      // handle that can be later used to unregister the listener.
+
+    EventHandle addBatch( const std::string& type,
+                          const BatchListener& listener );
+      // Registers a listener that is given the events of the specified
+      // type in spans and returns a handle that can be used to unregister
+      // it with remove.
+
+    EventHandle addBatch( EventTypeId type, const BatchListener& listener );
+      // Registers a listener that is given the events of the interned type
+      // in spans and returns a handle that can be used to unregister it
+      // with remove.
 
     void remove( const std::string& type, EventHandle handle );
       // Stops broadcasting events to the specified listener for the
       // specified event type.
 
+    void remove( EventTypeId type, EventHandle handle );
+      // Stops broadcasting events to the specified listener for the
+      // interned event type.
+      //
+      // The handle alone identifies the listener so the type is only
+      // kept for callers that track both.
+
+    bool remove( EventHandle handle );
+      // Stops broadcasting events to the specified listener and returns
+      // false if the handle does not refer to one.
+
     void dispatch( const IEvent* event );
       // Dispatches an event to relevant registered listeners.
 
+    template<typename T>
+    void queue( const T& event );
+      // Queues a copy of the event to be delivered later.
+      //
+      // Every event queued with the same type must be a T.
+
+    template<typename T, typename... Args>
+    T& emit( Args&&... args );
+      // Constructs a T with the arguments in place and queues it to be
+      // delivered later.
+      //
+      // The event lives until its delivery has finished and every event
+      // queued with the same type must be a T.
+
+    void deliver();
+      // Delivers the events that were queued before the call.
+      //
+      // Each type's listeners are called in turn and each listener is
+      // given all of the type's events before the next one is called.
+      // Events that are queued during delivery wait for the next one.
+
+    void setDeliveryPhase( DeliveryPhase phase );
+      // Sets when queued events are delivered.
+
+    void setObserver( const EventListener& observer );
+      // Sets the callback that sees every dispatched event regardless of
+      // its type or an empty callback to stop observing.
+      //
+      // This is meant for tools such as recorders and is applied
+      // immediately.
+
+    void setStats( EventStats* stats );
+      // Sets the stats that events and listener times are recorded in or
+      // nullptr to stop recording.
+      //
+      // The stats are not owned and must outlive their use here.
+
     virtual void preTick();
-      // Does nothing.
+      // Delivers queued events if that is the delivery phase.
 
     virtual void tick( float dtS );
-      // Does nothing.
+      // Delivers queued events if that is the delivery phase.
 
     virtual void postTick();
-      // Performs additions and removals.
+      // Delivers queued events if that is the delivery phase and then
+      // performs additions and removals, then ends the frame of the
+      // stats if there are any.
 };
 
 // FREE OPERATORS
@@ -109,58 +247,184 @@ std::ostream& operator<<( std::ostream& stream,
 
 // CONSTRUCTORS
 inline
-EventDispatcher::EventDispatcher() : d_registered(), d_pendingAddition(),
-                                     d_pendingRemoval(), d_nextHandle( 0 )
+EventDispatcher::EventDispatcher() : d_listeners(), d_routes(),
+                                     d_observer(),
+                                     d_queues(),
+                                     d_phase( DELIVER_ON_POST_TICK ),
+                                     d_arenas(), d_arena( 0 ),
+                                     d_stats( nullptr )
 {
 }
 
 inline
 EventDispatcher::EventDispatcher( const EventDispatcher& other )
-    : d_registered( other.d_registered ),
-      d_pendingAddition( other.d_pendingAddition ),
-      d_pendingRemoval( other.d_pendingRemoval ),
-      d_nextHandle( other.d_nextHandle )
+    : d_listeners( other.d_listeners ), d_routes(),
+      d_observer( other.d_observer ), d_queues(), d_phase( other.d_phase ),
+      d_arenas(), d_arena( 0 ), d_stats( other.d_stats )
 {
+    d_routes.rebuild( d_listeners );
+    copyQueues( other.d_queues );
 }
 
 inline
 EventDispatcher::~EventDispatcher()
 {
+    deleteQueues();
 }
 
 // OPERATORS
 inline
 EventDispatcher& EventDispatcher::operator=( const EventDispatcher& other )
 {
-    d_registered = other.d_registered;
-    d_pendingAddition = other.d_pendingAddition;
-    d_pendingRemoval = other.d_pendingRemoval;
-    d_nextHandle = other.d_nextHandle;
+    d_listeners = other.d_listeners;
+    d_routes.rebuild( d_listeners );
+    d_observer = other.d_observer;
+    d_phase = other.d_phase;
+    d_stats = other.d_stats;
+
+    if ( &other != this )
+    {
+        copyQueues( other.d_queues );
+    }
 
     return *this;
 }
 
+// ACCESSOR FUNCTIONS
+inline
+EventDispatcher::DeliveryPhase EventDispatcher::deliveryPhase() const
+{
+    return d_phase;
+}
+
+inline
+const sgdm::FrameArena& EventDispatcher::arena() const
+{
+    return d_arenas[d_arena];
+}
+
+inline
+const ListenerRegistry& EventDispatcher::listeners() const
+{
+    return d_listeners;
+}
+
+inline
+EventStats* EventDispatcher::stats() const
+{
+    return d_stats;
+}
+
 // MEMBER FUNCTIONS
 inline
 EventHandle EventDispatcher::add( const std::string& type,
                                   const EventListener& listener )
 {
-    EventHandle handle = d_nextHandle++;
+    return add( EventTypes::inst().intern( type ), listener );
+}
 
-    RegisteredListener registered;
-    registered.listener = std::move( listener );
-    registered.handle = handle;
+inline
+EventHandle EventDispatcher::add( EventTypeId type,
+                                  const EventListener& listener )
+{
+    return d_listeners.add( type, listener );
+}
 
-    d_pendingAddition.push( std::make_pair( type, std::move( registered ) ) );
+inline
+EventHandle EventDispatcher::addBatch( const std::string& type,
+                                       const BatchListener& listener )
+{
+    return addBatch( EventTypes::inst().intern( type ), listener );
+}
 
-    return handle;
+inline
+EventHandle EventDispatcher::addBatch( EventTypeId type,
+                                       const BatchListener& listener )
+{
+    return d_listeners.addBatch( type, listener );
 }
 
 inline
 void EventDispatcher::remove( const std::string& type,
                               EventHandle handle )
 {
-    d_pendingRemoval.push( std::make_pair( type, handle ) );
+    remove( EventTypes::inst().intern( type ), handle );
+}
+
+inline
+void EventDispatcher::remove( EventTypeId type, EventHandle handle )
+{
+    remove( handle );
+}
+
+inline
+bool EventDispatcher::remove( EventHandle handle )
+{
+    return d_listeners.remove( handle );
+}
+
+template<typename T>
+inline
+void EventDispatcher::queue( const T& event )
+{
+    emit<T>( event );
+}
+
+template<typename T, typename... Args>
+inline
+T& EventDispatcher::emit( Args&&... args )
+{
+    T* event = d_arenas[d_arena].create<T>( std::forward<Args>( args )... );
+
+    batch<T>( event->typeId() )->push( event );
+
+    return *event;
+}
+
+inline
+void EventDispatcher::setDeliveryPhase( DeliveryPhase phase )
+{
+    d_phase = phase;
+}
+
+inline
+void EventDispatcher::setObserver( const EventListener& observer )
+{
+    d_observer = observer;
+}
+
+inline
+void EventDispatcher::setStats( EventStats* stats )
+{
+    d_stats = stats;
+}
+
+// HELPER FUNCTIONS
+inline
+void EventDispatcher::route( EventTypeId type )
+{
+    // types interned since the last rebuild are appended
+    if ( type >= d_routes.size() )
+    {
+        d_routes.extend( d_listeners );
+    }
+}
+
+template<typename T>
+inline
+EventBatch<T>* EventDispatcher::batch( EventTypeId type )
+{
+    while ( d_queues.size() <= type )
+    {
+        d_queues.push( nullptr );
+    }
+
+    if ( d_queues[type] == nullptr )
+    {
+        d_queues[type] = new EventBatch<T>();
+    }
+
+    return static_cast<EventBatch<T>*>( d_queues[type] );
 }
 
 } // End nspc sgde
@@ -0,0 +1,155 @@
+// event_queue.cpp
+#include "event_queue.h"
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+// CONSTANTS
+const unsigned int EventQueue::DEFAULT_CAPACITY;
+
+// CONSTRUCTORS
+EventQueue::EventQueue( EventDispatcher* dispatcher, unsigned int capacity )
+    : d_cells( nullptr ), d_capacity( capacity ), d_tail( 0 ), d_head( 0 ),
+      d_dispatcher( dispatcher ), d_posted( 0 ), d_rejected( 0 ),
+      d_drained( 0 ), d_highWater( 0 )
+{
+    assert( dispatcher != nullptr );
+    assert( capacity > 0 && ( capacity & ( capacity - 1 ) ) == 0 );
+
+    unsigned int i;
+
+    d_cells = new Cell[d_capacity];
+    for ( i = 0; i < d_capacity; ++i )
+    {
+        d_cells[i].sequence.store( i, std::memory_order_relaxed );
+        d_cells[i].event = nullptr;
+    }
+}
+
+EventQueue::~EventQueue()
+{
+    Cell* cell;
+
+    // nothing may post once the queue is being destroyed
+    for ( ; ; ++d_head )
+    {
+        cell = &d_cells[d_head & ( d_capacity - 1 )];
+        if ( cell->sequence.load( std::memory_order_acquire ) != d_head + 1 )
+        {
+            break;
+        }
+
+        delete cell->event;
+    }
+
+    delete[] d_cells;
+}
+
+// MEMBER FUNCTIONS
+bool EventQueue::post( IEvent* event )
+{
+    assert( event != nullptr );
+
+    unsigned long long position = d_tail.load( std::memory_order_relaxed );
+    unsigned long long sequence;
+    long long difference;
+    Cell* cell;
+
+    for ( ; ; )
+    {
+        cell = &d_cells[position & ( d_capacity - 1 )];
+        sequence = cell->sequence.load( std::memory_order_acquire );
+        difference = static_cast<long long>( sequence - position );
+
+        if ( difference == 0 )
+        {
+            // the cell is free so try to claim the position
+            if ( d_tail.compare_exchange_weak( position, position + 1,
+                                               std::memory_order_relaxed ) )
+            {
+                break;
+            }
+        }
+        else if ( difference < 0 )
+        {
+            // the cell still holds an event from a lap ago
+            d_rejected.fetch_add( 1, std::memory_order_relaxed );
+            return false;
+        }
+        else
+        {
+            position = d_tail.load( std::memory_order_relaxed );
+        }
+    }
+
+    cell->event = event;
+    cell->sequence.store( position + 1, std::memory_order_release );
+    d_posted.fetch_add( 1, std::memory_order_relaxed );
+
+    return true;
+}
+
+unsigned int EventQueue::drain()
+{
+    unsigned int count = 0;
+    IEvent* event;
+    Cell* cell;
+
+    // events posted while draining wait for the next drain so that a
+    // steady stream cannot keep the main thread here
+    unsigned long long end = d_tail.load( std::memory_order_acquire );
+
+    while ( d_head < end )
+    {
+        cell = &d_cells[d_head & ( d_capacity - 1 )];
+
+        // a producer claimed the cell but has not finished writing it
+        if ( cell->sequence.load( std::memory_order_acquire ) != d_head + 1 )
+        {
+            break;
+        }
+
+        event = cell->event;
+        cell->event = nullptr;
+        cell->sequence.store( d_head + d_capacity,
+                              std::memory_order_release );
+        ++d_head;
+
+        d_dispatcher->dispatch( event );
+        delete event;
+        ++count;
+    }
+
+    d_drained += count;
+    d_highWater = count > d_highWater ? count : d_highWater;
+
+    return count;
+}
+
+void EventQueue::resetStats()
+{
+    d_posted.store( 0, std::memory_order_relaxed );
+    d_rejected.store( 0, std::memory_order_relaxed );
+    d_drained = 0;
+    d_highWater = 0;
+}
+
+void EventQueue::preTick()
+{
+    drain();
+}
+
+void EventQueue::tick( float dtS )
+{
+}
+
+void EventQueue::postTick()
+{
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
@@ -0,0 +1,236 @@
+// event_queue.h
+//
+// A bounded lock-free queue that lets any thread publish events to a
+// dispatcher that is only used by the main thread. Producers claim a slot
+// with a single compare and swap and never wait on each other or on the
+// main thread, which drains the queue and dispatches what it finds during
+// pre-tick. This is the multi-producer form of Dmitry Vyukov's bounded
+// queue, with only one consumer.
+//
+// Posting to a full queue fails instead of blocking so producers can
+// decide to retry, coalesce or drop. The queue counts posts, rejections
+// and the deepest it got between drains so that its capacity can be
+// tuned.
+#ifndef INCLUDED_EVENT_QUEUE
+#define INCLUDED_EVENT_QUEUE
+
+#include "../scene/itickable.h"
+#include <assert.h>
+#include <atomic>
+#include "event_dispatcher.h"
+#include "ievent.h"
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+class EventQueue : public sgds::ITickable
+{
+  public:
+    // CONSTANTS
+    static const unsigned int DEFAULT_CAPACITY = 1024;
+      // The default maximum number of waiting events.
+
+  private:
+    struct Cell
+    {
+        std::atomic<unsigned long long> sequence;
+          // The position that may next write the cell when it equals the
+          // position, or read it when it is one past the position.
+
+        IEvent* event;
+          // The posted event.
+    };
+
+    // MEMBERS
+    Cell* d_cells;
+      // The circular buffer of posted events.
+
+    unsigned int d_capacity;
+      // The number of cells which is a power of two.
+
+    std::atomic<unsigned long long> d_tail;
+      // The position of the next post.
+
+    unsigned long long d_head;
+      // The position of the next event to drain.
+
+    EventDispatcher* d_dispatcher;
+      // Where drained events are dispatched.
+
+    std::atomic<unsigned long long> d_posted;
+      // The number of events that were posted.
+
+    std::atomic<unsigned long long> d_rejected;
+      // The number of posts that failed because the queue was full.
+
+    unsigned long long d_drained;
+      // The number of events that were dispatched.
+
+    unsigned int d_highWater;
+      // The most events that were drained at once.
+
+    // CONSTRUCTORS
+    EventQueue( const EventQueue& queue );
+      // Constructs a copy of the given queue.
+      //
+      // Its atomic cells cannot be copied so this is disabled.
+
+    // OPERATORS
+    EventQueue& operator=( const EventQueue& queue );
+      // Makes this a copy of the given queue.
+      //
+      // Its atomic cells cannot be copied so this is disabled.
+
+  public:
+    // CONSTRUCTORS
+    EventQueue( EventDispatcher* dispatcher,
+                unsigned int capacity = DEFAULT_CAPACITY );
+      // Constructs a new empty queue in front of the dispatcher.
+      //
+      // Requirements:
+      // capacity is a power of two
+
+    virtual ~EventQueue();
+      // Destructs the queue and every event that was not drained.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int capacity() const;
+      // Gets the maximum number of waiting events.
+
+    unsigned int size() const;
+      // Gets the number of waiting events.
+      //
+      // This is only a snapshot while other threads are posting.
+
+    unsigned long long posted() const;
+      // Gets the number of events that were posted.
+
+    unsigned long long rejected() const;
+      // Gets the number of posts that failed because the queue was full.
+
+    unsigned long long drained() const;
+      // Gets the number of events that were dispatched.
+
+    unsigned int highWater() const;
+      // Gets the most events that were drained at once.
+
+    EventDispatcher* dispatcher() const;
+      // Gets the dispatcher that drained events are dispatched to.
+
+    // MEMBER FUNCTIONS
+    bool post( IEvent* event );
+      // Posts an event that was created with new and returns false if the
+      // queue is full.
+      //
+      // The queue deletes the event once it is dispatched. If the post
+      // fails the caller still owns it. This is safe to call from any
+      // thread.
+
+    template<typename T>
+    bool postCopy( const T& event );
+      // Posts a copy of the event and returns false if the queue is full.
+      //
+      // This is safe to call from any thread.
+
+    unsigned int drain();
+      // Dispatches and deletes every event that has been posted and
+      // returns how many there were.
+      //
+      // Only the thread that uses the dispatcher may drain.
+
+    void resetStats();
+      // Clears the counts of posted, rejected and drained events.
+      //
+      // Only the thread that uses the dispatcher may reset.
+
+    virtual void preTick();
+      // Drains the queue.
+
+    virtual void tick( float dtS );
+      // Does nothing.
+
+    virtual void postTick();
+      // Does nothing.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const EventQueue& queue )
+{
+    return stream << "{ \"size\": " << queue.size()
+                  << ", \"capacity\": " << queue.capacity()
+                  << ", \"posted\": " << queue.posted()
+                  << ", \"rejected\": " << queue.rejected()
+                  << ", \"drained\": " << queue.drained()
+                  << ", \"highWater\": " << queue.highWater() << " }";
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int EventQueue::capacity() const
+{
+    return d_capacity;
+}
+
+inline
+unsigned int EventQueue::size() const
+{
+    unsigned long long tail = d_tail.load( std::memory_order_relaxed );
+
+    return tail > d_head ? static_cast<unsigned int>( tail - d_head ) : 0;
+}
+
+inline
+unsigned long long EventQueue::posted() const
+{
+    return d_posted.load( std::memory_order_relaxed );
+}
+
+inline
+unsigned long long EventQueue::rejected() const
+{
+    return d_rejected.load( std::memory_order_relaxed );
+}
+
+inline
+unsigned long long EventQueue::drained() const
+{
+    return d_drained;
+}
+
+inline
+unsigned int EventQueue::highWater() const
+{
+    return d_highWater;
+}
+
+inline
+EventDispatcher* EventQueue::dispatcher() const
+{
+    return d_dispatcher;
+}
+
+// MEMBER FUNCTIONS
+template<typename T>
+inline
+bool EventQueue::postCopy( const T& event )
+{
+    T* copy = new T( event );
+
+    if ( !post( copy ) )
+    {
+        delete copy;
+        return false;
+    }
+
+    return true;
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,15 @@
+// event_scope.cpp
+#include "event_scope.h"
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+// GLOBALS
+thread_local EventScope* EventScope::d_current = nullptr;
+
+} // End nspc sgde
+
+} // End nspc StevensDev
@@ -0,0 +1,130 @@
+// event_scope.h
+//
+// Gives the calling thread its own event bus for as long as the scope
+// lives. A scope is opened on a queue and while it is open EventBus::queue
+// returns that queue and EventBus::dispatcher the dispatcher it drains to
+// instead of the process-wide ones, so a scene, a world or a worker thread
+// can keep its listeners and queued events apart from every other
+// simulation in the process:
+//
+//     EventDispatcher events;
+//     EventQueue queue( &events );
+//
+//     {
+//         EventScope scope( &queue );
+//
+//         match.run();  // everything it adds or raises stays in events
+//     }
+//
+// Scopes nest and must be closed in the reverse order they were opened.
+// A scope only affects the thread that opened it, so threads that post to
+// a scoped queue must be handed the queue itself.
+#ifndef INCLUDED_EVENT_SCOPE
+#define INCLUDED_EVENT_SCOPE
+
+#include <assert.h>
+#include "event_dispatcher.h"
+#include "event_queue.h"
+#include <iostream>
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+class EventScope
+{
+  private:
+    // GLOBALS
+    static thread_local EventScope* d_current;
+      // The innermost open scope of the calling thread or nullptr.
+
+    // MEMBERS
+    EventQueue* d_queue;
+      // The queue of the scope.
+
+    EventScope* d_previous;
+      // The scope that this one hides or nullptr.
+
+    // CONSTRUCTORS
+    EventScope( const EventScope& scope );
+      // Scopes cannot be copied.
+
+    // OPERATORS
+    EventScope& operator=( const EventScope& scope );
+      // Scopes cannot be copied.
+
+  public:
+    // CONSTRUCTORS
+    EventScope( EventQueue* queue );
+      // Opens a scope on the calling thread that makes the queue and the
+      // dispatcher it drains to its event bus.
+
+    ~EventScope();
+      // Closes the scope, which must be the innermost one of the thread.
+
+    // ACCESSOR FUNCTIONS
+    EventDispatcher* dispatcher() const;
+      // Gets the dispatcher of the scope.
+
+    EventQueue* queue() const;
+      // Gets the queue of the scope.
+
+    // GLOBAL FUNCTIONS
+    static EventScope* current();
+      // Gets the innermost open scope of the calling thread or nullptr.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const EventScope& scope )
+{
+    return stream << "{ \"isCurrent\": "
+                  << ( EventScope::current() == &scope ? "true" : "false" )
+                  << " }";
+}
+
+// CONSTRUCTORS
+inline
+EventScope::EventScope( EventQueue* queue )
+    : d_queue( queue ), d_previous( d_current )
+{
+    assert( queue != nullptr );
+
+    d_current = this;
+}
+
+inline
+EventScope::~EventScope()
+{
+    assert( d_current == this );
+
+    d_current = d_previous;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+EventDispatcher* EventScope::dispatcher() const
+{
+    return d_queue->dispatcher();
+}
+
+inline
+EventQueue* EventScope::queue() const
+{
+    return d_queue;
+}
+
+// GLOBAL FUNCTIONS
+inline
+EventScope* EventScope::current()
+{
+    return d_current;
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,2 @@
+// event_span.cpp
+#include "event_span.h"
@@ -0,0 +1,153 @@
+// event_span.h
+//
+// A view of the events of one type that a batch listener is given. Queued
+// events arrive together in one span per delivery while events that are
+// dispatched immediately arrive in spans of one.
+#ifndef INCLUDED_EVENT_SPAN
+#define INCLUDED_EVENT_SPAN
+
+#include <assert.h>
+#include "event_batch.h"
+#include "event_types.h"
+#include "ievent.h"
+#include "ievent_batch.h"
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+class EventSpan
+{
+  private:
+    // MEMBERS
+    EventTypeId d_type;
+      // The type of every event in the span.
+
+    const IEventBatch* d_batch;
+      // The batch being delivered or nullptr for a single event.
+
+    const IEvent* d_event;
+      // The single event or nullptr for a batch.
+
+  public:
+    // CONSTRUCTORS
+    EventSpan( EventTypeId type, const IEventBatch* batch );
+      // Constructs a span of the events being delivered from the batch.
+
+    EventSpan( EventTypeId type, const IEvent* event );
+      // Constructs a span of the single event.
+
+    EventSpan( const EventSpan& span );
+      // Constructs a copy of the span.
+
+    ~EventSpan();
+      // Destructs the span.
+
+    // OPERATORS
+    EventSpan& operator=( const EventSpan& span );
+      // Makes this a copy of the span.
+
+    const IEvent& operator[]( unsigned int index ) const;
+      // Gets an event in the span.
+
+    // ACCESSOR FUNCTIONS
+    EventTypeId type() const;
+      // Gets the type of every event in the span.
+
+    unsigned int size() const;
+      // Gets the number of events in the span.
+
+    template<typename T>
+    const T& get( unsigned int index ) const;
+      // Gets an event in the span as its concrete type without a virtual
+      // call.
+      //
+      // Requirements:
+      // every event of the span's type was queued as a T
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const EventSpan& span )
+{
+    return stream << "{ \"type\": " << span.type()
+                  << ", \"size\": " << span.size() << " }";
+}
+
+// CONSTRUCTORS
+inline
+EventSpan::EventSpan( EventTypeId type, const IEventBatch* batch )
+    : d_type( type ), d_batch( batch ), d_event( nullptr )
+{
+    assert( batch != nullptr );
+}
+
+inline
+EventSpan::EventSpan( EventTypeId type, const IEvent* event )
+    : d_type( type ), d_batch( nullptr ), d_event( event )
+{
+    assert( event != nullptr );
+}
+
+inline
+EventSpan::EventSpan( const EventSpan& span )
+    : d_type( span.d_type ), d_batch( span.d_batch ),
+      d_event( span.d_event )
+{
+}
+
+inline
+EventSpan::~EventSpan()
+{
+}
+
+// OPERATORS
+inline
+EventSpan& EventSpan::operator=( const EventSpan& span )
+{
+    d_type = span.d_type;
+    d_batch = span.d_batch;
+    d_event = span.d_event;
+
+    return *this;
+}
+
+inline
+const IEvent& EventSpan::operator[]( unsigned int index ) const
+{
+    assert( index < size() );
+
+    return d_batch != nullptr ? ( *d_batch )[index] : *d_event;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+EventTypeId EventSpan::type() const
+{
+    return d_type;
+}
+
+inline
+unsigned int EventSpan::size() const
+{
+    return d_batch != nullptr ? d_batch->size() : 1;
+}
+
+template<typename T>
+inline
+const T& EventSpan::get( unsigned int index ) const
+{
+    assert( index < size() );
+
+    return d_batch != nullptr ?
+           static_cast<const EventBatch<T>*>( d_batch )->at( index ) :
+           static_cast<const T&>( *d_event );
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,47 @@
+// event_stats.cpp
+#include "event_stats.h"
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+// MEMBER FUNCTIONS
+void EventStats::endFrame()
+{
+    EventTypeId type;
+
+    for ( type = 0; type < d_types.size(); ++type )
+    {
+        EventTypeStats& typeStats = d_types[type];
+
+        if ( ( d_rateThreshold > 0 &&
+               typeStats.frameCount > d_rateThreshold ) ||
+             ( d_timeThreshold > 0 &&
+               typeStats.frameTime > d_timeThreshold ) )
+        {
+            ++typeStats.storms;
+
+            if ( d_stormListener )
+            {
+                d_stormListener( type, typeStats );
+            }
+        }
+
+        typeStats.frameCount = 0;
+        typeStats.frameTime = 0;
+    }
+
+    ++d_frames;
+}
+
+void EventStats::reset()
+{
+    d_types.clear();
+    d_frames = 0;
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
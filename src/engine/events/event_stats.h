@@ -0,0 +1,299 @@
+// event_stats.h
+//
+// Records how much work the events of each type cause. A dispatcher that
+// is given stats counts the events of every type it dispatches or
+// delivers and times each listener call, remembering the handle of the
+// slowest listener so that a spike can be traced back to it:
+//
+//     EventStats stats;
+//
+//     stats.setRateThreshold( 500 );
+//     stats.setTimeThreshold( 2 * sgdk::TimeUnits::NANOS_PER_MILLI );
+//     stats.setStormListener( onStorm );
+//     EventBus::dispatcher().setStats( &stats );
+//
+// Counts are kept per frame and in total. When a frame ends, every type
+// that raised more events or spent more time in its listeners than the
+// thresholds allow is reported to the storm listener. Timing costs two
+// clock reads per listener call, so dispatchers only record stats when
+// they are given some.
+#ifndef INCLUDED_EVENT_STATS
+#define INCLUDED_EVENT_STATS
+
+#include "../containers/dynamic_array.h"
+#include <assert.h>
+#include "delegate.h"
+#include "event_types.h"
+#include <iostream>
+#include "listener_registry.h"
+#include "../time/time_units.h"
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+struct EventTypeStats
+{
+    unsigned int frameCount;
+      // The number of events in the current frame.
+
+    sgdk::Duration frameTime;
+      // The time spent in listeners in the current frame.
+
+    unsigned long long count;
+      // The number of events in every frame.
+
+    sgdk::Duration time;
+      // The time spent in listeners in every frame.
+
+    sgdk::Duration slowest;
+      // The longest a single listener call took.
+
+    EventHandle slowestHandle;
+      // The listener whose call took the longest or the invalid handle.
+
+    unsigned int storms;
+      // The number of frames that went over a threshold.
+};
+
+typedef Delegate<void( EventTypeId, const EventTypeStats& )> StormListener;
+  // Defines a callback that is told about a type that went over a
+  // threshold along with its stats for the frame.
+
+class EventStats
+{
+  private:
+    // MEMBERS
+    sgdc::DynamicArray<EventTypeStats> d_types;
+      // The stats of each type by their identifiers.
+
+    unsigned long long d_frames;
+      // The number of frames that have ended.
+
+    unsigned int d_rateThreshold;
+      // The most events of a type per frame or zero for no limit.
+
+    sgdk::Duration d_timeThreshold;
+      // The most listener time of a type per frame or zero for no limit.
+
+    StormListener d_stormListener;
+      // Told about types that go over a threshold or empty.
+
+    // HELPER FUNCTIONS
+    EventTypeStats& stats( EventTypeId type );
+      // Gets the stats of the type, adding empty stats if needed.
+
+    // CONSTRUCTORS
+    EventStats( const EventStats& stats );
+      // Stats are shared by pointer and cannot be copied.
+
+    // OPERATORS
+    EventStats& operator=( const EventStats& stats );
+      // Stats are shared by pointer and cannot be copied.
+
+  public:
+    // CONSTRUCTORS
+    EventStats();
+      // Constructs new empty stats without any thresholds.
+
+    ~EventStats();
+      // Destructs the stats.
+
+    // OPERATORS
+    const EventTypeStats& operator[]( EventTypeId type ) const;
+      // Gets the stats of the type.
+      //
+      // Requirements:
+      // type is less than size
+
+    // ACCESSOR FUNCTIONS
+    unsigned int size() const;
+      // Gets one more than the largest type that has stats.
+
+    unsigned long long frames() const;
+      // Gets the number of frames that have ended.
+
+    unsigned int rateThreshold() const;
+      // Gets the most events of a type per frame or zero for no limit.
+
+    sgdk::Duration timeThreshold() const;
+      // Gets the most listener time of a type per frame or zero for no
+      // limit.
+
+    // MEMBER FUNCTIONS
+    void countEvents( EventTypeId type, unsigned int events );
+      // Records that the events of the type are being given to its
+      // listeners.
+
+    void timeListener( EventTypeId type, EventHandle handle,
+                       sgdk::Duration time );
+      // Records that the listener with the handle took the time to handle
+      // events of the type.
+
+    void endFrame();
+      // Reports the types that went over a threshold this frame and then
+      // starts counting the next one.
+
+    void reset();
+      // Forgets every recorded event but keeps the thresholds.
+
+    void setRateThreshold( unsigned int events );
+      // Sets the most events of a type per frame or zero for no limit.
+
+    void setTimeThreshold( sgdk::Duration time );
+      // Sets the most listener time of a type per frame or zero for no
+      // limit.
+
+    void setStormListener( const StormListener& listener );
+      // Sets the callback told about types that go over a threshold or an
+      // empty callback to stop telling.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const EventTypeStats& stats )
+{
+    return stream << "{ \"count\": " << stats.count
+                  << ", \"time\": " << stats.time
+                  << ", \"slowest\": " << stats.slowest
+                  << ", \"slowestHandle\": " << stats.slowestHandle
+                  << ", \"storms\": " << stats.storms << " }";
+}
+
+inline
+std::ostream& operator<<( std::ostream& stream, const EventStats& stats )
+{
+    unsigned int printed = 0;
+    unsigned int i;
+
+    stream << "{ \"frames\": " << stats.frames() << ", \"types\": {";
+
+    // only the types that had events, by name
+    for ( i = 0; i < stats.size(); ++i )
+    {
+        if ( stats[i].count > 0 )
+        {
+            stream << ( printed++ > 0 ? ", \"" : " \"" )
+                   << EventTypes::inst().name( i ) << "\": " << stats[i];
+        }
+    }
+
+    return stream << ( printed > 0 ? " } }" : "} }" );
+}
+
+// CONSTRUCTORS
+inline
+EventStats::EventStats()
+    : d_types(), d_frames( 0 ), d_rateThreshold( 0 ), d_timeThreshold( 0 ),
+      d_stormListener()
+{
+}
+
+inline
+EventStats::~EventStats()
+{
+}
+
+// OPERATORS
+inline
+const EventTypeStats& EventStats::operator[]( EventTypeId type ) const
+{
+    assert( type < d_types.size() );
+
+    return d_types[type];
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int EventStats::size() const
+{
+    return d_types.size();
+}
+
+inline
+unsigned long long EventStats::frames() const
+{
+    return d_frames;
+}
+
+inline
+unsigned int EventStats::rateThreshold() const
+{
+    return d_rateThreshold;
+}
+
+inline
+sgdk::Duration EventStats::timeThreshold() const
+{
+    return d_timeThreshold;
+}
+
+// MEMBER FUNCTIONS
+inline
+void EventStats::countEvents( EventTypeId type, unsigned int events )
+{
+    EventTypeStats& typeStats = stats( type );
+
+    typeStats.frameCount += events;
+    typeStats.count += events;
+}
+
+inline
+void EventStats::timeListener( EventTypeId type, EventHandle handle,
+                               sgdk::Duration time )
+{
+    EventTypeStats& typeStats = stats( type );
+
+    typeStats.frameTime += time;
+    typeStats.time += time;
+
+    if ( time > typeStats.slowest ||
+         typeStats.slowestHandle == ListenerRegistry::INVALID_HANDLE )
+    {
+        typeStats.slowest = time;
+        typeStats.slowestHandle = handle;
+    }
+}
+
+inline
+void EventStats::setRateThreshold( unsigned int events )
+{
+    d_rateThreshold = events;
+}
+
+inline
+void EventStats::setTimeThreshold( sgdk::Duration time )
+{
+    assert( time >= 0 );
+
+    d_timeThreshold = time;
+}
+
+inline
+void EventStats::setStormListener( const StormListener& listener )
+{
+    d_stormListener = listener;
+}
+
+// HELPER FUNCTIONS
+inline
+EventTypeStats& EventStats::stats( EventTypeId type )
+{
+    EventTypeStats empty = { 0, 0, 0, 0, 0,
+                             ListenerRegistry::INVALID_HANDLE, 0 };
+
+    while ( d_types.size() <= type )
+    {
+        d_types.push( empty );
+    }
+
+    return d_types[type];
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
+
+#endif
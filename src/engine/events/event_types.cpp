@@ -0,0 +1,94 @@
+// event_types.cpp
+#include "event_types.h"
+#include <assert.h>
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+// CONSTANTS
+const EventTypeId EventTypes::NO_TYPE;
+const char EventTypes::SEPARATOR;
+
+// GLOBALS
+EventTypes EventTypes::d_instance = EventTypes();
+
+// ACCESSOR FUNCTIONS
+unsigned int EventTypes::size()
+{
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    return d_names.size();
+}
+
+std::string EventTypes::name( EventTypeId id )
+{
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    assert( id < d_names.size() );
+
+    return d_names[id];
+}
+
+EventTypeId EventTypes::parent( EventTypeId id )
+{
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    assert( id < d_parents.size() );
+
+    return d_parents[id];
+}
+
+bool EventTypes::isWithin( EventTypeId id, EventTypeId category )
+{
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    assert( id < d_parents.size() );
+
+    while ( id != NO_TYPE && id != category )
+    {
+        id = d_parents[id];
+    }
+
+    return id != NO_TYPE;
+}
+
+// MEMBER FUNCTIONS
+EventTypeId EventTypes::intern( const std::string& name )
+{
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    return internLocked( name );
+}
+
+// HELPER FUNCTIONS
+EventTypeId EventTypes::internLocked( const std::string& name )
+{
+    if ( d_ids.has( name ) )
+    {
+        return d_ids[name];
+    }
+
+    std::string::size_type separator = name.rfind( SEPARATOR );
+    EventTypeId parent = NO_TYPE;
+    EventTypeId id;
+
+    // categories are interned first so they always have lower identifiers
+    if ( separator != std::string::npos && separator > 0 )
+    {
+        parent = internLocked( name.substr( 0, separator ) );
+    }
+
+    id = d_names.size();
+    d_ids[name] = id;
+    d_names.push( name );
+    d_parents.push( parent );
+
+    return id;
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
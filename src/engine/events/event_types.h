@@ -0,0 +1,144 @@
+// event_types.h
+//
+// Interns event type names into small dense identifiers so that the
+// dispatcher can find the listeners of an event by indexing an array
+// instead of hashing and comparing its name.
+//
+// Interning takes a lock and hashes the name so it should happen once per
+// type, typically by caching the identifier in a function-local static:
+//
+//     EventTypeId CollisionEvent::typeId() const
+//     {
+//         static const EventTypeId ID =
+//             EventTypes::inst().intern( "collision" );
+//
+//         return ID;
+//     }
+//
+// Identifiers are never reused and are not stable between runs, so only
+// names should be saved.
+//
+// Names form a hierarchy of categories separated by dots. Interning
+// "collision.player" also interns its category "collision", and listeners
+// of a category are given the events of every type within it.
+#ifndef INCLUDED_EVENT_TYPES
+#define INCLUDED_EVENT_TYPES
+
+#include "../containers/dynamic_array.h"
+#include "../containers/map.h"
+#include <mutex>
+#include <string>
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+typedef unsigned int EventTypeId;
+  // Identifies an interned event type.
+
+class EventTypes
+{
+  public:
+    // CONSTANTS
+    static const EventTypeId NO_TYPE = 0xffffffffu;
+      // An identifier that never refers to a type.
+
+    static const char SEPARATOR = '.';
+      // Separates a category from the types within it.
+
+  private:
+    // GLOBALS
+    static EventTypes d_instance;
+      // The singleton instance.
+
+    // MEMBERS
+    sgdc::Map<EventTypeId> d_ids;
+      // The identifier of each interned name.
+
+    sgdc::DynamicArray<std::string> d_names;
+      // The interned names by their identifiers.
+
+    sgdc::DynamicArray<EventTypeId> d_parents;
+      // The category of each type by their identifiers or NO_TYPE.
+
+    std::mutex d_mutex;
+      // Guards the identifiers and names.
+
+    // HELPER FUNCTIONS
+    EventTypeId internLocked( const std::string& name );
+      // Interns the type and its categories while the lock is held.
+
+    // CONSTRUCTORS
+    EventTypes();
+      // Constructs a new empty set of types.
+
+    EventTypes( const EventTypes& types );
+      // The types cannot be copied.
+
+    // OPERATORS
+    EventTypes& operator=( const EventTypes& types );
+      // The types cannot be copied.
+
+  public:
+    // CONSTRUCTORS
+    ~EventTypes();
+      // Destructs the types.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int size();
+      // Gets the number of interned types, which is one more than the
+      // largest identifier.
+
+    std::string name( EventTypeId id );
+      // Gets the name of the interned type.
+
+    EventTypeId parent( EventTypeId id );
+      // Gets the category that the type is within or NO_TYPE if it is not
+      // within one.
+
+    bool isWithin( EventTypeId id, EventTypeId category );
+      // Checks if the type is the category or is within it at any depth.
+
+    // MEMBER FUNCTIONS
+    EventTypeId intern( const std::string& name );
+      // Gets the identifier of the type, interning it if needed.
+      //
+      // This is safe to call from any thread.
+
+    // GLOBAL FUNCTIONS
+    static EventTypes& inst();
+      // Gets the event types.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, EventTypes& types )
+{
+    return stream << "{ \"size\": " << types.size() << " }";
+}
+
+// CONSTRUCTORS
+inline
+EventTypes::EventTypes() : d_ids(), d_names(), d_parents(), d_mutex()
+{
+}
+
+inline
+EventTypes::~EventTypes()
+{
+}
+
+// GLOBAL FUNCTIONS
+inline
+EventTypes& EventTypes::inst()
+{
+    return d_instance;
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
+
+#endif
@@ -2,6 +2,7 @@
 #ifndef INCLUDED_IEVENT
 #define INCLUDED_IEVENT
 
+#include "event_types.h"
 #include <string>
 
 namespace StevensDev
@@ -20,6 +21,13 @@ class IEvent
     // ACCESSOR FUNCTIONS
     virtual const std::string& type() const = 0;
       // Gets the event type.
+
+    virtual EventTypeId typeId() const;
+      // Gets the interned event type.
+      //
+      // By default this interns the type on every call, which locks and
+      // hashes, so events should override it to return a cached
+      // identifier.
 };
 
 // CONSTRUCTORS
@@ -28,6 +36,13 @@ IEvent::~IEvent()
 {
 }
 
+// ACCESSOR FUNCTIONS
+inline
+EventTypeId IEvent::typeId() const
+{
+    return EventTypes::inst().intern( type() );
+}
+
 } // End nspc sgde
 
 } // End nspc StevensDev
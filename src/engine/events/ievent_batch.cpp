@@ -0,0 +1,2 @@
+// ievent_batch.cpp
+#include "ievent_batch.h"
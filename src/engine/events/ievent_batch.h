@@ -0,0 +1,53 @@
+// ievent_batch.h
+#ifndef INCLUDED_IEVENT_BATCH
+#define INCLUDED_IEVENT_BATCH
+
+#include "../memory/frame_arena.h"
+#include "ievent.h"
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+class IEventBatch
+{
+  public:
+    // CONSTRUCTORS
+    virtual ~IEventBatch() = 0;
+      // Destructs the batch.
+
+    // ACCESSOR FUNCTIONS
+    virtual unsigned int queued() const = 0;
+      // Gets the number of events waiting for the next flip.
+
+    virtual unsigned int size() const = 0;
+      // Gets the number of events being delivered.
+
+    virtual const IEvent& operator[]( unsigned int index ) const = 0;
+      // Gets an event being delivered.
+
+    // MEMBER FUNCTIONS
+    virtual void flip() = 0;
+      // Makes the waiting events the ones being delivered and starts
+      // waiting for new ones.
+
+    virtual void clear() = 0;
+      // Forgets the events being delivered.
+
+    virtual IEventBatch* clone( sgdm::FrameArena* arena ) const = 0;
+      // Creates a copy of the batch with copies of its events made in the
+      // arena that the caller must delete.
+};
+
+inline
+IEventBatch::~IEventBatch()
+{
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
+
+#endif
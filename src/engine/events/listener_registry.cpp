@@ -0,0 +1,167 @@
+// listener_registry.cpp
+#include "listener_registry.h"
+#include <utility>
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+// CONSTANTS
+const EventHandle ListenerRegistry::INVALID_HANDLE;
+const unsigned int ListenerRegistry::INDEX_BITS;
+const unsigned int ListenerRegistry::INDEX_MASK;
+
+// MEMBER FUNCTIONS
+bool ListenerRegistry::flush()
+{
+    bool isChanged = false;
+    unsigned int index;
+
+    // removals first so that a listener added and removed before the flush
+    // is never listed
+    while ( d_pendingRemoval.size() > 0 )
+    {
+        index = d_pendingRemoval.popFront();
+        Slot& slot = d_slots[index];
+
+        slot.listener.reset();
+        slot.batchListener.reset();
+
+        if ( !slot.isListed )
+        {
+            release( index );
+            continue;
+        }
+
+        RegisteredListener& registered = d_lists[slot.type][slot.position];
+
+        // the slot stays taken until compaction drops its tombstone
+        registered.listener.reset();
+        registered.batchListener.reset();
+        ++d_tombstones[slot.type];
+        --d_size;
+        isChanged = true;
+
+        if ( d_tombstones[slot.type] * 2 > d_lists[slot.type].size() )
+        {
+            compact( slot.type );
+        }
+    }
+
+    while ( d_pendingAddition.size() > 0 )
+    {
+        index = d_pendingAddition.popFront();
+        Slot& slot = d_slots[index];
+
+        if ( !slot.isLive || slot.isListed )
+        {
+            continue;
+        }
+
+        while ( d_lists.size() <= slot.type )
+        {
+            d_lists.push( sgdc::DynamicArray<RegisteredListener>() );
+            d_tombstones.push( 0 );
+        }
+
+        RegisteredListener registered;
+
+        registered.listener = std::move( slot.listener );
+        registered.batchListener = std::move( slot.batchListener );
+        registered.slot = index;
+
+        slot.position = d_lists[slot.type].size();
+        slot.isListed = true;
+        d_lists[slot.type].push( std::move( registered ) );
+        ++d_size;
+        isChanged = true;
+    }
+
+    return isChanged;
+}
+
+// HELPER FUNCTIONS
+EventHandle ListenerRegistry::reserve( EventTypeId type )
+{
+    unsigned int index;
+    Slot slot;
+
+    slot.type = type;
+    slot.position = 0;
+    slot.generation = 0;
+    slot.isLive = true;
+    slot.isListed = false;
+
+    if ( d_free.size() > 0 )
+    {
+        index = d_free.pop();
+        slot.generation = d_slots[index].generation;
+    }
+    else
+    {
+        assert( d_slots.size() <= INDEX_MASK );
+
+        index = d_slots.size();
+        d_slots.push( slot );
+    }
+
+    // the top generation is the invalid handle so wrap before reaching it
+    if ( ( ( slot.generation << INDEX_BITS ) | index ) == INVALID_HANDLE )
+    {
+        slot.generation = 0;
+    }
+
+    d_slots[index] = std::move( slot );
+    d_pendingAddition.push( index );
+
+    return ( d_slots[index].generation << INDEX_BITS ) | index;
+}
+
+void ListenerRegistry::release( unsigned int index )
+{
+    Slot& slot = d_slots[index];
+
+    slot.isListed = false;
+    slot.generation = ( slot.generation + 1 ) & ( ~0u >> INDEX_BITS );
+    d_free.push( index );
+}
+
+void ListenerRegistry::compact( EventTypeId type )
+{
+    sgdc::DynamicArray<RegisteredListener>& list = d_lists[type];
+    unsigned int kept = 0;
+    unsigned int i;
+
+    // listeners keep their order so dispatching is unchanged
+    for ( i = 0; i < list.size(); ++i )
+    {
+        RegisteredListener& registered = list[i];
+
+        if ( !registered.listener && !registered.batchListener )
+        {
+            release( registered.slot );
+            continue;
+        }
+
+        if ( i != kept )
+        {
+            list[kept] = std::move( registered );
+        }
+
+        d_slots[list[kept].slot].position = kept;
+        ++kept;
+    }
+
+    while ( list.size() > kept )
+    {
+        list.pop();
+    }
+
+    d_tombstones[type] = 0;
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
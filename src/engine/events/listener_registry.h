@@ -0,0 +1,344 @@
+// listener_registry.h
+//
+// Keeps the listeners of an event dispatcher in a list per event type.
+// Handles refer to slots that remember where each listener is listed, so
+// removing one is constant time and a handle that outlives its listener
+// is never mistaken for a later one.
+//
+// Like the tickable registry, additions and removals are queued and only
+// applied by flush so the lists never change while they are being
+// iterated. A removed listener leaves a tombstone behind that dispatching
+// skips, and a list is only compacted once more than half of it is
+// tombstones, which keeps listeners in the order they were added without
+// shifting the list on every removal.
+#ifndef INCLUDED_LISTENER_REGISTRY
+#define INCLUDED_LISTENER_REGISTRY
+
+#include "../containers/dynamic_array.h"
+#include <assert.h>
+#include "delegate.h"
+#include "event_span.h"
+#include "event_types.h"
+#include "ievent.h"
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+typedef unsigned int EventHandle;
+  // Identifies a registered listener. Handles of removed listeners are
+  // never mistaken for the handles of later ones.
+
+typedef Delegate<void( const IEvent* )> EventListener;
+  // Defines a listener callback.
+
+typedef Delegate<void( const EventSpan& )> BatchListener;
+  // Defines a listener callback that is given events of one type at once.
+
+struct RegisteredListener
+{
+    EventListener listener;
+      // Called with each event or empty.
+
+    BatchListener batchListener;
+      // Called instead of the listener if the listener is empty.
+
+    unsigned int slot;
+      // The slot of the listener's handle.
+};
+
+class ListenerRegistry
+{
+  public:
+    // CONSTANTS
+    static const EventHandle INVALID_HANDLE = 0xffffffffu;
+      // A handle that never refers to a listener.
+
+  private:
+    struct Slot
+    {
+        EventListener listener;
+          // The listener while it waits to be listed.
+
+        BatchListener batchListener;
+          // The batch listener while it waits to be listed.
+
+        EventTypeId type;
+          // The type of events it listens to.
+
+        unsigned int position;
+          // Where it is in the list of its type.
+
+        unsigned int generation;
+          // The number of times the slot has been freed.
+
+        bool isLive;
+          // If the listener has not been removed.
+
+        bool isListed;
+          // If the listener or its tombstone is in the list of its type.
+    };
+
+    // CONSTANTS
+    static const unsigned int INDEX_BITS = 20;
+      // The number of handle bits that hold the slot index.
+
+    static const unsigned int INDEX_MASK = ( 1u << INDEX_BITS ) - 1;
+      // Extracts the slot index from a handle.
+
+    // MEMBERS
+    sgdc::DynamicArray<Slot> d_slots;
+      // Every slot that has been used.
+
+    sgdc::DynamicArray<unsigned int> d_free;
+      // The slots that can be reused.
+
+    sgdc::DynamicArray<unsigned int> d_pendingAddition;
+      // The slots to list during the next flush.
+
+    sgdc::DynamicArray<unsigned int> d_pendingRemoval;
+      // The slots to unlist during the next flush.
+
+    sgdc::DynamicArray<sgdc::DynamicArray<RegisteredListener>> d_lists;
+      // The listeners and tombstones indexed by their event types.
+
+    sgdc::DynamicArray<unsigned int> d_tombstones;
+      // The number of tombstones in each list.
+
+    unsigned int d_size;
+      // The number of listed listeners that are not tombstones.
+
+    // HELPER FUNCTIONS
+    int findSlot( EventHandle handle ) const;
+      // Gets the slot of the live listener with the handle or -1.
+
+    EventHandle reserve( EventTypeId type );
+      // Takes a free slot for a listener of the type and queues it to be
+      // listed.
+
+    void release( unsigned int index );
+      // Frees the slot so that its handle is no longer valid.
+
+    void compact( EventTypeId type );
+      // Removes the tombstones from the list of the type.
+
+  public:
+    // CONSTRUCTORS
+    ListenerRegistry();
+      // Constructs a new empty registry.
+
+    ListenerRegistry( const ListenerRegistry& registry );
+      // Constructs a copy of the registry.
+
+    ~ListenerRegistry();
+      // Destructs the registry.
+
+    // OPERATORS
+    ListenerRegistry& operator=( const ListenerRegistry& registry );
+      // Makes this a copy of the registry.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int types() const;
+      // Gets the number of event types that have a list.
+
+    const sgdc::DynamicArray<RegisteredListener>& listeners(
+        EventTypeId type ) const;
+      // Gets the listeners of the type as of the last flush, where both
+      // callbacks of a tombstone are empty.
+      //
+      // Requirements:
+      // type is less than types
+
+    unsigned int size() const;
+      // Gets the number of listeners as of the last flush.
+
+    unsigned int pending() const;
+      // Gets the number of additions and removals waiting for a flush.
+
+    bool contains( EventHandle handle ) const;
+      // Checks if the handle refers to a listener that was not removed.
+
+    EventHandle handle( unsigned int slot ) const;
+      // Gets the handle of the listener in the slot.
+      //
+      // Requirements:
+      // slot is the slot of a listed listener
+
+    // MEMBER FUNCTIONS
+    EventHandle add( EventTypeId type, const EventListener& listener );
+      // Queues the listener to be added for the type and returns its
+      // handle.
+
+    EventHandle addBatch( EventTypeId type, const BatchListener& listener );
+      // Queues the batch listener to be added for the type and returns its
+      // handle.
+
+    bool remove( EventHandle handle );
+      // Queues the listener to be removed and returns false if the handle
+      // does not refer to one.
+
+    bool flush();
+      // Applies the queued additions and removals and returns if any list
+      // changed.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream,
+                          const ListenerRegistry& registry )
+{
+    return stream << "{ \"size\": " << registry.size()
+                  << ", \"pending\": " << registry.pending() << " }";
+}
+
+// CONSTRUCTORS
+inline
+ListenerRegistry::ListenerRegistry()
+    : d_slots(), d_free(), d_pendingAddition(), d_pendingRemoval(),
+      d_lists(), d_tombstones(), d_size( 0 )
+{
+}
+
+inline
+ListenerRegistry::ListenerRegistry( const ListenerRegistry& registry )
+    : d_slots( registry.d_slots ), d_free( registry.d_free ),
+      d_pendingAddition( registry.d_pendingAddition ),
+      d_pendingRemoval( registry.d_pendingRemoval ),
+      d_lists( registry.d_lists ), d_tombstones( registry.d_tombstones ),
+      d_size( registry.d_size )
+{
+}
+
+inline
+ListenerRegistry::~ListenerRegistry()
+{
+}
+
+// OPERATORS
+inline
+ListenerRegistry& ListenerRegistry::operator=(
+    const ListenerRegistry& registry )
+{
+    if ( &registry != this )
+    {
+        d_slots = registry.d_slots;
+        d_free = registry.d_free;
+        d_pendingAddition = registry.d_pendingAddition;
+        d_pendingRemoval = registry.d_pendingRemoval;
+        d_lists = registry.d_lists;
+        d_tombstones = registry.d_tombstones;
+        d_size = registry.d_size;
+    }
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int ListenerRegistry::types() const
+{
+    return d_lists.size();
+}
+
+inline
+const sgdc::DynamicArray<RegisteredListener>& ListenerRegistry::listeners(
+    EventTypeId type ) const
+{
+    assert( type < d_lists.size() );
+
+    return d_lists[type];
+}
+
+inline
+unsigned int ListenerRegistry::size() const
+{
+    return d_size;
+}
+
+inline
+unsigned int ListenerRegistry::pending() const
+{
+    return d_pendingAddition.size() + d_pendingRemoval.size();
+}
+
+inline
+bool ListenerRegistry::contains( EventHandle handle ) const
+{
+    return findSlot( handle ) >= 0;
+}
+
+inline
+EventHandle ListenerRegistry::handle( unsigned int slot ) const
+{
+    assert( slot < d_slots.size() );
+
+    return ( d_slots[slot].generation << INDEX_BITS ) | slot;
+}
+
+// MEMBER FUNCTIONS
+inline
+EventHandle ListenerRegistry::add( EventTypeId type,
+                                   const EventListener& listener )
+{
+    assert( listener );
+
+    EventHandle handle = reserve( type );
+
+    d_slots[handle & INDEX_MASK].listener = listener;
+
+    return handle;
+}
+
+inline
+EventHandle ListenerRegistry::addBatch( EventTypeId type,
+                                        const BatchListener& listener )
+{
+    assert( listener );
+
+    EventHandle handle = reserve( type );
+
+    d_slots[handle & INDEX_MASK].batchListener = listener;
+
+    return handle;
+}
+
+inline
+bool ListenerRegistry::remove( EventHandle handle )
+{
+    int slot = findSlot( handle );
+
+    if ( slot < 0 )
+    {
+        return false;
+    }
+
+    d_slots[slot].isLive = false;
+    d_pendingRemoval.push( static_cast<unsigned int>( slot ) );
+
+    return true;
+}
+
+// HELPER FUNCTIONS
+inline
+int ListenerRegistry::findSlot( EventHandle handle ) const
+{
+    unsigned int index = handle & INDEX_MASK;
+
+    if ( handle == INVALID_HANDLE || index >= d_slots.size() )
+    {
+        return -1;
+    }
+
+    const Slot& slot = d_slots[index];
+
+    return slot.isLive && slot.generation == handle >> INDEX_BITS ?
+           static_cast<int>( index ) : -1;
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
+
+#endif
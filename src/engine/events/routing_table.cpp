@@ -0,0 +1,53 @@
+// routing_table.cpp
+#include "routing_table.h"
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+// MEMBER FUNCTIONS
+void RoutingTable::extend( const ListenerRegistry& listeners )
+{
+    EventTypes& types = EventTypes::inst();
+    unsigned int size = types.size();
+    EventTypeId category;
+    Route route;
+    unsigned int i;
+
+    while ( d_routes.size() < size )
+    {
+        route.first = d_entries.size();
+        route.count = 0;
+
+        // nearest first so the listeners of a type run before its
+        // categories'
+        category = d_routes.size();
+        while ( category != EventTypes::NO_TYPE )
+        {
+            if ( category < listeners.types() )
+            {
+                const sgdc::DynamicArray<RegisteredListener>& list =
+                    listeners.listeners( category );
+
+                for ( i = 0; i < list.size(); ++i )
+                {
+                    if ( list[i].listener || list[i].batchListener )
+                    {
+                        d_entries.push( &list[i] );
+                        ++route.count;
+                    }
+                }
+            }
+
+            category = types.parent( category );
+        }
+
+        d_routes.push( route );
+    }
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
@@ -0,0 +1,179 @@
+// routing_table.h
+//
+// Lists, for every interned event type, the listeners that are given its
+// events: those of the type itself followed by those of each category it
+// is within, from the nearest to the farthest. The lists are laid end to
+// end in one flat array so that dispatching walks a single range without
+// looking at any categories.
+//
+// The table refers to the listeners of a registry and must be rebuilt
+// whenever a flush of the registry changes them. Types that are interned
+// afterwards are appended by extend without touching existing routes.
+#ifndef INCLUDED_ROUTING_TABLE
+#define INCLUDED_ROUTING_TABLE
+
+#include "../containers/dynamic_array.h"
+#include <assert.h>
+#include "event_types.h"
+#include "listener_registry.h"
+
+namespace StevensDev
+{
+
+namespace sgde
+{
+
+class RoutingTable
+{
+  private:
+    struct Route
+    {
+        unsigned int first;
+          // The first of the type's entries.
+
+        unsigned int count;
+          // The number of listeners given the type's events.
+    };
+
+    // MEMBERS
+    sgdc::DynamicArray<Route> d_routes;
+      // The route of each type by their identifiers.
+
+    sgdc::DynamicArray<const RegisteredListener*> d_entries;
+      // The listeners of every route.
+
+  public:
+    // CONSTRUCTORS
+    RoutingTable();
+      // Constructs a new table without any routes.
+
+    RoutingTable( const RoutingTable& table );
+      // Constructs a copy of the table that refers to the same listeners.
+
+    ~RoutingTable();
+      // Destructs the table.
+
+    // OPERATORS
+    RoutingTable& operator=( const RoutingTable& table );
+      // Makes this a copy of the table that refers to the same listeners.
+
+    const RegisteredListener& operator[]( unsigned int index ) const;
+      // Gets the listener at the entry index.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int size() const;
+      // Gets the number of types that have a route.
+
+    unsigned int entries() const;
+      // Gets the number of entries in every route.
+
+    unsigned int begin( EventTypeId type ) const;
+      // Gets the index of the first entry of the type's route.
+      //
+      // Requirements:
+      // type is less than size
+
+    unsigned int end( EventTypeId type ) const;
+      // Gets the index after the last entry of the type's route.
+      //
+      // Requirements:
+      // type is less than size
+
+    // MEMBER FUNCTIONS
+    void rebuild( const ListenerRegistry& listeners );
+      // Rebuilds every route from the listeners as of their last flush.
+
+    void extend( const ListenerRegistry& listeners );
+      // Adds routes for the types interned since the last rebuild or
+      // extension.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const RoutingTable& table )
+{
+    return stream << "{ \"size\": " << table.size()
+                  << ", \"entries\": " << table.entries() << " }";
+}
+
+// CONSTRUCTORS
+inline
+RoutingTable::RoutingTable() : d_routes(), d_entries()
+{
+}
+
+inline
+RoutingTable::RoutingTable( const RoutingTable& table )
+    : d_routes( table.d_routes ), d_entries( table.d_entries )
+{
+}
+
+inline
+RoutingTable::~RoutingTable()
+{
+}
+
+// OPERATORS
+inline
+RoutingTable& RoutingTable::operator=( const RoutingTable& table )
+{
+    if ( &table != this )
+    {
+        d_routes = table.d_routes;
+        d_entries = table.d_entries;
+    }
+
+    return *this;
+}
+
+inline
+const RegisteredListener& RoutingTable::operator[](
+    unsigned int index ) const
+{
+    return *d_entries[index];
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int RoutingTable::size() const
+{
+    return d_routes.size();
+}
+
+inline
+unsigned int RoutingTable::entries() const
+{
+    return d_entries.size();
+}
+
+inline
+unsigned int RoutingTable::begin( EventTypeId type ) const
+{
+    assert( type < d_routes.size() );
+
+    return d_routes[type].first;
+}
+
+inline
+unsigned int RoutingTable::end( EventTypeId type ) const
+{
+    assert( type < d_routes.size() );
+
+    return d_routes[type].first + d_routes[type].count;
+}
+
+// MEMBER FUNCTIONS
+inline
+void RoutingTable::rebuild( const ListenerRegistry& listeners )
+{
+    d_routes.clear();
+    d_entries.clear();
+
+    extend( listeners );
+}
+
+} // End nspc sgde
+
+} // End nspc StevensDev
+
+#endif
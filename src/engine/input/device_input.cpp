@@ -0,0 +1,87 @@
+// device_input.cpp
+#include "device_input.h"
+#include <SFML/Window.hpp>
+
+namespace StevensDev
+{
+
+namespace sgdi
+{
+
+namespace
+{
+
+// HELPER FUNCTIONS
+unsigned int getInput( sf::Keyboard::Key key )
+{
+    return static_cast<unsigned int>( key );
+}
+
+unsigned int getInput( sf::Mouse::Button button )
+{
+    return static_cast<unsigned int>( button ) +
+           static_cast<unsigned int>( sf::Keyboard::KeyCount );
+}
+
+unsigned int getInput( unsigned int button )
+{
+    return button +
+           static_cast<unsigned int>( sf::Keyboard::KeyCount ) +
+           static_cast<unsigned int>( sf::Mouse::ButtonCount );
+}
+
+void set( bool* isDown, unsigned int count, unsigned int input, bool value )
+{
+    if ( input < count )
+    {
+        isDown[input] = value;
+    }
+}
+
+} // End nspc anonymous
+
+// MEMBER FUNCTIONS
+void DeviceInput::poll( bool* isDown, unsigned int count )
+{
+    unsigned int i;
+
+    // anything without a device, like a missing game pad, is up
+    for ( i = 0; i < count; ++i )
+    {
+        isDown[i] = false;
+    }
+
+    // check keyboard keys
+    sf::Keyboard::Key key;
+    for ( i = 0, key = static_cast<sf::Keyboard::Key>( i );
+          i < static_cast<unsigned int>( sf::Keyboard::KeyCount );
+          ++i, key = static_cast<sf::Keyboard::Key>( i ) )
+    {
+        set( isDown, count, getInput( key ),
+             sf::Keyboard::isKeyPressed( key ) );
+    }
+
+    // check mouse buttons
+    sf::Mouse::Button mouse;
+    for ( i = 0, mouse = static_cast<sf::Mouse::Button>( i );
+          i < static_cast<unsigned int>( sf::Mouse::ButtonCount );
+          ++i, mouse = static_cast<sf::Mouse::Button>( i ) )
+    {
+        set( isDown, count, getInput( mouse ),
+             sf::Mouse::isButtonPressed( mouse ) );
+    }
+
+    // check game pad buttons (only one game pad is supported)
+    if ( sf::Joystick::isConnected( 0 ) )
+    {
+        for ( i = 0; i < sf::Joystick::getButtonCount( 0 ); ++i )
+        {
+            set( isDown, count, getInput( i ),
+                 sf::Joystick::isButtonPressed( 0, i ) );
+        }
+    }
+}
+
+} // End nspc sgdi
+
+} // End nspc StevensDev
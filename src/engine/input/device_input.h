@@ -0,0 +1,73 @@
+// device_input.h
+//
+// Reads the keyboard, mouse and first game pad. This is where Input gets
+// its states from unless it is given another source.
+#ifndef INCLUDED_DEVICE_INPUT
+#define INCLUDED_DEVICE_INPUT
+
+#include "iinput_source.h"
+#include <iostream>
+
+namespace StevensDev
+{
+
+namespace sgdi
+{
+
+class DeviceInput : public IInputSource
+{
+  public:
+    // CONSTRUCTORS
+    DeviceInput();
+      // Constructs a new device source.
+
+    DeviceInput( const DeviceInput& source );
+      // Constructs a copy of the source.
+
+    virtual ~DeviceInput();
+      // Destructs the source.
+
+    // OPERATORS
+    DeviceInput& operator=( const DeviceInput& source );
+      // Makes this a copy of the source.
+
+    // MEMBER FUNCTIONS
+    virtual void poll( bool* isDown, unsigned int count );
+      // Reads if each of the first count inputs is down from the devices.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const DeviceInput& source )
+{
+    return stream << "{  }";
+}
+
+// CONSTRUCTORS
+inline
+DeviceInput::DeviceInput()
+{
+}
+
+inline
+DeviceInput::DeviceInput( const DeviceInput& source )
+{
+}
+
+inline
+DeviceInput::~DeviceInput()
+{
+}
+
+// OPERATORS
+inline
+DeviceInput& DeviceInput::operator=( const DeviceInput& source )
+{
+    return *this;
+}
+
+} // End nspc sgdi
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,2 @@
+// iinput_source.cpp
+#include "iinput_source.h"
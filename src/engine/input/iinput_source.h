@@ -0,0 +1,33 @@
+// iinput_source.h
+#ifndef INCLUDED_IINPUT_SOURCE
+#define INCLUDED_IINPUT_SOURCE
+
+namespace StevensDev
+{
+
+namespace sgdi
+{
+
+class IInputSource
+{
+  public:
+    // CONSTRUCTORS
+    virtual ~IInputSource() = 0;
+      // Destructs the source.
+
+    // MEMBER FUNCTIONS
+    virtual void poll( bool* isDown, unsigned int count ) = 0;
+      // Writes if each of the first count inputs is down for the next
+      // frame.
+};
+
+inline
+IInputSource::~IInputSource()
+{
+}
+
+} // End nspc sgdi
+
+} // End nspc StevensDev
+
+#endif
@@ -1,6 +1,5 @@
 // input.cpp
 #include "input.h"
-#include <SFML/Window.hpp>
 
 namespace StevensDev
 {
@@ -8,32 +7,6 @@ namespace StevensDev
 namespace sgdi
 {
 
-namespace
-{
-
-// HELPER FUNCTIONS
-Input::InputType getInputType( sf::Keyboard::Key key )
-{
-    return static_cast<Input::InputType>( key );
-}
-
-Input::InputType getInputType( sf::Mouse::Button button )
-{
-    return static_cast<Input::InputType>(
-        static_cast<int>( button ) +
-        static_cast<int>( sf::Keyboard::KeyCount ) );
-}
-
-Input::InputType getInputType( unsigned int button )
-{
-    return static_cast<Input::InputType>(
-        static_cast<int>( button ) +
-        static_cast<int>( sf::Keyboard::KeyCount ) +
-        static_cast<int>( sf::Mouse::ButtonCount ) );
-}
-
-} // End nspc anonymous
-
 // GLOBALS
 Input Input::d_instance = Input();
 
@@ -55,47 +28,14 @@ bool Input::wasPressed( Input::InputType type )
 
 void Input::preTick()
 {
-    int i;
-    InputType type;
-
-    // check keyboard keys
-    sf::Keyboard::Key key;
-    for ( i = 0, key = static_cast<sf::Keyboard::Key>( i );
-          i < static_cast<int>( sf::Keyboard::KeyCount );
-          ++i, key = static_cast<sf::Keyboard::Key>( i ) )
-    {
-        type = getInputType( key );
-        d_states[type].wasDown = d_states[type].isDown;
-        d_states[type].isDown = sf::Keyboard::isKeyPressed( key );
-        d_states[type].wasDown &= !d_states[type].isDown;
-    }
-
-    // check mouse buttons
-    sf::Mouse::Button mouse;
-    for ( i = 0, mouse = static_cast<sf::Mouse::Button>( i );
-          i < static_cast<int>( sf::Mouse::ButtonCount );
-          ++i, mouse = static_cast<sf::Mouse::Button>( i ) )
-    {
-        type = getInputType( mouse );
-        d_states[type].wasDown = d_states[type].isDown;
-        d_states[type].isDown = sf::Mouse::isButtonPressed( mouse );
-        d_states[type].wasDown &= !d_states[type].isDown;
-    }
+    IInputSource* source = d_source != nullptr ? d_source : &d_devices;
+    bool isDown[INPUT_TYPE_COUNT];
+    unsigned int i;
 
-    // check game pad buttons (only one game pad is supported)
-    if ( sf::Joystick::isConnected( 0 ) )
+    source->poll( isDown, INPUT_TYPE_COUNT );
+    for ( i = 0; i < INPUT_TYPE_COUNT; ++i )
     {
-        unsigned int gpButton;
-        for ( gpButton = 0;
-              gpButton < sf::Joystick::getButtonCount( 0 );
-              ++gpButton )
-        {
-            type = getInputType( gpButton );
-            d_states[type].wasDown = d_states[type].isDown;
-            d_states[type].isDown =
-                sf::Joystick::isButtonPressed( 0, gpButton );
-            d_states[type].wasDown &= !d_states[type].isDown;
-        }
+        update( i, isDown[i] );
     }
 }
 
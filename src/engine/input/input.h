@@ -4,6 +4,8 @@
 #include "../memory/allocator_guard.h"
 #include "../memory/mem.h"
 #include "../scene/itickable.h"
+#include "device_input.h"
+#include "iinput_source.h"
 #include <string>
 
 namespace StevensDev
@@ -38,6 +40,16 @@ class Input : public sgds::ITickable
       // is equal to O(1). Furthermore, the state information is just 2 bits
       // (assuming bool is compressed to 1 bit).
 
+    DeviceInput d_devices;
+      // The keyboard, mouse and game pad.
+
+    IInputSource* d_source;
+      // Where the states come from or nullptr to poll the devices.
+
+    // HELPER FUNCTIONS
+    void update( unsigned int input, bool isDown );
+      // Moves the input to its next state.
+
     // CONSTRUCTORS
     Input();
       // Constructs a new input manager.
@@ -212,6 +224,15 @@ class Input : public sgds::ITickable
     bool wasPressed( InputType type );
       // Checks if a button was down then up.
 
+    IInputSource* source() const;
+      // Gets where the states come from or nullptr if the devices are
+      // polled.
+
+    void setSource( IInputSource* source );
+      // Sets where the states come from or nullptr to poll the devices.
+      //
+      // The source must outlive its use. Every input starts up again.
+
     virtual void preTick();
       // Polls input state and stores it internally.
 
@@ -234,7 +255,7 @@ std::ostream& operator<<( std::ostream& stream, const Input& input )
 
 // CONSTRUCTORS
 inline
-Input::Input() : d_alloc()
+Input::Input() : d_alloc(), d_devices(), d_source( nullptr )
 {
     // clear input state
     InputState nullState;
@@ -246,7 +267,8 @@ Input::Input() : d_alloc()
 }
 
 inline
-Input::Input( const Input& input )
+Input::Input( const Input& input ) : d_devices(),
+                                     d_source( input.d_source )
 {
     d_states = d_alloc.allocator()->get( INPUT_TYPE_COUNT );
     sgdm::Mem::copy( d_states, input.d_states, INPUT_TYPE_COUNT );
@@ -256,6 +278,7 @@ inline
 Input& Input::operator=( const Input& input )
 {
     sgdm::Mem::copy( d_states, input.d_states, INPUT_TYPE_COUNT );
+    d_source = input.d_source;
     return *this;
 }
 
@@ -265,6 +288,32 @@ Input::~Input()
     d_alloc.release( d_states, INPUT_TYPE_COUNT );
 }
 
+// MEMBER FUNCTIONS
+inline
+IInputSource* Input::source() const
+{
+    return d_source;
+}
+
+inline
+void Input::setSource( IInputSource* source )
+{
+    InputState nullState;
+    nullState.isDown = false;
+    nullState.wasDown = false;
+
+    d_source = source;
+    sgdm::Mem::set( d_states, nullState, INPUT_TYPE_COUNT );
+}
+
+// HELPER FUNCTIONS
+inline
+void Input::update( unsigned int input, bool isDown )
+{
+    d_states[input].wasDown = d_states[input].isDown && !isDown;
+    d_states[input].isDown = isDown;
+}
+
 // GLOBAL FUNCTIONS
 inline
 Input& Input::inst()
@@ -0,0 +1,84 @@
+// scripted_input.cpp
+#include "scripted_input.h"
+
+namespace StevensDev
+{
+
+namespace sgdi
+{
+
+// MEMBER FUNCTIONS
+void ScriptedInput::rewind()
+{
+    unsigned int i;
+
+    for ( i = 0; i < d_states.size(); ++i )
+    {
+        d_states[i] = false;
+    }
+
+    d_frame = 0;
+    d_next = 0;
+}
+
+void ScriptedInput::poll( bool* isDown, unsigned int count )
+{
+    assert( isDown != nullptr );
+
+    unsigned int i;
+
+    while ( d_states.size() < count )
+    {
+        d_states.push( false );
+    }
+
+    while ( d_next < d_changes.size() && d_changes[d_next].frame <= d_frame )
+    {
+        const Change& change = d_changes[d_next++];
+
+        if ( change.input < d_states.size() )
+        {
+            d_states[change.input] = change.isDown;
+        }
+    }
+
+    for ( i = 0; i < count; ++i )
+    {
+        isDown[i] = d_states[i];
+    }
+
+    ++d_frame;
+}
+
+// HELPER FUNCTIONS
+void ScriptedInput::schedule( unsigned long long frame,
+                              unsigned int input, bool isDown )
+{
+    assert( frame >= d_frame );
+
+    Change change;
+    unsigned int index = d_changes.size();
+
+    change.frame = frame;
+    change.input = input;
+    change.isDown = isDown;
+
+    // scripts are usually written in order so search from the back
+    while ( index > d_next && d_changes[index - 1].frame > frame )
+    {
+        --index;
+    }
+
+    if ( index == d_changes.size() )
+    {
+        d_changes.push( change );
+    }
+    else
+    {
+        d_changes.insertAt( index, change );
+    }
+}
+
+} // End nspc sgdi
+
+} // End nspc StevensDev
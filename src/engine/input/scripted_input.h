@@ -0,0 +1,183 @@
+// scripted_input.h
+//
+// Feeds Input from a script of presses and releases instead of the devices
+// so that bots, soak tests and headless runs see the same input every
+// time. An input stays down from the frame it is pressed until the frame
+// it is released.
+//
+// Inputs are identified by their Input::InputType.
+#ifndef INCLUDED_SCRIPTED_INPUT
+#define INCLUDED_SCRIPTED_INPUT
+
+#include "../containers/dynamic_array.h"
+#include <assert.h>
+#include "iinput_source.h"
+
+namespace StevensDev
+{
+
+namespace sgdi
+{
+
+class ScriptedInput : public IInputSource
+{
+  private:
+    struct Change
+    {
+        unsigned long long frame;
+          // The frame that the change happens on.
+
+        unsigned int input;
+          // The input that changes.
+
+        bool isDown;
+          // If the input is down from then on.
+    };
+
+    // MEMBERS
+    sgdc::DynamicArray<Change> d_changes;
+      // The changes in frame order.
+
+    sgdc::DynamicArray<bool> d_states;
+      // If each input is down as of the last poll.
+
+    unsigned long long d_frame;
+      // The frame that the next poll produces.
+
+    unsigned int d_next;
+      // The first change that has not been applied.
+
+    // HELPER FUNCTIONS
+    void schedule( unsigned long long frame, unsigned int input,
+                   bool isDown );
+      // Adds the change after every other change on or before the frame.
+
+  public:
+    // CONSTRUCTORS
+    ScriptedInput();
+      // Constructs a new empty script.
+
+    ScriptedInput( const ScriptedInput& script );
+      // Constructs a copy of the script at the same frame.
+
+    virtual ~ScriptedInput();
+      // Destructs the script.
+
+    // OPERATORS
+    ScriptedInput& operator=( const ScriptedInput& script );
+      // Makes this a copy of the script at the same frame.
+
+    // ACCESSOR FUNCTIONS
+    unsigned long long frame() const;
+      // Gets the frame that the next poll produces.
+
+    bool isFinished() const;
+      // Checks if every change has been applied.
+
+    // MEMBER FUNCTIONS
+    ScriptedInput& press( unsigned long long frame, unsigned int input );
+      // Presses the input on the frame.
+
+    ScriptedInput& release( unsigned long long frame,
+                            unsigned int input );
+      // Releases the input on the frame.
+
+    ScriptedInput& tap( unsigned long long frame, unsigned int input,
+                        unsigned int frames = 1 );
+      // Presses the input on the frame and releases it frames later.
+
+    void rewind();
+      // Starts the script over from the first frame with every input up.
+
+    virtual void poll( bool* isDown, unsigned int count );
+      // Applies the changes for the next frame and writes the states.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream,
+                          const ScriptedInput& script )
+{
+    return stream << "{ \"frame\": " << script.frame()
+                  << ", \"finished\": "
+                  << ( script.isFinished() ? "true" : "false" ) << " }";
+}
+
+// CONSTRUCTORS
+inline
+ScriptedInput::ScriptedInput() : d_changes(), d_states(), d_frame( 0 ),
+                                 d_next( 0 )
+{
+}
+
+inline
+ScriptedInput::ScriptedInput( const ScriptedInput& script )
+    : d_changes( script.d_changes ), d_states( script.d_states ),
+      d_frame( script.d_frame ), d_next( script.d_next )
+{
+}
+
+inline
+ScriptedInput::~ScriptedInput()
+{
+}
+
+// OPERATORS
+inline
+ScriptedInput& ScriptedInput::operator=( const ScriptedInput& script )
+{
+    d_changes = script.d_changes;
+    d_states = script.d_states;
+    d_frame = script.d_frame;
+    d_next = script.d_next;
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned long long ScriptedInput::frame() const
+{
+    return d_frame;
+}
+
+inline
+bool ScriptedInput::isFinished() const
+{
+    return d_next >= d_changes.size();
+}
+
+// MEMBER FUNCTIONS
+inline
+ScriptedInput& ScriptedInput::press( unsigned long long frame,
+                                     unsigned int input )
+{
+    schedule( frame, input, true );
+    return *this;
+}
+
+inline
+ScriptedInput& ScriptedInput::release( unsigned long long frame,
+                                       unsigned int input )
+{
+    schedule( frame, input, false );
+    return *this;
+}
+
+inline
+ScriptedInput& ScriptedInput::tap( unsigned long long frame,
+                                   unsigned int input,
+                                   unsigned int frames )
+{
+    assert( frames > 0 );
+
+    schedule( frame, input, true );
+    schedule( frame + frames, input, false );
+    return *this;
+}
+
+} // End nspc sgdi
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,2 @@
+// job.cpp
+#include "job.h"
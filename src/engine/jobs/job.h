@@ -0,0 +1,128 @@
+// job.h
+#ifndef INCLUDED_JOB
+#define INCLUDED_JOB
+
+#include <assert.h>
+#include <atomic>
+#include <ostream>
+
+namespace StevensDev
+{
+
+namespace sgdj
+{
+
+class JobCounter
+{
+  private:
+    std::atomic<unsigned int> d_count;
+      // The number of jobs that have not finished.
+
+    // CONSTRUCTORS
+    JobCounter( const JobCounter& counter );
+      // Counters are shared by reference and cannot be copied.
+
+    // OPERATORS
+    JobCounter& operator=( const JobCounter& counter );
+      // Counters are shared by reference and cannot be copied.
+
+  public:
+    // CONSTRUCTORS
+    JobCounter();
+      // Constructs a new counter with no unfinished jobs.
+
+    JobCounter( unsigned int count );
+      // Constructs a new counter with the given number of unfinished jobs.
+
+    ~JobCounter();
+      // Destructs the counter.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int count() const;
+      // Gets the number of jobs that have not finished.
+
+    bool isDone() const;
+      // Checks if every counted job has finished.
+
+    // MEMBER FUNCTIONS
+    void add( unsigned int count );
+      // Counts additional unfinished jobs.
+
+    void finish();
+      // Marks one counted job as finished.
+};
+
+struct Job
+{
+    void ( *function )( void* data );
+      // The function that does the work.
+
+    void* data;
+      // The data passed to the function.
+
+    JobCounter* counter;
+      // The counter that is marked when the job finishes or nullptr.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const JobCounter& counter )
+{
+    return stream << "{ \"count\": " << counter.count() << " }";
+}
+
+inline
+std::ostream& operator<<( std::ostream& stream, const Job& job )
+{
+    return stream << "{  }";
+}
+
+// CONSTRUCTORS
+inline
+JobCounter::JobCounter() : d_count( 0 )
+{
+}
+
+inline
+JobCounter::JobCounter( unsigned int count ) : d_count( count )
+{
+}
+
+inline
+JobCounter::~JobCounter()
+{
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int JobCounter::count() const
+{
+    return d_count.load( std::memory_order_acquire );
+}
+
+inline
+bool JobCounter::isDone() const
+{
+    return d_count.load( std::memory_order_acquire ) == 0;
+}
+
+// MEMBER FUNCTIONS
+inline
+void JobCounter::add( unsigned int count )
+{
+    d_count.fetch_add( count, std::memory_order_relaxed );
+}
+
+inline
+void JobCounter::finish()
+{
+    // release so that the job's writes are seen by whoever waits on it
+    unsigned int previous = d_count.fetch_sub( 1, std::memory_order_release );
+    assert( previous > 0 );
+}
+
+} // End nspc sgdj
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,212 @@
+// job_system.cpp
+#include "job_system.h"
+
+namespace StevensDev
+{
+
+namespace sgdj
+{
+
+// GLOBALS
+JobSystem JobSystem::d_instance = JobSystem();
+
+thread_local int JobSystem::d_worker = -1;
+
+// CONSTRUCTORS
+JobSystem::~JobSystem()
+{
+    if ( isRunning() )
+    {
+        shutdown();
+    }
+}
+
+// MEMBER FUNCTIONS
+void JobSystem::initialize( unsigned int workers )
+{
+    assert( !isRunning() );
+
+    unsigned int i;
+
+    d_workers = workers;
+    d_deques = new WorkStealingDeque[d_workers + 1];
+    d_pending.store( 0, std::memory_order_relaxed );
+    d_isRunning.store( true, std::memory_order_release );
+
+    d_worker = 0;
+
+    if ( d_workers > 0 )
+    {
+        d_threads = new std::thread[d_workers];
+        for ( i = 0; i < d_workers; ++i )
+        {
+            d_threads[i] = std::thread( &JobSystem::work, this, i + 1 );
+        }
+    }
+}
+
+void JobSystem::shutdown()
+{
+    assert( isRunning() );
+    assert( d_pending.load( std::memory_order_acquire ) == 0 );
+
+    unsigned int i;
+
+    {
+        std::lock_guard<std::mutex> lock( d_sleepMutex );
+        d_isRunning.store( false, std::memory_order_release );
+    }
+    d_wake.notify_all();
+
+    if ( d_workers > 0 )
+    {
+        for ( i = 0; i < d_workers; ++i )
+        {
+            d_threads[i].join();
+        }
+
+        delete[] d_threads;
+        d_threads = nullptr;
+    }
+
+    delete[] d_deques;
+    d_deques = nullptr;
+    d_workers = 0;
+    d_worker = -1;
+}
+
+void JobSystem::run( Job* jobs, unsigned int count )
+{
+    unsigned int queued = 0;
+    unsigned int i;
+
+    for ( i = 0; i < count; ++i )
+    {
+        // run immediately when there is nowhere to queue the job
+        if ( !isWorker() )
+        {
+            execute( &jobs[i] );
+            continue;
+        }
+
+        // counted first so a thief never sees the job before its count
+        d_pending.fetch_add( 1, std::memory_order_release );
+
+        if ( !d_deques[d_worker].push( &jobs[i] ) )
+        {
+            d_pending.fetch_sub( 1, std::memory_order_relaxed );
+            execute( &jobs[i] );
+            continue;
+        }
+
+        ++queued;
+    }
+
+    if ( queued > 0 )
+    {
+        wake( queued );
+    }
+}
+
+void JobSystem::wait( const JobCounter& counter )
+{
+    Job* job;
+
+    while ( !counter.isDone() )
+    {
+        job = isWorker() ? take( d_worker ) : nullptr;
+
+        if ( job != nullptr )
+        {
+            execute( job );
+        }
+        else
+        {
+            // the remaining jobs are running on other workers
+            std::this_thread::yield();
+        }
+    }
+}
+
+// HELPER FUNCTIONS
+Job* JobSystem::take( unsigned int worker )
+{
+    unsigned int count = d_workers + 1;
+    unsigned int i;
+    Job* job;
+
+    job = d_deques[worker].pop();
+
+    // steal from the others starting with the next worker
+    for ( i = 1; job == nullptr && i < count; ++i )
+    {
+        job = d_deques[( worker + i ) % count].steal();
+    }
+
+    if ( job != nullptr )
+    {
+        d_pending.fetch_sub( 1, std::memory_order_relaxed );
+    }
+
+    return job;
+}
+
+void JobSystem::execute( Job* job )
+{
+    JobCounter* counter = job->counter;
+
+    // the job may be released as soon as the counter is marked
+    job->function( job->data );
+
+    if ( counter != nullptr )
+    {
+        counter->finish();
+    }
+}
+
+void JobSystem::work( unsigned int worker )
+{
+    Job* job;
+
+    d_worker = worker;
+
+    while ( isRunning() )
+    {
+        job = take( worker );
+
+        if ( job != nullptr )
+        {
+            execute( job );
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock( d_sleepMutex );
+        d_wake.wait( lock, [this]() {
+            return d_pending.load( std::memory_order_acquire ) > 0 ||
+                   !isRunning();
+        } );
+    }
+
+    d_worker = -1;
+}
+
+void JobSystem::wake( unsigned int count )
+{
+    // taking the lock orders the new jobs before any worker's sleep check
+    {
+        std::lock_guard<std::mutex> lock( d_sleepMutex );
+    }
+
+    if ( count == 1 )
+    {
+        d_wake.notify_one();
+    }
+    else
+    {
+        d_wake.notify_all();
+    }
+}
+
+} // End nspc sgdj
+
+} // End nspc StevensDev
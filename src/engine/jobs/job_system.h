@@ -0,0 +1,275 @@
+// job_system.h
+//
+// A fixed pool of worker threads that run jobs from per-thread
+// work-stealing deques. The thread that initializes the system takes part
+// as worker zero so that it can submit jobs and help run them while it
+// waits on their counters.
+//
+// Dependencies are expressed with counters: a job that needs the results
+// of other jobs waits on their counter, and waiting runs other queued jobs
+// instead of blocking so that a dependency can never starve its dependent.
+//
+// Until the system is initialized, and on threads that are not part of
+// it, every job is run immediately on the submitting thread.
+#ifndef INCLUDED_JOB_SYSTEM
+#define INCLUDED_JOB_SYSTEM
+
+#include "../memory/allocator_guard.h"
+#include <algorithm>
+#include <assert.h>
+#include <atomic>
+#include <condition_variable>
+#include "job.h"
+#include <mutex>
+#include <thread>
+#include "work_stealing_deque.h"
+
+namespace StevensDev
+{
+
+namespace sgdj
+{
+
+class JobSystem
+{
+  private:
+    template <typename F>
+    struct Range
+    {
+        const F* body;
+          // The loop body.
+
+        unsigned int start;
+          // The first index in the range.
+
+        unsigned int end;
+          // One past the last index in the range.
+    };
+
+    // GLOBALS
+    static JobSystem d_instance;
+      // The singleton instance.
+
+    static thread_local int d_worker;
+      // The index of the calling thread's worker or -1 if it is not part
+      // of the system.
+
+    // MEMBERS
+    WorkStealingDeque* d_deques;
+      // The deque of each worker including the initializing thread.
+
+    std::thread* d_threads;
+      // The background worker threads.
+
+    unsigned int d_workers;
+      // The number of background worker threads.
+
+    std::atomic<bool> d_isRunning;
+      // If the workers should keep running.
+
+    std::atomic<unsigned int> d_pending;
+      // The number of jobs that are queued and not yet taken.
+
+    std::mutex d_sleepMutex;
+      // Guards sleeping workers against missed wake ups.
+
+    std::condition_variable d_wake;
+      // Wakes sleeping workers when jobs are queued.
+
+    // CONSTRUCTORS
+    JobSystem();
+      // Constructs a new job system without any workers.
+
+    JobSystem( const JobSystem& system );
+      // Constructs a copy of the given job system.
+      //
+      // Threads cannot be copied so this is disabled.
+
+    // OPERATORS
+    JobSystem& operator=( const JobSystem& system );
+      // Makes this a copy of the given job system.
+      //
+      // Threads cannot be copied so this is disabled.
+
+    // HELPER FUNCTIONS
+    Job* take( unsigned int worker );
+      // Takes a job from the worker's deque or steals one from another.
+
+    void execute( Job* job );
+      // Runs the job and marks its counter.
+
+    void work( unsigned int worker );
+      // Runs jobs on a background worker until the system shuts down.
+
+    void wake( unsigned int count );
+      // Wakes sleeping workers after count jobs have been queued.
+
+    template <typename F>
+    static void runRange( void* data );
+      // Runs a range of a parallel for loop.
+
+  public:
+    // CONSTRUCTORS
+    ~JobSystem();
+      // Destructs the job system and stops any workers.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int workers() const;
+      // Gets the number of background worker threads.
+
+    bool isRunning() const;
+      // Checks if the system has been initialized.
+
+    bool isWorker() const;
+      // Checks if the calling thread is part of the system.
+
+    // MEMBER FUNCTIONS
+    void initialize( unsigned int workers );
+      // Starts the given number of background workers and makes the calling
+      // thread worker zero.
+      //
+      // With zero workers jobs are still queued and are run by the calling
+      // thread when it waits.
+      //
+      // Requirements:
+      // the system is not running
+
+    void shutdown();
+      // Stops and joins the background workers.
+      //
+      // Requirements:
+      // the system is running
+      // called from the thread that initialized the system
+      // no jobs are queued
+
+    void run( Job* job );
+      // Queues the job on the calling thread's deque.
+      //
+      // The job must stay alive until it finishes. If its counter is set it
+      // must already count the job.
+
+    void run( Job* jobs, unsigned int count );
+      // Queues the jobs on the calling thread's deque.
+
+    void wait( const JobCounter& counter );
+      // Runs queued jobs until the counter is done.
+
+    template <typename F>
+    void parallelFor( unsigned int count, unsigned int grain, const F& body );
+      // Splits [0, count) into ranges of at most grain indices and runs
+      // body( start, end ) for each range across the workers, returning
+      // once every range has finished.
+      //
+      // The calling thread runs the first range itself.
+
+    // GLOBAL FUNCTIONS
+    static JobSystem& inst();
+      // Gets the job system.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const JobSystem& system )
+{
+    return stream << "{ \"workers\": " << system.workers() << " }";
+}
+
+// CONSTRUCTORS
+inline
+JobSystem::JobSystem()
+    : d_deques( nullptr ), d_threads( nullptr ), d_workers( 0 ),
+      d_isRunning( false ), d_pending( 0 ), d_sleepMutex(), d_wake()
+{
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int JobSystem::workers() const
+{
+    return d_workers;
+}
+
+inline
+bool JobSystem::isRunning() const
+{
+    return d_isRunning.load( std::memory_order_acquire );
+}
+
+inline
+bool JobSystem::isWorker() const
+{
+    return d_worker >= 0 && isRunning();
+}
+
+// MEMBER FUNCTIONS
+inline
+void JobSystem::run( Job* job )
+{
+    run( job, 1 );
+}
+
+template <typename F>
+void JobSystem::parallelFor( unsigned int count, unsigned int grain,
+                             const F& body )
+{
+    assert( grain > 0 );
+
+    unsigned int ranges = ( count + grain - 1 ) / grain;
+    unsigned int i;
+
+    if ( ranges <= 1 || !isWorker() )
+    {
+        if ( count > 0 )
+        {
+            body( 0, count );
+        }
+
+        return;
+    }
+
+    sgdm::AllocatorGuard<Range<F>> rangeAlloc;
+    sgdm::AllocatorGuard<Job> jobAlloc;
+    Range<F>* parts = rangeAlloc.get( ranges );
+    Job* jobs = jobAlloc.get( ranges );
+    JobCounter counter( ranges - 1 );
+
+    for ( i = 0; i < ranges; ++i )
+    {
+        parts[i].body = &body;
+        parts[i].start = i * grain;
+        parts[i].end = std::min( count, ( i + 1 ) * grain );
+
+        jobs[i].function = &JobSystem::runRange<F>;
+        jobs[i].data = &parts[i];
+        jobs[i].counter = &counter;
+    }
+
+    // queue all but the first which is run here
+    run( jobs + 1, ranges - 1 );
+    body( parts[0].start, parts[0].end );
+    wait( counter );
+
+    jobAlloc.release( jobs, ranges );
+    rangeAlloc.release( parts, ranges );
+}
+
+// HELPER FUNCTIONS
+template <typename F>
+void JobSystem::runRange( void* data )
+{
+    Range<F>* range = static_cast<Range<F>*>( data );
+    ( *range->body )( range->start, range->end );
+}
+
+// GLOBAL FUNCTIONS
+inline
+JobSystem& JobSystem::inst()
+{
+    return d_instance;
+}
+
+} // End nspc sgdj
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,100 @@
+// work_stealing_deque.cpp
+#include "work_stealing_deque.h"
+
+namespace StevensDev
+{
+
+namespace sgdj
+{
+
+// CONSTANTS
+const unsigned int WorkStealingDeque::DEFAULT_CAPACITY;
+
+// MEMBER FUNCTIONS
+bool WorkStealingDeque::push( Job* job )
+{
+    long long bottom = d_bottom.load( std::memory_order_relaxed );
+    long long top = d_top.load( std::memory_order_acquire );
+
+    if ( bottom - top >= static_cast<long long>( d_capacity ) )
+    {
+        return false;
+    }
+
+    d_slots[bottom & ( d_capacity - 1 )].store( job,
+                                                std::memory_order_relaxed );
+
+    // publish the job before thieves can see the new bottom
+    std::atomic_thread_fence( std::memory_order_release );
+    d_bottom.store( bottom + 1, std::memory_order_relaxed );
+
+    return true;
+}
+
+Job* WorkStealingDeque::pop()
+{
+    long long bottom = d_bottom.load( std::memory_order_relaxed ) - 1;
+    long long top;
+    Job* job;
+
+    // claim the bottom slot before looking at what thieves have taken
+    d_bottom.store( bottom, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    top = d_top.load( std::memory_order_relaxed );
+
+    if ( top > bottom )
+    {
+        // empty
+        d_bottom.store( bottom + 1, std::memory_order_relaxed );
+        return nullptr;
+    }
+
+    job = d_slots[bottom & ( d_capacity - 1 )].load(
+        std::memory_order_relaxed );
+
+    if ( top == bottom )
+    {
+        // last job so race the thieves for it
+        if ( !d_top.compare_exchange_strong( top, top + 1,
+                                             std::memory_order_seq_cst,
+                                             std::memory_order_relaxed ) )
+        {
+            job = nullptr;
+        }
+
+        d_bottom.store( bottom + 1, std::memory_order_relaxed );
+    }
+
+    return job;
+}
+
+Job* WorkStealingDeque::steal()
+{
+    long long top = d_top.load( std::memory_order_acquire );
+    long long bottom;
+    Job* job;
+
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    bottom = d_bottom.load( std::memory_order_acquire );
+
+    if ( top >= bottom )
+    {
+        return nullptr;
+    }
+
+    job = d_slots[top & ( d_capacity - 1 )].load( std::memory_order_relaxed );
+
+    if ( !d_top.compare_exchange_strong( top, top + 1,
+                                         std::memory_order_seq_cst,
+                                         std::memory_order_relaxed ) )
+    {
+        // lost the race to another thief or the owner
+        return nullptr;
+    }
+
+    return job;
+}
+
+} // End nspc sgdj
+
+} // End nspc StevensDev
@@ -0,0 +1,142 @@
+// work_stealing_deque.h
+//
+// A bounded Chase-Lev work-stealing deque. The owning thread pushes and pops
+// jobs at the bottom without contention while any other thread may steal
+// from the top. Only the owner may call push and pop.
+#ifndef INCLUDED_WORK_STEALING_DEQUE
+#define INCLUDED_WORK_STEALING_DEQUE
+
+#include <assert.h>
+#include <atomic>
+#include "job.h"
+
+namespace StevensDev
+{
+
+namespace sgdj
+{
+
+class WorkStealingDeque
+{
+  public:
+    // CONSTANTS
+    static const unsigned int DEFAULT_CAPACITY = 1024;
+      // The default maximum number of queued jobs.
+
+  private:
+    std::atomic<Job*>* d_slots;
+      // The circular buffer of queued jobs.
+
+    unsigned int d_capacity;
+      // The number of slots which is a power of two.
+
+    std::atomic<long long> d_top;
+      // The index of the oldest job which is the next to be stolen.
+
+    std::atomic<long long> d_bottom;
+      // The index one past the newest job.
+
+    // CONSTRUCTORS
+    WorkStealingDeque( const WorkStealingDeque& deque );
+      // Constructs a copy of the given deque.
+      //
+      // Its atomic slots cannot be copied so this is disabled.
+
+    // OPERATORS
+    WorkStealingDeque& operator=( const WorkStealingDeque& deque );
+      // Makes this a copy of the given deque.
+      //
+      // Its atomic slots cannot be copied so this is disabled.
+
+  public:
+    // CONSTRUCTORS
+    WorkStealingDeque();
+      // Constructs a new empty deque with the default capacity.
+
+    WorkStealingDeque( unsigned int capacity );
+      // Constructs a new empty deque with the given capacity.
+      //
+      // Requirements:
+      // capacity is a power of two
+
+    ~WorkStealingDeque();
+      // Destructs the deque.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int capacity() const;
+      // Gets the maximum number of queued jobs.
+
+    unsigned int size() const;
+      // Gets the number of queued jobs.
+      //
+      // This is only a snapshot while other threads are stealing.
+
+    // MEMBER FUNCTIONS
+    bool push( Job* job );
+      // Adds a job to the bottom and returns false if the deque is full.
+      //
+      // Only the owning thread may push.
+
+    Job* pop();
+      // Removes the newest job or returns nullptr if the deque is empty.
+      //
+      // Only the owning thread may pop.
+
+    Job* steal();
+      // Removes the oldest job or returns nullptr if the deque is empty or
+      // another thread took it first.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream,
+                          const WorkStealingDeque& deque )
+{
+    return stream << "{ \"size\": " << deque.size()
+                  << ", \"capacity\": " << deque.capacity() << " }";
+}
+
+// CONSTRUCTORS
+inline
+WorkStealingDeque::WorkStealingDeque()
+    : d_slots( nullptr ), d_capacity( DEFAULT_CAPACITY ), d_top( 0 ),
+      d_bottom( 0 )
+{
+    d_slots = new std::atomic<Job*>[d_capacity];
+}
+
+inline
+WorkStealingDeque::WorkStealingDeque( unsigned int capacity )
+    : d_slots( nullptr ), d_capacity( capacity ), d_top( 0 ), d_bottom( 0 )
+{
+    assert( capacity > 0 && ( capacity & ( capacity - 1 ) ) == 0 );
+    d_slots = new std::atomic<Job*>[d_capacity];
+}
+
+inline
+WorkStealingDeque::~WorkStealingDeque()
+{
+    delete[] d_slots;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int WorkStealingDeque::capacity() const
+{
+    return d_capacity;
+}
+
+inline
+unsigned int WorkStealingDeque::size() const
+{
+    long long size = d_bottom.load( std::memory_order_relaxed ) -
+                     d_top.load( std::memory_order_relaxed );
+
+    return size > 0 ? static_cast<unsigned int>( size ) : 0;
+}
+
+} // End nspc sgdj
+
+} // End nspc StevensDev
+
+#endif
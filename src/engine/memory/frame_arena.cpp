@@ -0,0 +1,113 @@
+// frame_arena.cpp
+#include "frame_arena.h"
+#include <algorithm>
+
+namespace StevensDev
+{
+
+namespace sgdm
+{
+
+// CONSTANTS
+const unsigned int FrameArena::DEFAULT_BLOCK_SIZE;
+const unsigned int FrameArena::HEADER_SIZE;
+
+// CONSTRUCTORS
+FrameArena::~FrameArena()
+{
+    Block* next;
+
+    reset();
+
+    while ( d_first != nullptr )
+    {
+        next = d_first->next;
+        ::operator delete( d_first );
+        d_first = next;
+    }
+}
+
+// MEMBER FUNCTIONS
+void* FrameArena::allocate( unsigned int size, unsigned int alignment )
+{
+    assert( alignment > 0 && ( alignment & ( alignment - 1 ) ) == 0 );
+    assert( alignment <= alignof( std::max_align_t ) );
+
+    // blocks start aligned to max_align_t so offsets only need rounding
+    unsigned int start = ( d_offset + alignment - 1 ) & ~( alignment - 1 );
+    void* result;
+
+    if ( d_current == nullptr || start + size > d_current->size )
+    {
+        // move on to the next kept block unless it is too small
+        if ( d_current != nullptr && d_current->next != nullptr &&
+             d_current->next->size >= size )
+        {
+            d_current = d_current->next;
+        }
+        else if ( d_current == nullptr && d_first != nullptr &&
+                  d_first->size >= size )
+        {
+            d_current = d_first;
+        }
+        else
+        {
+            d_current = addBlock( size );
+        }
+
+        d_offset = 0;
+        start = 0;
+    }
+
+    result = memory( d_current ) + start;
+    d_used += start - d_offset + size;
+    d_offset = start + size;
+    d_highWater = std::max( d_highWater, d_used );
+
+    return result;
+}
+
+void FrameArena::reset()
+{
+    Cleanup* cleanup = d_cleanups;
+
+    // newest first so objects may refer to those made before them
+    while ( cleanup != nullptr )
+    {
+        cleanup->destroy( cleanup->object );
+        cleanup = cleanup->previous;
+    }
+
+    d_cleanups = nullptr;
+    d_current = nullptr;
+    d_offset = 0;
+    d_used = 0;
+}
+
+// HELPER FUNCTIONS
+FrameArena::Block* FrameArena::addBlock( unsigned int size )
+{
+    unsigned int blockSize = std::max( size, d_blockSize );
+    Block* block = static_cast<Block*>(
+        ::operator new( HEADER_SIZE + blockSize ) );
+
+    block->size = blockSize;
+    d_capacity += blockSize;
+
+    if ( d_current == nullptr )
+    {
+        block->next = d_first;
+        d_first = block;
+    }
+    else
+    {
+        block->next = d_current->next;
+        d_current->next = block;
+    }
+
+    return block;
+}
+
+} // End nspc sgdm
+
+} // End nspc StevensDev
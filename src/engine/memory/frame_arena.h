@@ -0,0 +1,234 @@
+// frame_arena.h
+//
+// Constructs objects of any type in large blocks of memory that are all
+// given back at once by reset. Allocating bumps an offset into the
+// current block, and reset destructs every object in the reverse order of
+// construction and starts again from the first block, which is kept, so
+// an arena that is reset every frame stops touching the heap once it has
+// grown to fit the busiest frame:
+//
+//     FrameArena arena;
+//
+//     Hit* hit = arena.create<Hit>( first, second );
+//     ...
+//     arena.reset();
+//
+// Objects are never freed one at a time and an arena is not thread-safe.
+#ifndef INCLUDED_FRAME_ARENA
+#define INCLUDED_FRAME_ARENA
+
+#include <assert.h>
+#include <cstddef>
+#include <iostream>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace StevensDev
+{
+
+namespace sgdm
+{
+
+class FrameArena
+{
+  public:
+    // CONSTANTS
+    static const unsigned int DEFAULT_BLOCK_SIZE = 64 * 1024;
+      // The number of bytes in each block unless told otherwise.
+
+  private:
+    struct Block
+    {
+        Block* next;
+          // The block used after this one is full or nullptr.
+
+        unsigned int size;
+          // The number of bytes after the header.
+    };
+
+    struct Cleanup
+    {
+        void ( *destroy )( void* object );
+          // Destructs the object.
+
+        void* object;
+          // The object to destruct.
+
+        Cleanup* previous;
+          // The cleanup of an earlier object or nullptr.
+    };
+
+    // CONSTANTS
+    static const unsigned int HEADER_SIZE =
+        ( sizeof( Block ) + alignof( std::max_align_t ) - 1 ) /
+        alignof( std::max_align_t ) * alignof( std::max_align_t );
+      // The number of bytes before the memory of each block.
+
+    // MEMBERS
+    Block* d_first;
+      // The first block or nullptr if nothing was ever allocated.
+
+    Block* d_current;
+      // The block being allocated from or nullptr.
+
+    unsigned int d_offset;
+      // The number of bytes used in the current block.
+
+    unsigned int d_blockSize;
+      // The number of bytes in each new block.
+
+    unsigned int d_used;
+      // The number of bytes allocated since the last reset.
+
+    unsigned int d_highWater;
+      // The most bytes allocated between two resets.
+
+    unsigned int d_capacity;
+      // The number of bytes in every block.
+
+    Cleanup* d_cleanups;
+      // The cleanup of the last object that needs destructing or nullptr.
+
+    // HELPER FUNCTIONS
+    template<typename T>
+    static void destroy( void* object );
+      // Destructs the object of type T.
+
+    static char* memory( Block* block );
+      // Gets the first byte after the block's header.
+
+    Block* addBlock( unsigned int size );
+      // Adds a block of at least size bytes after the current one.
+
+    // CONSTRUCTORS
+    FrameArena( const FrameArena& arena );
+      // Constructs a copy of the arena.
+
+    // OPERATORS
+    FrameArena& operator=( const FrameArena& arena );
+      // Makes this a copy of the arena.
+
+  public:
+    // CONSTRUCTORS
+    FrameArena( unsigned int blockSize = DEFAULT_BLOCK_SIZE );
+      // Constructs a new empty arena that allocates blocks of blockSize
+      // bytes as they are needed.
+
+    ~FrameArena();
+      // Destructs every object and frees every block.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int used() const;
+      // Gets the number of bytes allocated since the last reset.
+
+    unsigned int highWater() const;
+      // Gets the most bytes allocated between two resets.
+
+    unsigned int capacity() const;
+      // Gets the number of bytes in every block.
+
+    // MEMBER FUNCTIONS
+    void* allocate( unsigned int size, unsigned int alignment );
+      // Gets size bytes aligned to alignment, a power of two no greater
+      // than that of std::max_align_t, that live until the next reset.
+
+    template<typename T, typename... Args>
+    T* create( Args&&... args );
+      // Constructs a T with the arguments that lives until the next reset.
+
+    void reset();
+      // Destructs every object in the reverse order they were created in
+      // and reuses the blocks from the start.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const FrameArena& arena )
+{
+    return stream << "{ \"used\": " << arena.used()
+                  << ", \"highWater\": " << arena.highWater()
+                  << ", \"capacity\": " << arena.capacity() << " }";
+}
+
+// CONSTRUCTORS
+inline
+FrameArena::FrameArena( unsigned int blockSize )
+    : d_first( nullptr ), d_current( nullptr ), d_offset( 0 ),
+      d_blockSize( blockSize ), d_used( 0 ), d_highWater( 0 ),
+      d_capacity( 0 ), d_cleanups( nullptr )
+{
+    assert( blockSize > 0 );
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int FrameArena::used() const
+{
+    return d_used;
+}
+
+inline
+unsigned int FrameArena::highWater() const
+{
+    return d_highWater;
+}
+
+inline
+unsigned int FrameArena::capacity() const
+{
+    return d_capacity;
+}
+
+// MEMBER FUNCTIONS
+template<typename T, typename... Args>
+inline
+T* FrameArena::create( Args&&... args )
+{
+    static_assert( alignof( T ) <= alignof( std::max_align_t ),
+                   "The type is too strictly aligned for an arena." );
+
+    Cleanup* cleanup = nullptr;
+    T* object;
+
+    // the cleanup is taken first so that a throwing constructor leaves
+    // nothing to destruct
+    if ( !std::is_trivially_destructible<T>::value )
+    {
+        cleanup = static_cast<Cleanup*>(
+            allocate( sizeof( Cleanup ), alignof( Cleanup ) ) );
+    }
+
+    object = new ( allocate( sizeof( T ), alignof( T ) ) )
+        T( std::forward<Args>( args )... );
+
+    if ( cleanup != nullptr )
+    {
+        cleanup->destroy = &destroy<T>;
+        cleanup->object = object;
+        cleanup->previous = d_cleanups;
+        d_cleanups = cleanup;
+    }
+
+    return object;
+}
+
+// HELPER FUNCTIONS
+template<typename T>
+inline
+void FrameArena::destroy( void* object )
+{
+    static_cast<T*>( object )->~T();
+}
+
+inline
+char* FrameArena::memory( Block* block )
+{
+    return reinterpret_cast<char*>( block ) + HEADER_SIZE;
+}
+
+} // End nspc sgdm
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,33 @@
+// profile_buffer.cpp
+#include "profile_buffer.h"
+
+namespace StevensDev
+{
+
+namespace sgdp
+{
+
+// CONSTANTS
+const unsigned int ProfileBuffer::DEFAULT_CAPACITY;
+
+// MEMBER FUNCTIONS
+unsigned int ProfileBuffer::drain( sgdc::DynamicArray<ProfileSample>& samples )
+{
+    unsigned long long head = d_head.load( std::memory_order_acquire );
+    unsigned long long tail = d_tail.load( std::memory_order_relaxed );
+    unsigned int count = static_cast<unsigned int>( head - tail );
+
+    for ( ; tail < head; ++tail )
+    {
+        samples.push( d_samples[tail & ( d_capacity - 1 )] );
+    }
+
+    // hand the slots back to the recording thread
+    d_tail.store( head, std::memory_order_release );
+
+    return count;
+}
+
+} // End nspc sgdp
+
+} // End nspc StevensDev
@@ -0,0 +1,183 @@
+// profile_buffer.h
+//
+// A bounded single-producer single-consumer ring of profile samples. The
+// thread that owns the buffer records into it without locking while one
+// collecting thread drains it. Samples recorded while the ring is full are
+// dropped and counted rather than blocking the recording thread.
+#ifndef INCLUDED_PROFILE_BUFFER
+#define INCLUDED_PROFILE_BUFFER
+
+#include "../containers/dynamic_array.h"
+#include "../memory/allocator_guard.h"
+#include <assert.h>
+#include <atomic>
+#include "profile_sample.h"
+
+namespace StevensDev
+{
+
+namespace sgdp
+{
+
+class ProfileBuffer
+{
+  public:
+    // CONSTANTS
+    static const unsigned int DEFAULT_CAPACITY = 16384;
+      // The default maximum number of undrained samples.
+
+  private:
+    sgdm::AllocatorGuard<ProfileSample> d_alloc;
+      // Allocates the ring.
+
+    ProfileSample* d_samples;
+      // The ring of samples.
+
+    unsigned int d_capacity;
+      // The number of slots which is a power of two.
+
+    unsigned int d_thread;
+      // The index of the owning thread.
+
+    std::atomic<unsigned long long> d_head;
+      // The number of samples ever recorded.
+
+    std::atomic<unsigned long long> d_tail;
+      // The number of samples ever drained.
+
+    std::atomic<unsigned long long> d_dropped;
+      // The number of samples dropped because the ring was full.
+
+    // CONSTRUCTORS
+    ProfileBuffer( const ProfileBuffer& buffer );
+      // Buffers are shared between threads and cannot be copied.
+
+    // OPERATORS
+    ProfileBuffer& operator=( const ProfileBuffer& buffer );
+      // Buffers are shared between threads and cannot be copied.
+
+  public:
+    // CONSTRUCTORS
+    ProfileBuffer( unsigned int thread,
+                   unsigned int capacity = DEFAULT_CAPACITY );
+      // Constructs a new empty buffer for the thread.
+      //
+      // Requirements:
+      // capacity is a power of two
+
+    ~ProfileBuffer();
+      // Destructs the buffer.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int thread() const;
+      // Gets the index of the owning thread.
+
+    unsigned int capacity() const;
+      // Gets the maximum number of undrained samples.
+
+    unsigned int size() const;
+      // Gets the number of undrained samples.
+
+    unsigned long long dropped() const;
+      // Gets the number of samples dropped because the ring was full.
+
+    // MEMBER FUNCTIONS
+    bool push( const char* name, sgdk::TimePoint start, sgdk::TimePoint end,
+               unsigned int depth );
+      // Records a sample and returns false if it was dropped.
+      //
+      // Only the owning thread may push.
+
+    unsigned int drain( sgdc::DynamicArray<ProfileSample>& samples );
+      // Moves every recorded sample to the end of the array and returns
+      // how many were moved.
+      //
+      // Only one thread may drain at a time.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const ProfileBuffer& buffer )
+{
+    return stream << "{ \"thread\": " << buffer.thread()
+                  << ", \"size\": " << buffer.size()
+                  << ", \"capacity\": " << buffer.capacity()
+                  << ", \"dropped\": " << buffer.dropped() << " }";
+}
+
+// CONSTRUCTORS
+inline
+ProfileBuffer::ProfileBuffer( unsigned int thread, unsigned int capacity )
+    : d_alloc(), d_samples( nullptr ), d_capacity( capacity ),
+      d_thread( thread ), d_head( 0 ), d_tail( 0 ), d_dropped( 0 )
+{
+    assert( capacity > 0 && ( capacity & ( capacity - 1 ) ) == 0 );
+
+    d_samples = d_alloc.get( d_capacity );
+}
+
+inline
+ProfileBuffer::~ProfileBuffer()
+{
+    d_alloc.release( d_samples, d_capacity );
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int ProfileBuffer::thread() const
+{
+    return d_thread;
+}
+
+inline
+unsigned int ProfileBuffer::capacity() const
+{
+    return d_capacity;
+}
+
+inline
+unsigned int ProfileBuffer::size() const
+{
+    return static_cast<unsigned int>(
+        d_head.load( std::memory_order_acquire ) -
+        d_tail.load( std::memory_order_acquire ) );
+}
+
+inline
+unsigned long long ProfileBuffer::dropped() const
+{
+    return d_dropped.load( std::memory_order_relaxed );
+}
+
+// MEMBER FUNCTIONS
+inline
+bool ProfileBuffer::push( const char* name, sgdk::TimePoint start,
+                          sgdk::TimePoint end, unsigned int depth )
+{
+    unsigned long long head = d_head.load( std::memory_order_relaxed );
+    ProfileSample* sample;
+
+    if ( head - d_tail.load( std::memory_order_acquire ) >= d_capacity )
+    {
+        d_dropped.fetch_add( 1, std::memory_order_relaxed );
+        return false;
+    }
+
+    sample = d_samples + ( head & ( d_capacity - 1 ) );
+    sample->name = name;
+    sample->start = start;
+    sample->end = end;
+    sample->depth = depth;
+    sample->thread = d_thread;
+
+    // publish the sample before the drainer can see it
+    d_head.store( head + 1, std::memory_order_release );
+
+    return true;
+}
+
+} // End nspc sgdp
+
+} // End nspc StevensDev
+
+#endif
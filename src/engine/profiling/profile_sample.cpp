@@ -0,0 +1,2 @@
+// profile_sample.cpp
+#include "profile_sample.h"
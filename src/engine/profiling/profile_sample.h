@@ -0,0 +1,50 @@
+// profile_sample.h
+#ifndef INCLUDED_PROFILE_SAMPLE
+#define INCLUDED_PROFILE_SAMPLE
+
+#include "../time/time_units.h"
+#include <ostream>
+
+namespace StevensDev
+{
+
+namespace sgdp
+{
+
+struct ProfileSample
+{
+    const char* name;
+      // The name of the zone.
+      //
+      // This is not copied so it must outlive the capture, which string
+      // literals always do.
+
+    sgdk::TimePoint start;
+      // When the zone was entered.
+
+    sgdk::TimePoint end;
+      // When the zone was left.
+
+    unsigned int depth;
+      // The number of zones that enclosed it on its thread.
+
+    unsigned int thread;
+      // The index of the thread that recorded it.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const ProfileSample& sample )
+{
+    return stream << "{ \"name\": \"" << sample.name
+                  << "\", \"start\": " << sample.start
+                  << ", \"end\": " << sample.end
+                  << ", \"depth\": " << sample.depth
+                  << ", \"thread\": " << sample.thread << " }";
+}
+
+} // End nspc sgdp
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,2 @@
+// profile_scope.cpp
+#include "profile_scope.h"
@@ -0,0 +1,87 @@
+// profile_scope.h
+//
+// Times the enclosing scope as a profiler zone:
+//
+//     void Physics::tick( float dtS )
+//     {
+//         PROFILE_SCOPE( "Physics::tick" );
+//         ...
+//     }
+//
+// The name must be a string literal or otherwise outlive the capture.
+//
+// PROFILE_SCOPE expands to nothing unless GAME_PROFILE is defined, which
+// the build does for every build type other than release, so release
+// builds carry no profiling code at all.
+#ifndef INCLUDED_PROFILE_SCOPE
+#define INCLUDED_PROFILE_SCOPE
+
+#include "../build.g.h"
+#include "profiler.h"
+#include "../time/time_source.h"
+
+#define PROFILE_JOIN_IMPL( a, b ) a##b
+#define PROFILE_JOIN( a, b ) PROFILE_JOIN_IMPL( a, b )
+
+#ifdef GAME_PROFILE
+#define PROFILE_SCOPE( name ) \
+    StevensDev::sgdp::ProfileScope PROFILE_JOIN( profileScope, __LINE__ )( \
+        name )
+#else
+#define PROFILE_SCOPE( name )
+#endif
+
+namespace StevensDev
+{
+
+namespace sgdp
+{
+
+class ProfileScope
+{
+  private:
+    const char* d_name;
+      // The name of the zone.
+
+    sgdk::TimePoint d_start;
+      // When the zone was entered.
+
+    unsigned int d_depth;
+      // The depth of the zone.
+
+    // CONSTRUCTORS
+    ProfileScope( const ProfileScope& scope );
+      // Scopes cannot be copied.
+
+    // OPERATORS
+    ProfileScope& operator=( const ProfileScope& scope );
+      // Scopes cannot be copied.
+
+  public:
+    // CONSTRUCTORS
+    ProfileScope( const char* name );
+      // Enters the zone.
+
+    ~ProfileScope();
+      // Leaves the zone.
+};
+
+// CONSTRUCTORS
+inline
+ProfileScope::ProfileScope( const char* name )
+    : d_name( name ), d_start( sgdk::TimeSource::now() ),
+      d_depth( Profiler::inst().enter() )
+{
+}
+
+inline
+ProfileScope::~ProfileScope()
+{
+    Profiler::inst().leave( d_name, d_start, d_depth );
+}
+
+} // End nspc sgdp
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,157 @@
+// profiler.cpp
+#include "profiler.h"
+
+namespace StevensDev
+{
+
+namespace sgdp
+{
+
+namespace
+{
+
+void writeEscaped( std::ostream& stream, const char* text )
+  // Writes the text as the contents of a JSON string.
+{
+    for ( ; *text != '\0'; ++text )
+    {
+        if ( *text == '"' || *text == '\\' )
+        {
+            stream << '\\';
+        }
+
+        stream << *text;
+    }
+}
+
+} // End nspc anonymous
+
+// GLOBALS
+Profiler Profiler::d_instance = Profiler();
+
+thread_local ProfileBuffer* Profiler::d_buffer = nullptr;
+
+thread_local unsigned int Profiler::d_depth = 0;
+
+// CONSTRUCTORS
+Profiler::~Profiler()
+{
+    unsigned int i;
+
+    for ( i = 0; i < d_buffers.size(); ++i )
+    {
+        delete d_buffers[i];
+    }
+}
+
+// ACCESSOR FUNCTIONS
+unsigned int Profiler::size()
+{
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    return d_capture.size();
+}
+
+ProfileSample Profiler::sample( unsigned int index )
+{
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    assert( index < d_capture.size() );
+
+    return d_capture[index];
+}
+
+unsigned int Profiler::threads()
+{
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    return d_buffers.size();
+}
+
+unsigned long long Profiler::dropped()
+{
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    unsigned long long dropped = 0;
+    unsigned int i;
+
+    for ( i = 0; i < d_buffers.size(); ++i )
+    {
+        dropped += d_buffers[i]->dropped();
+    }
+
+    return dropped;
+}
+
+// MEMBER FUNCTIONS
+void Profiler::start()
+{
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    // throw away anything recorded before this capture
+    sgdc::DynamicArray<ProfileSample> stale;
+    unsigned int i;
+
+    for ( i = 0; i < d_buffers.size(); ++i )
+    {
+        d_buffers[i]->drain( stale );
+    }
+
+    d_capture = sgdc::DynamicArray<ProfileSample>();
+    d_captureStart = sgdk::TimeSource::now();
+    d_isCapturing.store( true, std::memory_order_relaxed );
+}
+
+void Profiler::stop()
+{
+    d_isCapturing.store( false, std::memory_order_relaxed );
+    collect();
+}
+
+void Profiler::collect()
+{
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    unsigned int i;
+
+    for ( i = 0; i < d_buffers.size(); ++i )
+    {
+        d_buffers[i]->drain( d_capture );
+    }
+}
+
+void Profiler::writeChromeTrace( std::ostream& stream )
+{
+    collect();
+
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    unsigned int i;
+
+    stream << "{\"traceEvents\":[";
+
+    for ( i = 0; i < d_capture.size(); ++i )
+    {
+        const ProfileSample& sample = d_capture[i];
+
+        // complete events with microsecond times since the capture started
+        stream << ( i > 0 ? ",\n" : "\n" ) << "{\"name\":\"";
+        writeEscaped( stream, sample.name );
+        stream << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << sample.thread
+               << ",\"ts\":"
+               << sgdk::TimeUnits::toMicroseconds(
+                      static_cast<sgdk::Duration>(
+                          sample.start - d_captureStart ) )
+               << ",\"dur\":"
+               << sgdk::TimeUnits::toMicroseconds(
+                      static_cast<sgdk::Duration>(
+                          sample.end - sample.start ) )
+               << "}";
+    }
+
+    stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+} // End nspc sgdp
+
+} // End nspc StevensDev
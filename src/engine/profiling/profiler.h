@@ -0,0 +1,193 @@
+// profiler.h
+//
+// Collects the zones recorded by every thread into a capture that can be
+// written as Chrome trace event JSON and opened in chrome://tracing or
+// Perfetto.
+//
+// Each thread records into its own ProfileBuffer, created the first time
+// it records, so recording never takes a lock. The buffers are drained
+// into the capture by collect, which the scene calls once per frame.
+// Zones are only recorded between start and stop.
+#ifndef INCLUDED_PROFILER
+#define INCLUDED_PROFILER
+
+#include "../containers/dynamic_array.h"
+#include <atomic>
+#include <mutex>
+#include "profile_buffer.h"
+#include "profile_sample.h"
+#include "../time/time_source.h"
+
+namespace StevensDev
+{
+
+namespace sgdp
+{
+
+class Profiler
+{
+  private:
+    // GLOBALS
+    static Profiler d_instance;
+      // The singleton instance.
+
+    static thread_local ProfileBuffer* d_buffer;
+      // The calling thread's buffer or nullptr if it has not recorded.
+
+    static thread_local unsigned int d_depth;
+      // The number of zones the calling thread is inside.
+
+    // MEMBERS
+    sgdc::DynamicArray<ProfileBuffer*> d_buffers;
+      // The buffer of every thread that has recorded.
+
+    sgdc::DynamicArray<ProfileSample> d_capture;
+      // The samples collected since the capture started.
+
+    std::mutex d_mutex;
+      // Guards the buffers and the capture.
+
+    std::atomic<bool> d_isCapturing;
+      // If zones are being recorded.
+
+    sgdk::TimePoint d_captureStart;
+      // When the capture started.
+
+    // CONSTRUCTORS
+    Profiler();
+      // Constructs a new profiler.
+
+    Profiler( const Profiler& profiler );
+      // Constructs a copy of the given profiler.
+      //
+      // Mutexes cannot be copied so this is disabled.
+
+    // OPERATORS
+    Profiler& operator=( const Profiler& profiler );
+      // Makes this a copy of the given profiler.
+      //
+      // Mutexes cannot be copied so this is disabled.
+
+    // HELPER FUNCTIONS
+    ProfileBuffer* buffer();
+      // Gets the calling thread's buffer, creating it if needed.
+
+  public:
+    // CONSTRUCTORS
+    ~Profiler();
+      // Destructs the profiler and every thread's buffer.
+
+    // ACCESSOR FUNCTIONS
+    bool isCapturing() const;
+      // Checks if zones are being recorded.
+
+    unsigned int size();
+      // Gets the number of collected samples.
+
+    ProfileSample sample( unsigned int index );
+      // Gets a collected sample.
+
+    unsigned int threads();
+      // Gets the number of threads that have recorded.
+
+    unsigned long long dropped();
+      // Gets the number of samples dropped because a buffer was full.
+
+    // MEMBER FUNCTIONS
+    void start();
+      // Discards the previous capture and starts recording zones.
+
+    void stop();
+      // Stops recording zones and collects what was recorded.
+
+    unsigned int enter();
+      // Enters a zone on the calling thread and returns its depth.
+
+    void leave( const char* name, sgdk::TimePoint start,
+                unsigned int depth );
+      // Leaves the zone that was entered at the start time and records it
+      // if capturing.
+
+    void collect();
+      // Moves every sample recorded so far into the capture.
+
+    void writeChromeTrace( std::ostream& stream );
+      // Collects and then writes the capture as Chrome trace event JSON.
+
+    // GLOBAL FUNCTIONS
+    static Profiler& inst();
+      // Gets the profiler.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, Profiler& profiler )
+{
+    return stream << "{ \"isCapturing\": "
+                  << ( profiler.isCapturing() ? "true" : "false" )
+                  << ", \"size\": " << profiler.size()
+                  << ", \"threads\": " << profiler.threads()
+                  << ", \"dropped\": " << profiler.dropped() << " }";
+}
+
+// CONSTRUCTORS
+inline
+Profiler::Profiler()
+    : d_buffers(), d_capture(), d_mutex(), d_isCapturing( false ),
+      d_captureStart( 0 )
+{
+}
+
+// ACCESSOR FUNCTIONS
+inline
+bool Profiler::isCapturing() const
+{
+    return d_isCapturing.load( std::memory_order_relaxed );
+}
+
+// MEMBER FUNCTIONS
+inline
+unsigned int Profiler::enter()
+{
+    return d_depth++;
+}
+
+inline
+void Profiler::leave( const char* name, sgdk::TimePoint start,
+                      unsigned int depth )
+{
+    d_depth = depth;
+
+    if ( isCapturing() )
+    {
+        buffer()->push( name, start, sgdk::TimeSource::now(), depth );
+    }
+}
+
+// HELPER FUNCTIONS
+inline
+ProfileBuffer* Profiler::buffer()
+{
+    if ( d_buffer == nullptr )
+    {
+        std::lock_guard<std::mutex> lock( d_mutex );
+
+        d_buffer = new ProfileBuffer( d_buffers.size() );
+        d_buffers.push( d_buffer );
+    }
+
+    return d_buffer;
+}
+
+// GLOBAL FUNCTIONS
+inline
+Profiler& Profiler::inst()
+{
+    return d_instance;
+}
+
+} // End nspc sgdp
+
+} // End nspc StevensDev
+
+#endif
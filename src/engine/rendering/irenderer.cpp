@@ -0,0 +1,2 @@
+// irenderer.cpp
+#include "irenderer.h"
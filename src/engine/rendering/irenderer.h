@@ -0,0 +1,54 @@
+// irenderer.h
+#ifndef INCLUDED_IRENDERER
+#define INCLUDED_IRENDERER
+
+namespace StevensDev
+{
+
+namespace sgdr
+{
+
+class RenderableSprite;
+
+class IRenderer
+{
+  public:
+    // CONSTRUCTORS
+    virtual ~IRenderer() = 0;
+      // Destructs the renderer.
+
+    // ACCESSOR FUNCTIONS
+    virtual unsigned int width() const = 0;
+      // Gets the width of the drawn area in pixels.
+
+    virtual unsigned int height() const = 0;
+      // Gets the height of the drawn area in pixels.
+
+    virtual bool isActive() const = 0;
+      // Checks if the renderer can still draw.
+
+    // MEMBER FUNCTIONS
+    virtual void draw( float alpha ) = 0;
+      // Draws all of the sprites for a frame that is alpha of the way
+      // between the previous and current simulation steps.
+      //
+      // Sprites only know their current position so they are drawn there
+      // and alpha is only recorded.
+
+    virtual void addSprite( const RenderableSprite* sprite ) = 0;
+      // Adds a sprite to the drawn list.
+
+    virtual void removeSprite( const RenderableSprite* sprite ) = 0;
+      // Removes a sprite from the drawn list.
+};
+
+inline
+IRenderer::~IRenderer()
+{
+}
+
+} // End nspc sgdr
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,2 @@
+// null_renderer.cpp
+#include "null_renderer.h"
@@ -0,0 +1,216 @@
+// null_renderer.h
+//
+// A renderer that never opens a window so the simulation can run on
+// machines without a display. It keeps the sprite list and counts frames
+// like a real renderer but draws nothing and stays active until it is
+// closed.
+#ifndef INCLUDED_NULL_RENDERER
+#define INCLUDED_NULL_RENDERER
+
+#include "../containers/dynamic_array.h"
+#include <assert.h>
+#include "irenderer.h"
+#include <ostream>
+
+namespace StevensDev
+{
+
+namespace sgdr
+{
+
+class NullRenderer : public IRenderer
+{
+  private:
+    // MEMBERS
+    sgdc::DynamicArray<const RenderableSprite*> d_sprites;
+      // The sprites that would be drawn.
+
+    unsigned int d_width;
+      // The width of the pretend window in pixels.
+
+    unsigned int d_height;
+      // The height of the pretend window in pixels.
+
+    unsigned long long d_frames;
+      // The number of frames drawn.
+
+    float d_alpha;
+      // The interpolation of the last drawn frame.
+
+    bool d_isActive;
+      // If it has not been closed.
+
+  public:
+    // CONSTRUCTORS
+    NullRenderer();
+      // Constructs a new active renderer without any size.
+
+    NullRenderer( unsigned int width, unsigned int height );
+      // Constructs a new active renderer that pretends to have a window of
+      // the given size.
+
+    NullRenderer( const NullRenderer& renderer );
+      // Constructs a copy of the renderer.
+
+    virtual ~NullRenderer();
+      // Destructs the renderer.
+
+    // OPERATORS
+    NullRenderer& operator=( const NullRenderer& renderer );
+      // Makes this a copy of the renderer.
+
+    // ACCESSOR FUNCTIONS
+    virtual unsigned int width() const;
+      // Gets the width of the pretend window in pixels.
+
+    virtual unsigned int height() const;
+      // Gets the height of the pretend window in pixels.
+
+    virtual bool isActive() const;
+      // Checks if the renderer has not been closed.
+
+    unsigned int sprites() const;
+      // Gets the number of sprites that would be drawn.
+
+    unsigned long long frames() const;
+      // Gets the number of frames drawn.
+
+    float interpolation() const;
+      // Gets the interpolation of the last drawn frame.
+
+    // MEMBER FUNCTIONS
+    virtual void draw( float alpha );
+      // Counts the frame.
+
+    virtual void addSprite( const RenderableSprite* sprite );
+      // Adds a sprite to the drawn list.
+
+    virtual void removeSprite( const RenderableSprite* sprite );
+      // Removes a sprite from the drawn list.
+
+    void close();
+      // Stops the renderer as if its window was closed.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream,
+                          const NullRenderer& renderer )
+{
+    return stream << "{ \"isActive\": "
+                  << ( renderer.isActive() ? "true" : "false" )
+                  << ", \"frames\": " << renderer.frames() << " }";
+}
+
+// CONSTRUCTORS
+inline
+NullRenderer::NullRenderer() : d_sprites(), d_width( 0 ), d_height( 0 ),
+                               d_frames( 0 ), d_alpha( 1.0f ),
+                               d_isActive( true )
+{
+}
+
+inline
+NullRenderer::NullRenderer( unsigned int width, unsigned int height )
+    : d_sprites(), d_width( width ), d_height( height ), d_frames( 0 ),
+      d_alpha( 1.0f ), d_isActive( true )
+{
+}
+
+inline
+NullRenderer::NullRenderer( const NullRenderer& renderer )
+    : d_sprites( renderer.d_sprites ), d_width( renderer.d_width ),
+      d_height( renderer.d_height ), d_frames( renderer.d_frames ),
+      d_alpha( renderer.d_alpha ), d_isActive( renderer.d_isActive )
+{
+}
+
+inline
+NullRenderer::~NullRenderer()
+{
+}
+
+// OPERATORS
+inline
+NullRenderer& NullRenderer::operator=( const NullRenderer& renderer )
+{
+    d_sprites = renderer.d_sprites;
+    d_width = renderer.d_width;
+    d_height = renderer.d_height;
+    d_frames = renderer.d_frames;
+    d_alpha = renderer.d_alpha;
+    d_isActive = renderer.d_isActive;
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int NullRenderer::width() const
+{
+    return d_width;
+}
+
+inline
+unsigned int NullRenderer::height() const
+{
+    return d_height;
+}
+
+inline
+bool NullRenderer::isActive() const
+{
+    return d_isActive;
+}
+
+inline
+unsigned int NullRenderer::sprites() const
+{
+    return d_sprites.size();
+}
+
+inline
+unsigned long long NullRenderer::frames() const
+{
+    return d_frames;
+}
+
+inline
+float NullRenderer::interpolation() const
+{
+    return d_alpha;
+}
+
+// MEMBER FUNCTIONS
+inline
+void NullRenderer::draw( float alpha )
+{
+    assert( alpha >= 0 && alpha <= 1 );
+
+    d_alpha = alpha;
+    ++d_frames;
+}
+
+inline
+void NullRenderer::addSprite( const RenderableSprite* sprite )
+{
+    d_sprites.push( sprite );
+}
+
+inline
+void NullRenderer::removeSprite( const RenderableSprite* sprite )
+{
+    d_sprites.remove( sprite );
+}
+
+inline
+void NullRenderer::close()
+{
+    d_isActive = false;
+}
+
+} // End nspc sgdr
+
+} // End nspc StevensDev
+
+#endif
@@ -1,9 +1,16 @@
 // renderer.cpp
 #include "renderer.h"
+#include "../profiling/profile_scope.h"
 #include <SFML/Window/Event.hpp>
 
-void StevensDev::sgdr::Renderer::draw()
+const unsigned int StevensDev::sgdr::Renderer::DEFAULT_FRAMERATE_LIMIT;
+
+void StevensDev::sgdr::Renderer::draw( float alpha )
 {
+    PROFILE_SCOPE( "Renderer::draw" );
+
+    assert( alpha >= 0 && alpha <= 1 );
+    d_alpha = alpha;
 
     // draw sprites
     d_window.clear( sf::Color::Black );
@@ -37,7 +44,17 @@ void StevensDev::sgdr::Renderer::setupWindow( int width, int height )
     d_window.create( sf::VideoMode( static_cast<unsigned int>( width ),
                                     static_cast<unsigned int>( height ) ),
                      "Game" );
-    d_window.setFramerateLimit( 60 );
+    d_window.setFramerateLimit( d_framerateLimit );
+}
+
+void StevensDev::sgdr::Renderer::setFramerateLimit( unsigned int limit )
+{
+    d_framerateLimit = limit;
+
+    if ( d_window.isOpen() )
+    {
+        d_window.setFramerateLimit( d_framerateLimit );
+    }
 }
 
 bool StevensDev::sgdr::Renderer::loadTexture( const std::string& name,
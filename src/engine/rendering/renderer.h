@@ -10,6 +10,7 @@
 #define INCLUDED_RENDERER
 #include "../containers/dynamic_array.h"
 #include "../containers/map.h"
+#include "irenderer.h"
 #include "renderable_sprite.h"
 #include <SFML/Graphics/RenderWindow.hpp>
 
@@ -19,8 +20,13 @@ namespace StevensDev
 namespace sgdr
 {
 
-class Renderer
+class Renderer : public IRenderer
 {
+  public:
+    // CONSTANTS
+    static const unsigned int DEFAULT_FRAMERATE_LIMIT = 60;
+      // The default maximum number of frames drawn per second.
+
   private:
     sgdc::DynamicArray<const RenderableSprite*> d_sprites;
       // The set of sprites to be rendered.
@@ -31,6 +37,14 @@ class Renderer
     sf::RenderWindow d_window;
       // The window that is being rendered to.
 
+    unsigned int d_framerateLimit;
+      // The maximum number of frames drawn per second or zero if
+      // unlimited.
+
+    float d_alpha;
+      // How far the last drawn frame was between the previous and current
+      // simulation steps.
+
   public:
     // CONSTRUCTORS
     Renderer();
@@ -42,7 +56,7 @@ class Renderer
     Renderer( Renderer&& renderer );
       // Moves a renderer to a new instance.
 
-    ~Renderer();
+    virtual ~Renderer();
       // Destructs a renderer.
 
     // OPERATORS
@@ -53,32 +67,49 @@ class Renderer
       // Moves the other renderer to this instance.
 
     // ACCESSOR FUNCTIONS
-    unsigned int width() const;
+    virtual unsigned int width() const;
       // Gets the window width.
 
-    unsigned int height() const;
+    virtual unsigned int height() const;
       // Gets the window height.
 
+    unsigned int framerateLimit() const;
+      // Gets the maximum number of frames drawn per second or zero if
+      // unlimited.
+
+    float interpolation() const;
+      // Gets how far in [0, 1] the frame being drawn is between the
+      // previous and current simulation steps.
+
     // MEMBER FUNCTIONS
     void draw();
       // Draw all of the sprites.
 
-    void addSprite( const RenderableSprite* sprite );
+    virtual void draw( float alpha );
+      // Draw all of the sprites at their current positions and record how
+      // far the frame is between the previous and current simulation
+      // steps.
+
+    virtual void addSprite( const RenderableSprite* sprite );
       // Adds a sprite from the rendered list.
 
-    void removeSprite( const RenderableSprite* sprite );
+    virtual void removeSprite( const RenderableSprite* sprite );
       // Removes a sprite from the rendered list.
 
     void setupWindow( int width, int height );
       // Sets up the renderer for the given window size.
 
+    void setFramerateLimit( unsigned int limit );
+      // Sets the maximum number of frames drawn per second or zero if
+      // unlimited.
+
     bool loadTexture( const std::string& name, const std::string& path );
       // Loads a texture and returns if it was found.
 
     const sf::Texture& getTexture( const std::string& name );
       // Gets the texture with the specified name.
 
-    bool isActive() const;
+    virtual bool isActive() const;
       // Whether or not there is an associated window.
 };
 
@@ -94,13 +125,17 @@ std::ostream& operator<<( std::ostream& stream,
 
 // CONSTRUCTORS
 inline
-Renderer::Renderer() : d_sprites(), d_window()
+Renderer::Renderer() : d_sprites(), d_window(),
+                       d_framerateLimit( DEFAULT_FRAMERATE_LIMIT ),
+                       d_alpha( 1.0f )
 {
 }
 
 inline
 Renderer::Renderer( const Renderer& renderer )
-    : d_sprites( renderer.d_sprites )
+    : d_sprites( renderer.d_sprites ),
+      d_framerateLimit( renderer.d_framerateLimit ),
+      d_alpha( renderer.d_alpha )
 {
     if ( renderer.isActive() )
     {
@@ -111,7 +146,9 @@ Renderer::Renderer( const Renderer& renderer )
 
 inline
 Renderer::Renderer( Renderer&& renderer )
-    : d_sprites( std::move( renderer.d_sprites ) )
+    : d_sprites( std::move( renderer.d_sprites ) ),
+      d_framerateLimit( renderer.d_framerateLimit ),
+      d_alpha( renderer.d_alpha )
 {
     if ( renderer.isActive() )
     {
@@ -136,6 +173,8 @@ Renderer& Renderer::operator=( const Renderer& renderer )
     }
 
     d_sprites = renderer.d_sprites;
+    d_framerateLimit = renderer.d_framerateLimit;
+    d_alpha = renderer.d_alpha;
 
     if ( renderer.isActive() )
     {
@@ -155,6 +194,8 @@ Renderer& Renderer::operator=( Renderer&& renderer )
     }
 
     d_sprites = std::move( renderer.d_sprites );
+    d_framerateLimit = renderer.d_framerateLimit;
+    d_alpha = renderer.d_alpha;
 
     if ( renderer.isActive() )
     {
@@ -178,7 +219,25 @@ unsigned int Renderer::height() const
     return d_window.getSize().y;
 }
 
+inline
+unsigned int Renderer::framerateLimit() const
+{
+    return d_framerateLimit;
+}
+
+inline
+float Renderer::interpolation() const
+{
+    return d_alpha;
+}
+
 // MEMBER FUNCTIONS
+inline
+void Renderer::draw()
+{
+    draw( 1.0f );
+}
+
 inline
 void Renderer::addSprite( const RenderableSprite* sprite )
 {
@@ -0,0 +1,316 @@
+// frame_log.cpp
+#include "frame_log.h"
+#include <cstring>
+
+namespace StevensDev
+{
+
+namespace sgdl
+{
+
+namespace
+{
+
+// CONSTANTS
+const char MAGIC[] = { 'G', 'R', 'E', 'C' };
+  // The bytes that start every log.
+
+const unsigned int MAX_INPUTS = 1 << 16;
+  // The most inputs in each poll that a log is read with.
+
+const unsigned int MAX_TYPE_LENGTH = 1 << 12;
+  // The longest event type name that a log is read with.
+
+// HELPER FUNCTIONS
+void writeVarint( std::ostream& stream, unsigned int value )
+{
+    // seven bits at a time with the high bit set on all but the last
+    while ( value >= 0x80 )
+    {
+        stream.put( static_cast<char>( ( value & 0x7f ) | 0x80 ) );
+        value >>= 7;
+    }
+
+    stream.put( static_cast<char>( value ) );
+}
+
+bool readVarint( std::istream& stream, unsigned int* value )
+{
+    unsigned int shift;
+    int byte;
+
+    *value = 0;
+    for ( shift = 0; shift < 35; shift += 7 )
+    {
+        byte = stream.get();
+        if ( byte == std::char_traits<char>::eof() )
+        {
+            return false;
+        }
+
+        *value |= static_cast<unsigned int>( byte & 0x7f ) << shift;
+        if ( ( byte & 0x80 ) == 0 )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // End nspc anonymous
+
+// CONSTANTS
+const unsigned char FrameLog::VERSION;
+
+// CONSTRUCTORS
+FrameLog::FrameLog( unsigned int inputCount )
+    : d_inputCount( inputCount ), d_frames(), d_polls(), d_changes(),
+      d_events(), d_types(), d_typeIds(), d_states()
+{
+    unsigned int i;
+
+    for ( i = 0; i < inputCount; ++i )
+    {
+        d_states.push( false );
+    }
+}
+
+// ACCESSOR FUNCTIONS
+void FrameLog::applyPoll( unsigned int frame, unsigned int poll,
+                          bool* isDown ) const
+{
+    assert( poll < d_frames[frame].polls );
+
+    const Poll& changes = d_polls[d_frames[frame].firstPoll + poll];
+    unsigned int i;
+
+    for ( i = 0; i < changes.changes; ++i )
+    {
+        bool& state = isDown[d_changes[changes.firstChange + i]];
+
+        state = !state;
+    }
+}
+
+// MEMBER FUNCTIONS
+void FrameLog::addPoll( const bool* isDown )
+{
+    Poll poll;
+    unsigned int i;
+
+    poll.firstChange = d_changes.size();
+    poll.changes = 0;
+
+    for ( i = 0; i < d_inputCount; ++i )
+    {
+        if ( isDown[i] != d_states[i] )
+        {
+            d_states[i] = isDown[i];
+            d_changes.push( i );
+            ++poll.changes;
+        }
+    }
+
+    d_polls.push( poll );
+}
+
+void FrameLog::addEvent( const std::string& type )
+{
+    if ( !d_typeIds.has( type ) )
+    {
+        d_typeIds[type] = d_types.size();
+        d_types.push( type );
+    }
+
+    d_events.push( d_typeIds[type] );
+}
+
+void FrameLog::endFrame( float dtS )
+{
+    Frame frame;
+
+    frame.dt = dtS;
+    frame.firstPoll = 0;
+    frame.firstEvent = 0;
+
+    if ( d_frames.size() > 0 )
+    {
+        const Frame& last = d_frames[d_frames.size() - 1];
+
+        frame.firstPoll = last.firstPoll + last.polls;
+        frame.firstEvent = last.firstEvent + last.events;
+    }
+
+    frame.polls = d_polls.size() - frame.firstPoll;
+    frame.events = d_events.size() - frame.firstEvent;
+
+    d_frames.push( frame );
+}
+
+void FrameLog::clear()
+{
+    *this = FrameLog( d_inputCount );
+}
+
+void FrameLog::write( std::ostream& stream ) const
+{
+    unsigned int frames = d_frames.size();
+    unsigned int previous;
+    unsigned int i;
+    unsigned int j;
+    unsigned int k;
+    char dt[sizeof( float )];
+
+    stream.write( MAGIC, sizeof( MAGIC ) );
+    stream.put( static_cast<char>( VERSION ) );
+    writeVarint( stream, d_inputCount );
+
+    writeVarint( stream, d_types.size() );
+    for ( i = 0; i < d_types.size(); ++i )
+    {
+        writeVarint( stream, d_types[i].size() );
+        stream.write( d_types[i].data(), d_types[i].size() );
+    }
+
+    writeVarint( stream, frames );
+    for ( i = 0; i < frames; ++i )
+    {
+        const Frame& frame = d_frames[i];
+
+        std::memcpy( dt, &frame.dt, sizeof( float ) );
+        stream.write( dt, sizeof( float ) );
+
+        writeVarint( stream, frame.polls );
+        for ( j = 0; j < frame.polls; ++j )
+        {
+            const Poll& poll = d_polls[frame.firstPoll + j];
+
+            // indices increase so only the gap to the previous is kept
+            writeVarint( stream, poll.changes );
+            for ( k = 0, previous = 0; k < poll.changes; ++k )
+            {
+                writeVarint( stream,
+                             d_changes[poll.firstChange + k] - previous );
+                previous = d_changes[poll.firstChange + k];
+            }
+        }
+
+        writeVarint( stream, frame.events );
+        for ( j = 0; j < frame.events; ++j )
+        {
+            writeVarint( stream, d_events[frame.firstEvent + j] );
+        }
+    }
+}
+
+bool FrameLog::read( std::istream& stream )
+{
+    char magic[sizeof( MAGIC )];
+    char dt[sizeof( float )];
+    unsigned int inputCount;
+    unsigned int count;
+    unsigned int frames;
+    unsigned int polls;
+    unsigned int changes;
+    unsigned int events;
+    unsigned int value;
+    unsigned int input;
+    unsigned int i;
+    unsigned int j;
+    unsigned int k;
+    float dtS;
+
+    *this = FrameLog();
+
+    if ( !stream.read( magic, sizeof( magic ) ) ||
+         std::memcmp( magic, MAGIC, sizeof( MAGIC ) ) != 0 ||
+         stream.get() != VERSION ||
+         !readVarint( stream, &inputCount ) || inputCount > MAX_INPUTS )
+    {
+        return false;
+    }
+
+    FrameLog log( inputCount );
+    bool* isDown = new bool[inputCount > 0 ? inputCount : 1];
+    bool isValid = readVarint( stream, &count );
+
+    // sizes are checked before anything is allocated for them
+    for ( i = 0; isValid && i < count; ++i )
+    {
+        isValid = readVarint( stream, &value ) && value <= MAX_TYPE_LENGTH;
+        if ( isValid )
+        {
+            std::string type( value, '\0' );
+
+            isValid = value == 0 ||
+                      stream.read( &type[0], value ).good();
+            log.d_typeIds[type] = log.d_types.size();
+            log.d_types.push( type );
+        }
+    }
+
+    // polls are rebuilt from their changes so the states stay consistent
+    for ( i = 0; i < inputCount; ++i )
+    {
+        isDown[i] = false;
+    }
+
+    isValid = isValid && readVarint( stream, &frames );
+    for ( i = 0; isValid && i < frames; ++i )
+    {
+        isValid = stream.read( dt, sizeof( float ) ) &&
+                  readVarint( stream, &polls );
+        std::memcpy( &dtS, dt, sizeof( float ) );
+
+        for ( j = 0; isValid && j < polls; ++j )
+        {
+            isValid = readVarint( stream, &changes );
+            for ( k = 0, input = 0; isValid && k < changes; ++k )
+            {
+                isValid = readVarint( stream, &value );
+                input += value;
+                isValid = isValid && input < inputCount &&
+                          ( k == 0 || value > 0 );
+                if ( isValid )
+                {
+                    isDown[input] = !isDown[input];
+                }
+            }
+
+            if ( isValid )
+            {
+                log.addPoll( isDown );
+            }
+        }
+
+        isValid = isValid && readVarint( stream, &events );
+        for ( j = 0; isValid && j < events; ++j )
+        {
+            isValid = readVarint( stream, &value ) &&
+                      value < log.d_types.size();
+            if ( isValid )
+            {
+                log.d_events.push( value );
+            }
+        }
+
+        if ( isValid )
+        {
+            log.endFrame( dtS );
+        }
+    }
+
+    delete[] isDown;
+
+    if ( isValid )
+    {
+        *this = log;
+    }
+
+    return isValid;
+}
+
+} // End nspc sgdl
+
+} // End nspc StevensDev
@@ -0,0 +1,248 @@
+// frame_log.h
+//
+// A recording of what a scene saw on each frame: the time it was ticked
+// with, the input states it polled and the types of the events that were
+// dispatched. It is written during play by a Recorder and read back by a
+// Replayer to run the same frames again.
+//
+// Input polls only keep the inputs that changed since the previous poll
+// and event types are kept once in a table, so a frame where nothing
+// happens costs a handful of bytes. The binary form is:
+//
+//     "GREC" version inputCount
+//     typeCount { length bytes }...
+//     frameCount { dt polls { changes { index delta }... }...
+//                  events { type }... }...
+//
+// where every count, index and type is an unsigned LEB128 varint and dt
+// is a 32-bit float in the byte order of the machine that wrote it.
+#ifndef INCLUDED_FRAME_LOG
+#define INCLUDED_FRAME_LOG
+
+#include "../containers/dynamic_array.h"
+#include "../containers/map.h"
+#include <assert.h>
+#include <iostream>
+#include <string>
+
+namespace StevensDev
+{
+
+namespace sgdl
+{
+
+class FrameLog
+{
+  private:
+    struct Frame
+    {
+        float dt;
+          // The time in seconds that the scene was ticked with.
+
+        unsigned int firstPoll;
+          // The first of the frame's polls.
+
+        unsigned int polls;
+          // The number of times that input was polled.
+
+        unsigned int firstEvent;
+          // The first of the frame's events.
+
+        unsigned int events;
+          // The number of events that were dispatched.
+    };
+
+    struct Poll
+    {
+        unsigned int firstChange;
+          // The first of the poll's changed inputs.
+
+        unsigned int changes;
+          // The number of inputs that changed since the previous poll.
+    };
+
+    // CONSTANTS
+    static const unsigned char VERSION = 1;
+      // The version of the binary form.
+
+    // MEMBERS
+    unsigned int d_inputCount;
+      // The number of inputs in each poll.
+
+    sgdc::DynamicArray<Frame> d_frames;
+      // The finished frames.
+
+    sgdc::DynamicArray<Poll> d_polls;
+      // The polls of every frame including the unfinished one.
+
+    sgdc::DynamicArray<unsigned int> d_changes;
+      // The inputs that changed in each poll in increasing order.
+
+    sgdc::DynamicArray<unsigned int> d_events;
+      // The type of each dispatched event.
+
+    sgdc::DynamicArray<std::string> d_types;
+      // The event types by their identifiers.
+
+    sgdc::Map<unsigned int> d_typeIds;
+      // The identifier of each event type.
+
+    sgdc::DynamicArray<bool> d_states;
+      // The input states as of the last added poll.
+
+  public:
+    // CONSTRUCTORS
+    FrameLog();
+      // Constructs a new empty log without any inputs.
+
+    FrameLog( unsigned int inputCount );
+      // Constructs a new empty log whose polls have the number of inputs.
+
+    FrameLog( const FrameLog& log );
+      // Constructs a copy of the log.
+
+    ~FrameLog();
+      // Destructs the log.
+
+    // OPERATORS
+    FrameLog& operator=( const FrameLog& log );
+      // Makes this a copy of the log.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int inputCount() const;
+      // Gets the number of inputs in each poll.
+
+    unsigned int frames() const;
+      // Gets the number of finished frames.
+
+    float dt( unsigned int frame ) const;
+      // Gets the time in seconds that the frame was ticked with.
+
+    unsigned int polls( unsigned int frame ) const;
+      // Gets the number of times that input was polled during the frame.
+
+    void applyPoll( unsigned int frame, unsigned int poll,
+                    bool* isDown ) const;
+      // Turns the states of the previous poll into those of the poll.
+      //
+      // Requirements:
+      // isDown holds inputCount states
+
+    unsigned int events( unsigned int frame ) const;
+      // Gets the number of events that were dispatched during the frame.
+
+    const std::string& event( unsigned int frame, unsigned int i ) const;
+      // Gets the type of the ith event that was dispatched during the
+      // frame.
+
+    // MEMBER FUNCTIONS
+    void addPoll( const bool* isDown );
+      // Adds a poll of inputCount states to the unfinished frame.
+
+    void addEvent( const std::string& type );
+      // Adds a dispatched event to the unfinished frame.
+
+    void endFrame( float dtS );
+      // Finishes the frame that was ticked with dtS seconds.
+
+    void clear();
+      // Removes every frame and starts again with every input up.
+
+    void write( std::ostream& stream ) const;
+      // Writes the finished frames in binary form.
+
+    bool read( std::istream& stream );
+      // Replaces the log with one read in binary form and returns false,
+      // leaving the log empty, if the stream does not hold one.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const FrameLog& log )
+{
+    return stream << "{ \"inputs\": " << log.inputCount()
+                  << ", \"frames\": " << log.frames() << " }";
+}
+
+// CONSTRUCTORS
+inline
+FrameLog::FrameLog() : d_inputCount( 0 ), d_frames(), d_polls(),
+                       d_changes(), d_events(), d_types(), d_typeIds(),
+                       d_states()
+{
+}
+
+inline
+FrameLog::FrameLog( const FrameLog& log )
+    : d_inputCount( log.d_inputCount ), d_frames( log.d_frames ),
+      d_polls( log.d_polls ), d_changes( log.d_changes ),
+      d_events( log.d_events ), d_types( log.d_types ),
+      d_typeIds( log.d_typeIds ), d_states( log.d_states )
+{
+}
+
+inline
+FrameLog::~FrameLog()
+{
+}
+
+// OPERATORS
+inline
+FrameLog& FrameLog::operator=( const FrameLog& log )
+{
+    d_inputCount = log.d_inputCount;
+    d_frames = log.d_frames;
+    d_polls = log.d_polls;
+    d_changes = log.d_changes;
+    d_events = log.d_events;
+    d_types = log.d_types;
+    d_typeIds = log.d_typeIds;
+    d_states = log.d_states;
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int FrameLog::inputCount() const
+{
+    return d_inputCount;
+}
+
+inline
+unsigned int FrameLog::frames() const
+{
+    return d_frames.size();
+}
+
+inline
+float FrameLog::dt( unsigned int frame ) const
+{
+    return d_frames[frame].dt;
+}
+
+inline
+unsigned int FrameLog::polls( unsigned int frame ) const
+{
+    return d_frames[frame].polls;
+}
+
+inline
+unsigned int FrameLog::events( unsigned int frame ) const
+{
+    return d_frames[frame].events;
+}
+
+inline
+const std::string& FrameLog::event( unsigned int frame,
+                                    unsigned int i ) const
+{
+    assert( i < d_frames[frame].events );
+    return d_types[d_events[d_frames[frame].firstEvent + i]];
+}
+
+} // End nspc sgdl
+
+} // End nspc StevensDev
+
+#endif
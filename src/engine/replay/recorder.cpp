@@ -0,0 +1,21 @@
+// recorder.cpp
+#include "recorder.h"
+
+namespace StevensDev
+{
+
+namespace sgdl
+{
+
+// MEMBER FUNCTIONS
+void Recorder::poll( bool* isDown, unsigned int count )
+{
+    assert( count == d_log->inputCount() );
+
+    d_source->poll( isDown, count );
+    d_log->addPoll( isDown );
+}
+
+} // End nspc sgdl
+
+} // End nspc StevensDev
@@ -0,0 +1,142 @@
+// recorder.h
+//
+// Records play into a frame log. The recorder sits between Input and the
+// real input source, keeping every poll that passes through it, and is
+// told about dispatched events by observing the event dispatcher:
+//
+//     Recorder recorder( &devices, &log );
+//
+//     Input::inst().setSource( &recorder );
+//     EventBus::dispatcher().setObserver( recorder.observer() );
+//
+// The frame is finished by calling endFrame with the time that the scene
+// was ticked with.
+#ifndef INCLUDED_RECORDER
+#define INCLUDED_RECORDER
+
+#include "../events/event_dispatcher.h"
+#include "../events/ievent.h"
+#include "../input/iinput_source.h"
+#include <assert.h>
+#include "frame_log.h"
+
+namespace StevensDev
+{
+
+namespace sgdl
+{
+
+class Recorder : public sgdi::IInputSource
+{
+  private:
+    // MEMBERS
+    sgdi::IInputSource* d_source;
+      // Where the recorded states come from.
+
+    FrameLog* d_log;
+      // Where the frames are recorded.
+
+  public:
+    // CONSTRUCTORS
+    Recorder( sgdi::IInputSource* source, FrameLog* log );
+      // Constructs a new recorder of the source into the log.
+      //
+      // Both must outlive the recorder and each poll must be for exactly
+      // the log's number of inputs.
+
+    Recorder( const Recorder& recorder );
+      // Constructs a recorder of the same source into the same log.
+
+    virtual ~Recorder();
+      // Destructs the recorder.
+
+    // OPERATORS
+    Recorder& operator=( const Recorder& recorder );
+      // Makes this record the same source into the same log.
+
+    // ACCESSOR FUNCTIONS
+    const FrameLog& log() const;
+      // Gets the log that is recorded into.
+
+    sgde::EventListener observer();
+      // Gets a callback that records the events it is given.
+
+    // MEMBER FUNCTIONS
+    virtual void poll( bool* isDown, unsigned int count );
+      // Polls the source and records the states.
+
+    void observe( const sgde::IEvent* event );
+      // Records that the event was dispatched.
+
+    void endFrame( float dtS );
+      // Finishes the frame that the scene was ticked with dtS seconds.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const Recorder& recorder )
+{
+    return stream << "{ \"log\": " << recorder.log() << " }";
+}
+
+// CONSTRUCTORS
+inline
+Recorder::Recorder( sgdi::IInputSource* source, FrameLog* log )
+    : d_source( source ), d_log( log )
+{
+    assert( source != nullptr );
+    assert( log != nullptr );
+}
+
+inline
+Recorder::Recorder( const Recorder& recorder )
+    : d_source( recorder.d_source ), d_log( recorder.d_log )
+{
+}
+
+inline
+Recorder::~Recorder()
+{
+}
+
+// OPERATORS
+inline
+Recorder& Recorder::operator=( const Recorder& recorder )
+{
+    d_source = recorder.d_source;
+    d_log = recorder.d_log;
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+const FrameLog& Recorder::log() const
+{
+    return *d_log;
+}
+
+inline
+sgde::EventListener Recorder::observer()
+{
+    return sgde::EventListener::bind<Recorder, &Recorder::observe>( this );
+}
+
+// MEMBER FUNCTIONS
+inline
+void Recorder::observe( const sgde::IEvent* event )
+{
+    d_log->addEvent( event->type() );
+}
+
+inline
+void Recorder::endFrame( float dtS )
+{
+    d_log->endFrame( dtS );
+}
+
+} // End nspc sgdl
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,194 @@
+// replayer.cpp
+#include "replayer.h"
+#include "../memory/allocator_guard.h"
+#include "../time/time_source.h"
+#include <algorithm>
+
+namespace StevensDev
+{
+
+namespace sgdl
+{
+
+// CONSTRUCTORS
+Replayer::Replayer( const FrameLog* log )
+    : d_log( log ), d_states(), d_timings(), d_frame( 0 ), d_poll( 0 ),
+      d_event( 0 ), d_divergences( 0 ), d_isDiverged( false )
+{
+    assert( log != nullptr );
+
+    rewind();
+}
+
+// ACCESSOR FUNCTIONS
+sgdk::Duration Replayer::total() const
+{
+    sgdk::Duration total = 0;
+    unsigned int i;
+
+    for ( i = 0; i < d_timings.size(); ++i )
+    {
+        total += d_timings[i];
+    }
+
+    return total;
+}
+
+sgdk::Duration Replayer::min() const
+{
+    sgdk::Duration shortest = d_timings.size() > 0 ? d_timings[0] : 0;
+    unsigned int i;
+
+    for ( i = 1; i < d_timings.size(); ++i )
+    {
+        shortest = std::min( shortest, d_timings[i] );
+    }
+
+    return shortest;
+}
+
+sgdk::Duration Replayer::max() const
+{
+    sgdk::Duration longest = 0;
+    unsigned int i;
+
+    for ( i = 0; i < d_timings.size(); ++i )
+    {
+        longest = std::max( longest, d_timings[i] );
+    }
+
+    return longest;
+}
+
+sgdk::Duration Replayer::percentile( double p ) const
+{
+    assert( p >= 0 && p <= 1 );
+
+    if ( d_timings.size() == 0 )
+    {
+        return 0;
+    }
+
+    sgdm::AllocatorGuard<sgdk::Duration> alloc;
+    unsigned int count = d_timings.size();
+    unsigned int rank = static_cast<unsigned int>( p * ( count - 1 ) + 0.5 );
+    sgdk::Duration* sorted = alloc.get( count );
+    sgdk::Duration result;
+    unsigned int i;
+
+    for ( i = 0; i < count; ++i )
+    {
+        sorted[i] = d_timings[i];
+    }
+
+    std::nth_element( sorted, sorted + rank, sorted + count );
+    result = sorted[rank];
+
+    alloc.release( sorted, count );
+
+    return result;
+}
+
+// MEMBER FUNCTIONS
+void Replayer::poll( bool* isDown, unsigned int count )
+{
+    assert( count == d_log->inputCount() );
+
+    unsigned int i;
+
+    if ( !isFinished() && d_poll < d_log->polls( d_frame ) )
+    {
+        d_log->applyPoll( d_frame, d_poll, &d_states[0] );
+    }
+    else
+    {
+        d_isDiverged = true;
+    }
+
+    ++d_poll;
+
+    for ( i = 0; i < count; ++i )
+    {
+        isDown[i] = d_states[i];
+    }
+}
+
+void Replayer::observe( const sgde::IEvent* event )
+{
+    if ( isFinished() || d_event >= d_log->events( d_frame ) ||
+         d_log->event( d_frame, d_event ) != event->type() )
+    {
+        d_isDiverged = true;
+    }
+
+    ++d_event;
+}
+
+bool Replayer::tick( sgds::Scene& scene )
+{
+    if ( isFinished() )
+    {
+        return false;
+    }
+
+    sgdk::TimePoint start;
+
+    d_poll = 0;
+    d_event = 0;
+    d_isDiverged = false;
+
+    start = sgdk::TimeSource::now();
+    scene.tick( d_log->dt( d_frame ) );
+    d_timings.push( sgdk::TimeSource::now() - start );
+
+    // catch up on polls that were skipped so later frames start in sync
+    while ( d_poll < d_log->polls( d_frame ) )
+    {
+        d_log->applyPoll( d_frame, d_poll++, &d_states[0] );
+        d_isDiverged = true;
+    }
+
+    if ( d_isDiverged || d_event != d_log->events( d_frame ) )
+    {
+        ++d_divergences;
+    }
+
+    ++d_frame;
+
+    return true;
+}
+
+void Replayer::rewind()
+{
+    unsigned int i;
+
+    d_states = sgdc::DynamicArray<bool>();
+    for ( i = 0; i < d_log->inputCount(); ++i )
+    {
+        d_states.push( false );
+    }
+
+    d_timings = sgdc::DynamicArray<sgdk::Duration>();
+    d_frame = 0;
+    d_poll = 0;
+    d_event = 0;
+    d_divergences = 0;
+    d_isDiverged = false;
+}
+
+void Replayer::writeReport( std::ostream& stream ) const
+{
+    unsigned int i;
+
+    stream << "{ \"summary\": " << *this << ", \"frameMs\": [";
+    for ( i = 0; i < d_timings.size(); ++i )
+    {
+        stream << ( i > 0 ? ", " : " " )
+               << sgdk::TimeUnits::toMilliseconds( d_timings[i] );
+    }
+    stream << " ] }";
+}
+
+} // End nspc sgdl
+
+} // End nspc StevensDev
@@ -0,0 +1,238 @@
+// replayer.h
+//
+// Plays a frame log back through a scene. The replayer takes the place of
+// the input source and ticks the scene with each recorded time, as fast
+// as it can, timing every frame:
+//
+//     Replayer replayer( &log );
+//
+//     Input::inst().setSource( &replayer );
+//     EventBus::dispatcher().setObserver( replayer.observer() );
+//     replayer.run( Scene::inst() );
+//     replayer.writeReport( std::cout );
+//
+// Events are not dispatched again since the game dispatches them itself.
+// Instead they are checked against the recording, and a frame that polls
+// input a different number of times or dispatches different events than
+// it did when recorded counts as a divergence.
+#ifndef INCLUDED_REPLAYER
+#define INCLUDED_REPLAYER
+
+#include "../containers/dynamic_array.h"
+#include "../events/event_dispatcher.h"
+#include "../events/ievent.h"
+#include "../input/iinput_source.h"
+#include "../scene/scene.h"
+#include "../time/time_units.h"
+#include <assert.h>
+#include "frame_log.h"
+
+namespace StevensDev
+{
+
+namespace sgdl
+{
+
+class Replayer : public sgdi::IInputSource
+{
+  private:
+    // MEMBERS
+    const FrameLog* d_log;
+      // The frames to play.
+
+    sgdc::DynamicArray<bool> d_states;
+      // The input states as of the last replayed poll.
+
+    sgdc::DynamicArray<sgdk::Duration> d_timings;
+      // How long each played frame took.
+
+    unsigned int d_frame;
+      // The frame being played or the next one to play.
+
+    unsigned int d_poll;
+      // The number of polls during the current frame.
+
+    unsigned int d_event;
+      // The number of events during the current frame.
+
+    unsigned int d_divergences;
+      // The number of frames that did not play as recorded.
+
+    bool d_isDiverged;
+      // If the current frame has not played as recorded.
+
+  public:
+    // CONSTRUCTORS
+    Replayer( const FrameLog* log );
+      // Constructs a new replayer of the log, which must outlive it.
+
+    Replayer( const Replayer& replayer );
+      // Constructs a copy of the replayer at the same frame.
+
+    virtual ~Replayer();
+      // Destructs the replayer.
+
+    // OPERATORS
+    Replayer& operator=( const Replayer& replayer );
+      // Makes this a copy of the replayer at the same frame.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int frame() const;
+      // Gets the next frame to play.
+
+    bool isFinished() const;
+      // Checks if every frame has been played.
+
+    unsigned int divergences() const;
+      // Gets the number of played frames that did not play as recorded.
+
+    sgdk::Duration timing( unsigned int frame ) const;
+      // Gets how long the played frame took.
+
+    sgdk::Duration total() const;
+      // Gets how long every played frame took.
+
+    sgdk::Duration min() const;
+      // Gets the shortest played frame or zero if none were.
+
+    sgdk::Duration max() const;
+      // Gets the longest played frame or zero if none were.
+
+    sgdk::Duration mean() const;
+      // Gets the average played frame or zero if none were.
+
+    sgdk::Duration percentile( double p ) const;
+      // Gets the length that the fraction p in [0, 1] of played frames
+      // took at most or zero if none were.
+
+    sgde::EventListener observer();
+      // Gets a callback that checks the events it is given.
+
+    // MEMBER FUNCTIONS
+    virtual void poll( bool* isDown, unsigned int count );
+      // Writes the states of the next recorded poll of the current frame.
+      //
+      // Polls beyond those recorded repeat the last states.
+
+    void observe( const sgde::IEvent* event );
+      // Checks the event against the next recorded event of the frame.
+
+    bool tick( sgds::Scene& scene );
+      // Plays the next frame through the scene and returns false if every
+      // frame has been played.
+
+    void run( sgds::Scene& scene );
+      // Plays every remaining frame through the scene.
+
+    void rewind();
+      // Starts over from the first frame with every input up and no
+      // timings.
+
+    void writeReport( std::ostream& stream ) const;
+      // Writes the summary and the milliseconds of every played frame.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const Replayer& replayer )
+{
+    using sgdk::TimeUnits;
+
+    return stream << "{ \"frames\": " << replayer.frame()
+                  << ", \"divergences\": " << replayer.divergences()
+                  << ", \"totalMs\": "
+                  << TimeUnits::toMilliseconds( replayer.total() )
+                  << ", \"minMs\": "
+                  << TimeUnits::toMilliseconds( replayer.min() )
+                  << ", \"meanMs\": "
+                  << TimeUnits::toMilliseconds( replayer.mean() )
+                  << ", \"p99Ms\": " << TimeUnits::toMilliseconds(
+                                            replayer.percentile( 0.99 ) )
+                  << ", \"maxMs\": "
+                  << TimeUnits::toMilliseconds( replayer.max() ) << " }";
+}
+
+// CONSTRUCTORS
+inline
+Replayer::Replayer( const Replayer& replayer )
+    : d_log( replayer.d_log ), d_states( replayer.d_states ),
+      d_timings( replayer.d_timings ), d_frame( replayer.d_frame ),
+      d_poll( replayer.d_poll ), d_event( replayer.d_event ),
+      d_divergences( replayer.d_divergences ),
+      d_isDiverged( replayer.d_isDiverged )
+{
+}
+
+inline
+Replayer::~Replayer()
+{
+}
+
+// OPERATORS
+inline
+Replayer& Replayer::operator=( const Replayer& replayer )
+{
+    d_log = replayer.d_log;
+    d_states = replayer.d_states;
+    d_timings = replayer.d_timings;
+    d_frame = replayer.d_frame;
+    d_poll = replayer.d_poll;
+    d_event = replayer.d_event;
+    d_divergences = replayer.d_divergences;
+    d_isDiverged = replayer.d_isDiverged;
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int Replayer::frame() const
+{
+    return d_frame;
+}
+
+inline
+bool Replayer::isFinished() const
+{
+    return d_frame >= d_log->frames();
+}
+
+inline
+unsigned int Replayer::divergences() const
+{
+    return d_divergences;
+}
+
+inline
+sgdk::Duration Replayer::timing( unsigned int frame ) const
+{
+    return d_timings[frame];
+}
+
+inline
+sgdk::Duration Replayer::mean() const
+{
+    return d_timings.size() > 0 ?
+           total() / static_cast<sgdk::Duration>( d_timings.size() ) : 0;
+}
+
+inline
+sgde::EventListener Replayer::observer()
+{
+    return sgde::EventListener::bind<Replayer, &Replayer::observe>( this );
+}
+
+// MEMBER FUNCTIONS
+inline
+void Replayer::run( sgds::Scene& scene )
+{
+    while ( tick( scene ) )
+    {
+    }
+}
+
+} // End nspc sgdl
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,46 @@
+// fixed_timestep.cpp
+#include "fixed_timestep.h"
+#include <cmath>
+
+namespace StevensDev
+{
+
+namespace sgds
+{
+
+// CONSTANTS
+const unsigned int FixedTimestep::DEFAULT_MAX_STEPS;
+
+// MEMBER FUNCTIONS
+unsigned int FixedTimestep::advance( float elapsedS )
+{
+    unsigned int steps = 0;
+
+    assert( elapsedS >= 0 );
+
+    if ( !isFixed() )
+    {
+        d_last = elapsedS;
+        return 1;
+    }
+
+    d_accumulated += elapsedS;
+
+    while ( d_accumulated >= d_step && steps < d_maxSteps )
+    {
+        d_accumulated -= d_step;
+        ++steps;
+    }
+
+    // too far behind to catch up so drop the whole steps that are left
+    if ( d_accumulated >= d_step )
+    {
+        d_accumulated = std::fmod( d_accumulated, d_step );
+    }
+
+    return steps;
+}
+
+} // End nspc sgds
+
+} // End nspc StevensDev
@@ -0,0 +1,226 @@
+// fixed_timestep.h
+//
+// Accumulates real elapsed time and converts it into a whole number of
+// fixed simulation steps so that the simulation advances the same way no
+// matter how fast frames are drawn. The time left over after the last step
+// is reported as an interpolation alpha that rendering can use to blend
+// between the previous and current simulation states.
+//
+// The number of steps taken in one frame is capped so that a long stall
+// cannot make the simulation fall further and further behind. Time beyond
+// the cap is dropped.
+//
+// A step of zero disables fixed stepping so that every frame takes a single
+// step of the elapsed time.
+#ifndef INCLUDED_FIXED_TIMESTEP
+#define INCLUDED_FIXED_TIMESTEP
+
+#include <assert.h>
+#include <ostream>
+
+namespace StevensDev
+{
+
+namespace sgds
+{
+
+class FixedTimestep
+{
+  public:
+    // CONSTANTS
+    static const unsigned int DEFAULT_MAX_STEPS = 5;
+      // The default maximum number of steps taken in one frame.
+
+  private:
+    float d_step;
+      // The length of a step in seconds or zero if steps are variable.
+
+    float d_accumulated;
+      // The time in seconds that has not been stepped yet.
+
+    float d_last;
+      // The length of the steps taken by the last advance in seconds.
+
+    unsigned int d_maxSteps;
+      // The maximum number of steps taken in one frame.
+
+  public:
+    // CONSTRUCTORS
+    FixedTimestep();
+      // Constructs a new variable timestep.
+
+    FixedTimestep( float stepS, unsigned int maxSteps = DEFAULT_MAX_STEPS );
+      // Constructs a new fixed timestep.
+
+    FixedTimestep( const FixedTimestep& timestep );
+      // Constructs a copy of the timestep.
+
+    ~FixedTimestep();
+      // Destructs the timestep.
+
+    // OPERATORS
+    FixedTimestep& operator=( const FixedTimestep& timestep );
+      // Makes this a copy of the timestep.
+
+    // ACCESSOR FUNCTIONS
+    float step() const;
+      // Gets the length of a fixed step in seconds or zero if steps are
+      // variable.
+
+    float dt() const;
+      // Gets the delta time in seconds of every step taken by the last
+      // advance.
+
+    unsigned int maxSteps() const;
+      // Gets the maximum number of steps taken in one frame.
+
+    float accumulated() const;
+      // Gets the time in seconds that has not been stepped yet.
+
+    float alpha() const;
+      // Gets how far in [0, 1) the accumulated time is between the last
+      // step and the next one.
+      //
+      // This is always one when steps are variable.
+
+    bool isFixed() const;
+      // Checks if steps have a fixed length.
+
+    // MUTATOR FUNCTIONS
+    void setStep( float stepS );
+      // Sets the length of a step in seconds or zero for variable steps.
+      //
+      // This discards any accumulated time.
+
+    void setMaxSteps( unsigned int maxSteps );
+      // Sets the maximum number of steps taken in one frame.
+
+    // MEMBER FUNCTIONS
+    unsigned int advance( float elapsedS );
+      // Accumulates the elapsed time and returns how many steps of dt()
+      // seconds should be taken.
+
+    void reset();
+      // Discards any accumulated time.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream,
+                          const FixedTimestep& timestep )
+{
+    return stream << "{ \"step\": " << timestep.step()
+                  << ", \"maxSteps\": " << timestep.maxSteps()
+                  << ", \"accumulated\": " << timestep.accumulated()
+                  << " }";
+}
+
+// CONSTRUCTORS
+inline
+FixedTimestep::FixedTimestep()
+    : d_step( 0 ), d_accumulated( 0 ), d_last( 0 ),
+      d_maxSteps( DEFAULT_MAX_STEPS )
+{
+}
+
+inline
+FixedTimestep::FixedTimestep( float stepS, unsigned int maxSteps )
+    : d_step( stepS ), d_accumulated( 0 ), d_last( stepS ),
+      d_maxSteps( maxSteps )
+{
+    assert( stepS >= 0 );
+    assert( maxSteps > 0 );
+}
+
+inline
+FixedTimestep::FixedTimestep( const FixedTimestep& timestep )
+    : d_step( timestep.d_step ), d_accumulated( timestep.d_accumulated ),
+      d_last( timestep.d_last ), d_maxSteps( timestep.d_maxSteps )
+{
+}
+
+inline
+FixedTimestep::~FixedTimestep()
+{
+}
+
+// OPERATORS
+inline
+FixedTimestep& FixedTimestep::operator=( const FixedTimestep& timestep )
+{
+    d_step = timestep.d_step;
+    d_accumulated = timestep.d_accumulated;
+    d_last = timestep.d_last;
+    d_maxSteps = timestep.d_maxSteps;
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+float FixedTimestep::step() const
+{
+    return d_step;
+}
+
+inline
+float FixedTimestep::dt() const
+{
+    return d_last;
+}
+
+inline
+unsigned int FixedTimestep::maxSteps() const
+{
+    return d_maxSteps;
+}
+
+inline
+float FixedTimestep::accumulated() const
+{
+    return d_accumulated;
+}
+
+inline
+float FixedTimestep::alpha() const
+{
+    return isFixed() ? d_accumulated / d_step : 1.0f;
+}
+
+inline
+bool FixedTimestep::isFixed() const
+{
+    return d_step > 0;
+}
+
+// MUTATOR FUNCTIONS
+inline
+void FixedTimestep::setStep( float stepS )
+{
+    assert( stepS >= 0 );
+
+    d_step = stepS;
+    d_last = stepS;
+    d_accumulated = 0;
+}
+
+inline
+void FixedTimestep::setMaxSteps( unsigned int maxSteps )
+{
+    assert( maxSteps > 0 );
+
+    d_maxSteps = maxSteps;
+}
+
+// MEMBER FUNCTIONS
+inline
+void FixedTimestep::reset()
+{
+    d_accumulated = 0;
+}
+
+} // End nspc sgds
+
+} // End nspc StevensDev
+
+#endif
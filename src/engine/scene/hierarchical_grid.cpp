@@ -0,0 +1,365 @@
+// hierarchical_grid.cpp
+#include "hierarchical_grid.h"
+
+namespace StevensDev
+{
+
+namespace sgds
+{
+
+// CONSTRUCTORS
+HierarchicalGrid::HierarchicalGrid( const HierarchicalGrid& grid )
+    : d_levelAlloc(), d_cellAlloc(), d_levels( nullptr ), d_cells( nullptr ),
+      d_size( grid.d_size ), d_divs( grid.d_divs ), d_levelCount( 0 ),
+      d_cellCount( 0 )
+{
+    unsigned int i;
+
+    initialize();
+
+    for ( i = 0; i < d_levelCount; ++i )
+    {
+        d_levels[i].count = grid.d_levels[i].count;
+    }
+
+    for ( i = 0; i < d_cellCount; ++i )
+    {
+        d_cells[i] = grid.d_cells[i];
+    }
+}
+
+// OPERATORS
+HierarchicalGrid& HierarchicalGrid::operator=( const HierarchicalGrid& grid )
+{
+    unsigned int i;
+
+    if ( &grid == this )
+    {
+        return *this;
+    }
+
+    release();
+
+    d_size = grid.d_size;
+    d_divs = grid.d_divs;
+
+    initialize();
+
+    for ( i = 0; i < d_levelCount; ++i )
+    {
+        d_levels[i].count = grid.d_levels[i].count;
+    }
+
+    for ( i = 0; i < d_cellCount; ++i )
+    {
+        d_cells[i] = grid.d_cells[i];
+    }
+
+    return *this;
+}
+
+// MEMBER FUNCTIONS
+void HierarchicalGrid::addCollider( ICollider* collider )
+{
+    const RectangleBounds& bounds = collider->bounds();
+    unsigned int level = getLevel( bounds );
+
+    d_cells[getAnchor( bounds, level )].push( collider );
+    ++d_levels[level].count;
+}
+
+void HierarchicalGrid::removeCollider( ICollider* collider )
+{
+    const RectangleBounds& bounds = collider->bounds();
+    unsigned int level = getLevel( bounds );
+    unsigned int i;
+    unsigned int j;
+
+    // the collider is normally still where its bounds place it
+    if ( d_cells[getAnchor( bounds, level )].remove( collider ) )
+    {
+        --d_levels[level].count;
+        return;
+    }
+
+    // otherwise it has moved since it was added
+    for ( i = 0; i < d_levelCount; ++i )
+    {
+        for ( j = 0; j < d_levels[i].divisions * d_levels[i].divisions; ++j )
+        {
+            if ( d_cells[d_levels[i].offset + j].remove( collider ) )
+            {
+                --d_levels[i].count;
+                return;
+            }
+        }
+    }
+}
+
+sgdc::DynamicArray<ICollider*> HierarchicalGrid::find(
+    const RectangleBounds& bounds, unsigned short flags ) const
+{
+    sgdc::DynamicArray<ICollider*> colliding;
+    CellRegion region;
+    ICollider* collider;
+    unsigned int mask;
+    unsigned int level;
+    unsigned int i;
+    unsigned int j;
+    unsigned int k;
+    unsigned int lane;
+
+    for ( level = 0; level < d_levelCount; ++level )
+    {
+        const Level& l = d_levels[level];
+
+        if ( l.count == 0 )
+        {
+            continue;
+        }
+
+        region = getCellRegion( l, bounds );
+
+        for ( i = region.top; i <= region.bottom; ++i )
+        {
+            for ( j = region.left; j <= region.right; ++j )
+            {
+                const PackedColliderArray& contents =
+                    d_cells[getIndex( l, i, j )];
+
+                // each collider is only stored once so no duplicates
+                for ( k = 0; k < contents.size();
+                      k += PackedColliderArray::LANES )
+                {
+                    mask = contents.overlapMask( k, bounds );
+
+                    for ( lane = k; mask != 0; ++lane, mask >>= 1 )
+                    {
+                        if ( !( mask & 1 ) )
+                        {
+                            continue;
+                        }
+
+                        collider = contents.collider( lane );
+
+                        if ( collider->canCollide( flags ) &&
+                             ( !contents.isPrecise( lane ) ||
+                               collider->doesCollide( bounds ) ) )
+                        {
+                            colliding.push( collider );
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return colliding;
+}
+
+sgdc::DynamicArray<ICollider*> HierarchicalGrid::nearest(
+    float x, float y, unsigned int count, unsigned short flags ) const
+{
+    NearestColliders nearest( count );
+    unsigned int level;
+    int row;
+    int col;
+    int last;
+    int rings;
+    int ring;
+    int i;
+    int j;
+    float edge;
+    float bound;
+
+    if ( count == 0 )
+    {
+        return nearest.sorted();
+    }
+
+    // coarse levels hold few large colliders that tighten the bound early
+    for ( level = d_levelCount; level-- > 0; )
+    {
+        const Level& l = d_levels[level];
+
+        if ( l.count == 0 )
+        {
+            continue;
+        }
+
+        row = getRow( l, y );
+        col = getColumn( l, x );
+        last = l.divisions - 1;
+        rings = std::max( std::max( row, last - row ),
+                          std::max( col, last - col ) );
+
+        // distance from the point to the closest edge of its own cell
+        edge = std::min( std::min( x - col * l.cellSize,
+                                   ( col + 1 ) * l.cellSize - x ),
+                         std::min( y - row * l.cellSize,
+                                   ( row + 1 ) * l.cellSize - y ) );
+        edge = std::max( 0.0f, edge );
+
+        for ( ring = 0; ring <= rings; ++ring )
+        {
+            // colliders reach one cell past their own so every collider
+            // stored in the ring is at least this far from the point
+            bound = ring < 2 ? 0.0f : ( ring - 2 ) * l.cellSize + edge;
+
+            if ( nearest.isFull() && nearest.farthest() <= bound * bound )
+            {
+                break;
+            }
+
+            for ( i = std::max( row - ring, 0 );
+                  i <= std::min( row + ring, last );
+                  ++i )
+            {
+                if ( i == row - ring || i == row + ring )
+                {
+                    // top and bottom edges of the ring
+                    for ( j = std::max( col - ring, 0 );
+                          j <= std::min( col + ring, last );
+                          ++j )
+                    {
+                        searchCell( getIndex( l, i, j ), x, y, flags,
+                                    &nearest );
+                    }
+                }
+                else
+                {
+                    // left and right edges of the ring
+                    if ( col - ring >= 0 )
+                    {
+                        searchCell( getIndex( l, i, col - ring ), x, y, flags,
+                                    &nearest );
+                    }
+
+                    if ( col + ring <= last )
+                    {
+                        searchCell( getIndex( l, i, col + ring ), x, y, flags,
+                                    &nearest );
+                    }
+                }
+            }
+        }
+    }
+
+    return nearest.sorted();
+}
+
+// HELPER FUNCTIONS
+void HierarchicalGrid::initialize()
+{
+    unsigned int divisions;
+    unsigned int i;
+
+    // count the levels and cells until a single cell covers the grid
+    d_levelCount = 0;
+    d_cellCount = 0;
+    for ( divisions = d_divs; ; divisions = ( divisions + 1 ) / 2 )
+    {
+        ++d_levelCount;
+        d_cellCount += divisions * divisions;
+
+        if ( divisions == 1 )
+        {
+            break;
+        }
+    }
+
+    d_levels = d_levelAlloc.get( d_levelCount );
+    d_cells = d_cellAlloc.get( d_cellCount );
+
+    for ( i = 0, divisions = d_divs; i < d_levelCount; ++i )
+    {
+        d_levels[i].divisions = divisions;
+        d_levels[i].cellSize = d_size / divisions;
+        d_levels[i].offset = i == 0 ? 0 : d_levels[i - 1].offset +
+                                          d_levels[i - 1].divisions *
+                                          d_levels[i - 1].divisions;
+        d_levels[i].count = 0;
+
+        divisions = ( divisions + 1 ) / 2;
+    }
+
+    for ( i = 0; i < d_cellCount; ++i )
+    {
+        d_cells[i] = PackedColliderArray();
+    }
+}
+
+void HierarchicalGrid::release()
+{
+    if ( d_levels != nullptr )
+    {
+        d_levelAlloc.release( d_levels, d_levelCount );
+        d_cellAlloc.release( d_cells, d_cellCount );
+    }
+
+    d_levels = nullptr;
+    d_cells = nullptr;
+    d_levelCount = 0;
+    d_cellCount = 0;
+}
+
+unsigned int HierarchicalGrid::getLevel( const RectangleBounds& bounds ) const
+{
+    float extent = std::max( bounds.width(), bounds.height() );
+    unsigned int i;
+
+    for ( i = 0; i < d_levelCount - 1; ++i )
+    {
+        if ( d_levels[i].cellSize >= extent )
+        {
+            return i;
+        }
+    }
+
+    // the coarsest level is a single cell so anything fits
+    return d_levelCount - 1;
+}
+
+HierarchicalGrid::CellRegion HierarchicalGrid::getCellRegion(
+    const Level& level, const RectangleBounds& bounds ) const
+{
+    // colliders stored up to one cell up or left of the bounds can reach it
+    CellRegion r;
+    r.left = getColumn( level, bounds.left() - level.cellSize );
+    r.top = getRow( level, bounds.top() - level.cellSize );
+    r.right = getColumn( level, bounds.right() );
+    r.bottom = getRow( level, bounds.bottom() );
+
+    return r;
+}
+
+void HierarchicalGrid::searchCell( unsigned int index, float x, float y,
+                                   unsigned short flags,
+                                   NearestColliders* nearest ) const
+{
+    const PackedColliderArray& contents = d_cells[index];
+    ICollider* collider;
+    unsigned int i;
+    float distance;
+
+    for ( i = 0; i < contents.size(); ++i )
+    {
+        distance = contents.distanceSquared( i, x, y );
+
+        if ( nearest->isFull() && distance >= nearest->farthest() )
+        {
+            continue;
+        }
+
+        collider = contents.collider( i );
+
+        if ( collider->canCollide( flags ) )
+        {
+            nearest->offer( collider, distance );
+        }
+    }
+}
+
+} // End nspc sgds
+
+} // End nspc StevensDev
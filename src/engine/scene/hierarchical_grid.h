@@ -0,0 +1,355 @@
+// hierarchical_grid.h
+//
+// A loose multi-resolution grid. The finest level has the given number of
+// divisions and each coarser level halves them until a single cell covers
+// the whole space.
+//
+// Each collider is stored once, in the finest level whose cells are at
+// least as large as the collider, in the cell that contains its top-left
+// corner. A collider therefore never reaches further than one cell right
+// and down from the cell that it is stored in, so queries only have to
+// widen their region by one cell on each level and never see duplicates.
+#ifndef INCLUDED_HIERARCHICAL_GRID
+#define INCLUDED_HIERARCHICAL_GRID
+
+#include "../containers/dynamic_array.h"
+#include "../memory/allocator_guard.h"
+#include <assert.h>
+#include "icollider.h"
+#include "nearest_colliders.h"
+#include "packed_collider_array.h"
+#include <algorithm>
+#include <cmath>
+
+namespace StevensDev
+{
+
+namespace sgds
+{
+
+class HierarchicalGrid
+{
+  private:
+    struct Level
+    {
+        unsigned int divisions;
+          // The number of divisions along each axis.
+
+        float cellSize;
+          // The width and height of each cell.
+
+        unsigned int offset;
+          // The index of the level's first cell.
+
+        unsigned int count;
+          // The number of colliders stored in the level.
+    };
+
+    struct CellRegion
+    {
+        unsigned int left;
+          // The left-most column in the region.
+
+        unsigned int top;
+          // The top-most row in the region.
+
+        unsigned int right;
+          // The right-most column in the region.
+
+        unsigned int bottom;
+          // The bottom-most row in the region.
+    };
+
+    // MEMBERS
+    sgdm::AllocatorGuard<Level> d_levelAlloc;
+      // Allocates the levels.
+
+    sgdm::AllocatorGuard<PackedColliderArray> d_cellAlloc;
+      // Allocates the cells.
+
+    Level* d_levels;
+      // The levels from finest to coarsest.
+
+    PackedColliderArray* d_cells;
+      // The cells of every level.
+      //
+      // Each level is stored contiguously in row-major order.
+
+    float d_size;
+      // The width and height of the grid.
+
+    unsigned int d_divs;
+      // The number of divisions in the finest level.
+
+    unsigned int d_levelCount;
+      // The number of levels.
+
+    unsigned int d_cellCount;
+      // The number of cells in all levels.
+
+    // HELPER FUNCTIONS
+    void initialize();
+      // Creates the levels and cells.
+
+    void release();
+      // Releases the levels and cells.
+
+    unsigned int getLevel( const RectangleBounds& bounds ) const;
+      // Gets the finest level whose cells are at least as large as the
+      // bounds.
+
+    unsigned int getColumn( const Level& level, float x ) const;
+      // Gets the column in the level that contains the given x position
+      // clamped to the grid, or the first column if x is not a number.
+
+    unsigned int getRow( const Level& level, float y ) const;
+      // Gets the row in the level that contains the given y position
+      // clamped to the grid.
+
+    unsigned int getIndex( const Level& level, unsigned int row,
+                           unsigned int col ) const;
+      // Gets the index of the cell at the given row and column in the
+      // level.
+
+    unsigned int getAnchor( const RectangleBounds& bounds,
+                            unsigned int level ) const;
+      // Gets the index of the cell that stores colliders with the given
+      // bounds in the level.
+
+    CellRegion getCellRegion( const Level& level,
+                              const RectangleBounds& bounds ) const;
+      // Gets the region of cells in the level that can store colliders
+      // overlapping the given bounds.
+
+    void searchCell( unsigned int index, float x, float y,
+                     unsigned short flags, NearestColliders* nearest ) const;
+      // Offers the colliders with the given flags in the cell to the
+      // nearest collection by their distance from the point.
+
+  public:
+    // CONSTRUCTORS
+    HierarchicalGrid();
+      // Constructs a new empty grid of size 2.0 by 2.0 with 16 divisions
+      // in the finest level.
+
+    HierarchicalGrid( float dimensions, unsigned int divisions );
+      // Constructs a new empty grid with the given number of divisions in
+      // the finest level.
+      //
+      // Dimensions must be greater than zero.
+      // Divisions must be greater than zero.
+
+    HierarchicalGrid( const HierarchicalGrid& grid );
+      // Constructs a copy of the given grid.
+
+    ~HierarchicalGrid();
+      // Destructs the grid.
+
+    // OPERATORS
+    HierarchicalGrid& operator=( const HierarchicalGrid& grid );
+      // Makes this a copy of the given grid.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int levels() const;
+      // Gets the number of levels.
+
+    unsigned int divisions( unsigned int level ) const;
+      // Gets the number of divisions along each axis of the level.
+
+    unsigned int colliders( unsigned int level ) const;
+      // Gets the number of colliders stored in the level.
+
+    // MEMBER FUNCTIONS
+    void addCollider( ICollider* collider );
+      // Adds a new collider to the grid.
+      //
+      // This assumes that the collider is not in motion.
+
+    void removeCollider( ICollider* collider );
+      // Removes a collider from the grid.
+
+    sgdc::DynamicArray<ICollider*> find( float x, float y, float width,
+                                         float height ) const;
+      // Finds the colliders in the specified region.
+
+    sgdc::DynamicArray<ICollider*> find( float x, float y, float width,
+                                         float height,
+                                         unsigned short flags ) const;
+      // Finds the colliders in the specified region with the given flags.
+
+    sgdc::DynamicArray<ICollider*> find( const RectangleBounds& bounds ) const;
+      // Finds the colliders in the specified rectangular region.
+
+    sgdc::DynamicArray<ICollider*> find( const RectangleBounds& bounds,
+                                         unsigned short flags ) const;
+      // Finds the colliders in the specified rectangular region with the
+      // given flags.
+      //
+      // Each level is searched in the region widened by one of its cells
+      // up and left and doesCollide is only called for precise colliders.
+
+    sgdc::DynamicArray<ICollider*> find( const ICollider* collider ) const;
+      // Gets the colliders that are colliding with the given object.
+
+    sgdc::DynamicArray<ICollider*> nearest( float x, float y,
+                                            unsigned int count ) const;
+      // Finds up to count of the colliders closest to the point.
+
+    sgdc::DynamicArray<ICollider*> nearest( float x, float y,
+                                            unsigned int count,
+                                            unsigned short flags ) const;
+      // Finds up to count of the colliders with the given flags closest to
+      // the point ordered from closest to farthest.
+      //
+      // Each level is searched in rings of cells outward from the point
+      // until no unsearched cell in the level can hold a closer collider.
+      // Distances are measured to the colliders' bounds.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const HierarchicalGrid& grid )
+{
+    sgdd::JsonPrinter p( stream );
+    p.open().print( "levels", grid.levels() ).close();
+    return stream;
+}
+
+// CONSTRUCTORS
+inline
+HierarchicalGrid::HierarchicalGrid()
+    : d_levelAlloc(), d_cellAlloc(), d_levels( nullptr ), d_cells( nullptr ),
+      d_size( 2.0f ), d_divs( 16 ), d_levelCount( 0 ), d_cellCount( 0 )
+{
+    initialize();
+}
+
+inline
+HierarchicalGrid::HierarchicalGrid( float dimensions, unsigned int divisions )
+    : d_levelAlloc(), d_cellAlloc(), d_levels( nullptr ), d_cells( nullptr ),
+      d_size( dimensions ), d_divs( divisions ), d_levelCount( 0 ),
+      d_cellCount( 0 )
+{
+    assert( dimensions > 0.0f );
+    assert( divisions > 0 );
+
+    initialize();
+}
+
+inline
+HierarchicalGrid::~HierarchicalGrid()
+{
+    release();
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int HierarchicalGrid::levels() const
+{
+    return d_levelCount;
+}
+
+inline
+unsigned int HierarchicalGrid::divisions( unsigned int level ) const
+{
+    assert( level < d_levelCount );
+    return d_levels[level].divisions;
+}
+
+inline
+unsigned int HierarchicalGrid::colliders( unsigned int level ) const
+{
+    assert( level < d_levelCount );
+    return d_levels[level].count;
+}
+
+// MEMBER FUNCTIONS
+inline
+sgdc::DynamicArray<ICollider*> HierarchicalGrid::find( float x, float y,
+                                                       float width,
+                                                       float height ) const
+{
+    return find( x, y, width, height, 0 );
+}
+
+inline
+sgdc::DynamicArray<ICollider*> HierarchicalGrid::find( float x, float y,
+                                                       float width,
+                                                       float height,
+                                                       unsigned short flags )
+    const
+{
+    return find( RectangleBounds( x, y, width, height ), flags );
+}
+
+inline
+sgdc::DynamicArray<ICollider*> HierarchicalGrid::find(
+    const RectangleBounds& bounds ) const
+{
+    return find( bounds, 0 );
+}
+
+inline
+sgdc::DynamicArray<ICollider*> HierarchicalGrid::find(
+    const ICollider* collider ) const
+{
+    return find( collider->bounds(), collider->flags() );
+}
+
+inline
+sgdc::DynamicArray<ICollider*> HierarchicalGrid::nearest(
+    float x, float y, unsigned int count ) const
+{
+    return nearest( x, y, count, 0 );
+}
+
+// HELPER FUNCTIONS
+inline
+unsigned int HierarchicalGrid::getColumn( const Level& level, float x ) const
+{
+    float column = std::floor( x / level.cellSize );
+
+    // clamp before converting since a float that is out of range or not a
+    // number has no unsigned value
+    if ( !( column > 0.0f ) )
+    {
+        return 0;
+    }
+
+    if ( column >= level.divisions - 1 )
+    {
+        return level.divisions - 1;
+    }
+
+    return static_cast<unsigned int>( column );
+}
+
+inline
+unsigned int HierarchicalGrid::getRow( const Level& level, float y ) const
+{
+    // the grid is square so rows and columns are the same size
+    return getColumn( level, y );
+}
+
+inline
+unsigned int HierarchicalGrid::getIndex( const Level& level,
+                                         unsigned int row,
+                                         unsigned int col ) const
+{
+    return level.offset + row * level.divisions + col;
+}
+
+inline
+unsigned int HierarchicalGrid::getAnchor( const RectangleBounds& bounds,
+                                          unsigned int level ) const
+{
+    const Level& l = d_levels[level];
+    return getIndex( l, getRow( l, bounds.top() ),
+                     getColumn( l, bounds.left() ) );
+}
+
+} // End nspc sgds
+
+} // End nspc StevensDev
+
+#endif
@@ -34,6 +34,12 @@ class ICollider
 
     virtual bool doesCollide( const RectangleBounds& candidate ) const = 0;
       // Checks if the item does collide with the given bounds.
+
+    virtual bool isPrecise() const;
+      // Checks if the item has a more precise shape than its bounds.
+      //
+      // Spatial queries only call doesCollide to confirm a bounds overlap
+      // when this is true. Defaults to false.
 };
 
 inline
@@ -41,6 +47,12 @@ ICollider::~ICollider()
 {
 }
 
+inline
+bool ICollider::isPrecise() const
+{
+    return false;
+}
+
 } // End nspc sgds
 
 } // End nspc StevensDev
@@ -2,6 +2,8 @@
 #ifndef INCLUDED_ITICKABLE
 #define INCLUDED_ITICKABLE
 
+#include "tick_access.h"
+
 namespace StevensDev
 {
 
@@ -24,6 +26,14 @@ class ITickable
 
     virtual void postTick() = 0;
       // Cleans up after the tick cycle.
+
+    virtual TickAccess access() const;
+      // Gets the resources that are used in every phase and the ordering
+      // group.
+      //
+      // By default this is exclusive so the tickable never runs alongside
+      // another. The access is read when the tickable is scheduled and must
+      // not change while it is in a scene.
 };
 
 inline
@@ -31,6 +41,12 @@ ITickable::~ITickable()
 {
 }
 
+inline
+TickAccess ITickable::access() const
+{
+    return TickAccess();
+}
+
 } // End nspc sgds
 
 } // End nspc StevensDev
@@ -0,0 +1,76 @@
+// nearest_colliders.cpp
+#include "nearest_colliders.h"
+
+namespace StevensDev
+{
+
+namespace sgds
+{
+
+// ACCESSOR FUNCTIONS
+bool NearestColliders::contains( const ICollider* collider ) const
+{
+    unsigned int i;
+    for ( i = 0; i < d_size; ++i )
+    {
+        if ( d_heap[i].collider == collider )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// MEMBER FUNCTIONS
+bool NearestColliders::offer( ICollider* collider, float distance )
+{
+    Candidate candidate;
+    candidate.collider = collider;
+    candidate.distance = distance;
+
+    if ( d_capacity == 0 )
+    {
+        return false;
+    }
+
+    if ( d_size < d_capacity )
+    {
+        d_heap[d_size++] = candidate;
+        std::push_heap( d_heap, d_heap + d_size, &NearestColliders::isCloser );
+        return true;
+    }
+
+    if ( distance >= d_heap[0].distance )
+    {
+        return false;
+    }
+
+    // replace the farthest
+    std::pop_heap( d_heap, d_heap + d_size, &NearestColliders::isCloser );
+    d_heap[d_size - 1] = candidate;
+    std::push_heap( d_heap, d_heap + d_size, &NearestColliders::isCloser );
+
+    return true;
+}
+
+sgdc::DynamicArray<ICollider*> NearestColliders::sorted() const
+{
+    sgdc::DynamicArray<ICollider*> colliders( std::max( d_size, 1u ) );
+    NearestColliders copy( *this );
+    unsigned int i;
+
+    std::sort_heap( copy.d_heap, copy.d_heap + copy.d_size,
+                    &NearestColliders::isCloser );
+
+    for ( i = 0; i < copy.d_size; ++i )
+    {
+        colliders.push( copy.d_heap[i].collider );
+    }
+
+    return colliders;
+}
+
+} // End nspc sgds
+
+} // End nspc StevensDev
@@ -0,0 +1,209 @@
+// nearest_colliders.h
+//
+// Keeps the k closest colliders that are offered to it in a bounded
+// max-heap so that the farthest kept collider can be replaced in
+// logarithmic time. Spatial indices use it to answer nearest neighbour
+// queries and to know when no unsearched region can hold a closer collider.
+#ifndef INCLUDED_NEAREST_COLLIDERS
+#define INCLUDED_NEAREST_COLLIDERS
+
+#include "../containers/dynamic_array.h"
+#include "../memory/allocator_guard.h"
+#include "../memory/mem.h"
+#include <assert.h>
+#include "icollider.h"
+#include <algorithm>
+
+namespace StevensDev
+{
+
+namespace sgds
+{
+
+class NearestColliders
+{
+  private:
+    struct Candidate
+    {
+        ICollider* collider;
+          // The collider.
+
+        float distance;
+          // The squared distance to the collider.
+    };
+
+    // MEMBERS
+    sgdm::AllocatorGuard<Candidate> d_alloc;
+      // Allocates the heap.
+
+    Candidate* d_heap;
+      // The kept colliders ordered as a max-heap by distance.
+
+    unsigned int d_size;
+      // The number of kept colliders.
+
+    unsigned int d_capacity;
+      // The maximum number of kept colliders.
+
+    // HELPER FUNCTIONS
+    static bool isCloser( const Candidate& a, const Candidate& b );
+      // Orders the candidates by distance.
+
+  public:
+    // CONSTRUCTORS
+    NearestColliders( unsigned int count );
+      // Constructs a new empty collection that keeps at most count
+      // colliders.
+
+    NearestColliders( const NearestColliders& other );
+      // Constructs a copy of the other collection.
+
+    ~NearestColliders();
+      // Destructs the collection.
+
+    // OPERATORS
+    NearestColliders& operator=( const NearestColliders& other );
+      // Makes this a copy of the other collection.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int size() const;
+      // Gets the number of kept colliders.
+
+    unsigned int capacity() const;
+      // Gets the maximum number of kept colliders.
+
+    bool isFull() const;
+      // Checks if the maximum number of colliders are kept.
+
+    float farthest() const;
+      // Gets the squared distance to the farthest kept collider.
+      //
+      // Requirements:
+      // the collection is not empty
+
+    bool contains( const ICollider* collider ) const;
+      // Checks if the collider is kept.
+
+    // MEMBER FUNCTIONS
+    bool offer( ICollider* collider, float distance );
+      // Keeps the collider at the given squared distance if there is room
+      // or it is closer than the farthest kept collider and returns if it
+      // was kept.
+      //
+      // The same collider must not be offered twice while it is kept.
+
+    sgdc::DynamicArray<ICollider*> sorted() const;
+      // Gets the kept colliders ordered from closest to farthest.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream,
+                          const NearestColliders& nearest )
+{
+    sgdd::JsonPrinter p( stream );
+    p.open()
+        .print( "size", nearest.size() )
+        .print( "capacity", nearest.capacity() )
+        .close();
+    return stream;
+}
+
+// CONSTRUCTORS
+inline
+NearestColliders::NearestColliders( unsigned int count )
+    : d_alloc(), d_heap( nullptr ), d_size( 0 ), d_capacity( count )
+{
+    if ( d_capacity > 0 )
+    {
+        d_heap = d_alloc.get( d_capacity );
+    }
+}
+
+inline
+NearestColliders::NearestColliders( const NearestColliders& other )
+    : d_alloc(), d_heap( nullptr ), d_size( other.d_size ),
+      d_capacity( other.d_capacity )
+{
+    if ( d_capacity > 0 )
+    {
+        d_heap = d_alloc.get( d_capacity );
+        sgdm::Mem::copy<Candidate>( d_heap, other.d_heap, d_size );
+    }
+}
+
+inline
+NearestColliders::~NearestColliders()
+{
+    if ( d_heap != nullptr )
+    {
+        d_alloc.release( d_heap, d_capacity );
+    }
+}
+
+// OPERATORS
+inline
+NearestColliders& NearestColliders::operator=(
+    const NearestColliders& other )
+{
+    if ( &other == this )
+    {
+        return *this;
+    }
+
+    if ( d_heap != nullptr )
+    {
+        d_alloc.release( d_heap, d_capacity );
+        d_heap = nullptr;
+    }
+
+    d_size = other.d_size;
+    d_capacity = other.d_capacity;
+
+    if ( d_capacity > 0 )
+    {
+        d_heap = d_alloc.get( d_capacity );
+        sgdm::Mem::copy<Candidate>( d_heap, other.d_heap, d_size );
+    }
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int NearestColliders::size() const
+{
+    return d_size;
+}
+
+inline
+unsigned int NearestColliders::capacity() const
+{
+    return d_capacity;
+}
+
+inline
+bool NearestColliders::isFull() const
+{
+    return d_size >= d_capacity;
+}
+
+inline
+float NearestColliders::farthest() const
+{
+    assert( d_size > 0 );
+    return d_heap[0].distance;
+}
+
+// HELPER FUNCTIONS
+inline
+bool NearestColliders::isCloser( const Candidate& a, const Candidate& b )
+{
+    return a.distance < b.distance;
+}
+
+} // End nspc sgds
+
+} // End nspc StevensDev
+
+#endif
@@ -1,8 +1,7 @@
 // nxn_scene_graph.cpp
 #include "nxn_scene_graph.h"
-#include "../containers/map.h"
-#include <sstream>
-#include <cmath>
+#include "../jobs/job_system.h"
+#include <limits>
 
 namespace StevensDev
 {
@@ -13,14 +12,67 @@ namespace sgds
 namespace
 {
 
+bool intersectRay( float originX, float originY, float dirX, float dirY,
+                   float left, float top, float right, float bottom,
+                   float limit, float* entry, float* leave )
+  // Clips the ray to the bounds using the slab method and stores the
+  // distances where it enters and leaves them. Returns false if the ray
+  // misses the bounds within the limit.
+{
+    float t1;
+    float t2;
+
+    *entry = 0.0f;
+    *leave = limit;
+
+    if ( dirX == 0.0f )
+    {
+        if ( originX < left || originX > right )
+        {
+            return false;
+        }
+    }
+    else
+    {
+        t1 = ( left - originX ) / dirX;
+        t2 = ( right - originX ) / dirX;
+
+        *entry = std::max( *entry, std::min( t1, t2 ) );
+        *leave = std::min( *leave, std::max( t1, t2 ) );
+    }
+
+    if ( dirY == 0.0f )
+    {
+        if ( originY < top || originY > bottom )
+        {
+            return false;
+        }
+    }
+    else
+    {
+        t1 = ( top - originY ) / dirY;
+        t2 = ( bottom - originY ) / dirY;
+
+        *entry = std::max( *entry, std::min( t1, t2 ) );
+        *leave = std::min( *leave, std::max( t1, t2 ) );
+    }
+
+    return *entry <= *leave;
+}
+
 inline
-sgdc::Map<ICollider*> addColliderToSet( sgdc::Map<ICollider*>& set,
-                                        ICollider* collider )
+RectangleBounds rayBounds( const gel::math::Vec2& origin,
+                           const gel::math::Vec2& direction, float entry,
+                           float leave )
+  // Gets the bounds of the part of the ray between the two distances.
 {
-    std::ostringstream oss;
-    oss << (void*)collider;
-    set[oss.str()] = collider;
-    return set;
+    float x1 = origin.x + direction.x * entry;
+    float y1 = origin.y + direction.y * entry;
+    float x2 = origin.x + direction.x * leave;
+    float y2 = origin.y + direction.y * leave;
+
+    return RectangleBounds( std::min( x1, x2 ), std::min( y1, y2 ),
+                            std::abs( x2 - x1 ), std::abs( y2 - y1 ) );
 }
 
 } // End nspc anonymous
@@ -76,41 +128,516 @@ void NxNSceneGraph::removeCollider( ICollider* collider )
 }
 
 sgdc::DynamicArray<ICollider*> NxNSceneGraph::find(
-    const RectangleBounds& bounds, unsigned short flags )
+    const RectangleBounds& bounds, unsigned short flags ) const
 {
-    sgdc::Map<ICollider*> colliding;
+    sgdc::DynamicArray<ICollider*> colliding;
     CellRegion region = getCellRegion( bounds );
     ICollider* collider;
+    unsigned int mask;
     unsigned int i;
     unsigned int j;
     unsigned int k;
+    unsigned int lane;
 
     // check all cells in the feasible region
     for ( i = region.top; i <= region.bottom; ++i )
     {
         for ( j = region.left; j <= region.right; ++j )
         {
-            const Cell& cell = d_cells[getIndex( i, j )];
+            const PackedColliderArray& contents =
+                d_cells[getIndex( i, j )].contents;
 
-            // check each item in each cell
-            for ( k = 0; k < cell.contents.size(); ++k )
+            // test a block of items in each cell at a time
+            for ( k = 0; k < contents.size();
+                  k += PackedColliderArray::LANES )
             {
-                collider = cell.contents[k];
+                mask = contents.overlapMask( k, bounds );
+
+                for ( lane = k; mask != 0; ++lane, mask >>= 1 )
+                {
+                    if ( !( mask & 1 ) )
+                    {
+                        continue;
+                    }
+
+                    if ( !isReference( region, contents, lane, i, j ) )
+                    {
+                        continue;
+                    }
+
+                    collider = contents.collider( lane );
+
+                    if ( collider->canCollide( flags ) &&
+                         ( !contents.isPrecise( lane ) ||
+                           collider->doesCollide( bounds ) ) )
+                    {
+                        colliding.push( collider );
+                    }
+                }
+            }
+        }
+    }
+
+    return colliding;
+}
+
+NxNSceneGraph::RayHit NxNSceneGraph::raycast(
+    const gel::math::Vec2& origin, const gel::math::Vec2& direction,
+    float maxDistance, unsigned short flags ) const
+{
+    using namespace gel::math;
+
+    assert( direction.x != 0.0f || direction.y != 0.0f );
+
+    RayHit hit;
+    hit.collider = nullptr;
+    hit.distance = maxDistance;
+
+    Vec2 dir = Vec::normalize( direction );
+    CellWalk walk;
+    ICollider* collider;
+    unsigned int mask;
+    unsigned int k;
+    unsigned int lane;
+    float entry;
+    float leave;
+
+    beginWalk( origin, dir, maxDistance, &walk );
+
+    do
+    {
+        const PackedColliderArray& contents =
+            d_cells[getIndex( walk.row, walk.col )].contents;
+        RectangleBounds bounds = walkBounds( origin, dir, walk );
+
+        for ( k = 0; k < contents.size(); k += PackedColliderArray::LANES )
+        {
+            mask = contents.overlapMask( k, bounds );
+
+            for ( lane = k; mask != 0; ++lane, mask >>= 1 )
+            {
+                if ( !( mask & 1 ) ||
+                     !intersectRay( origin.x, origin.y, dir.x, dir.y,
+                                    contents.left( lane ),
+                                    contents.top( lane ),
+                                    contents.right( lane ),
+                                    contents.bottom( lane ),
+                                    hit.distance, &entry, &leave ) ||
+                     ( hit.collider != nullptr && entry >= hit.distance ) )
+                {
+                    continue;
+                }
+
+                collider = contents.collider( lane );
 
                 if ( collider->canCollide( flags ) &&
-                     collider->doesCollide( bounds ) )
+                     ( !contents.isPrecise( lane ) ||
+                       collider->doesCollide(
+                           rayBounds( origin, dir, entry, leave ) ) ) )
                 {
-                    // store in hashmap to prevent duplicates
-                    addColliderToSet( colliding, collider );
+                    hit.collider = collider;
+                    hit.distance = entry;
+                }
+            }
+        }
+
+        // nothing in a later cell can be hit before the end of this one
+        if ( hit.collider != nullptr && hit.distance <= walk.exit )
+        {
+            break;
+        }
+    } while ( advanceWalk( &walk ) );
+
+    return hit;
+}
+
+sgdc::DynamicArray<ICollider*> NxNSceneGraph::segmentQuery(
+    const gel::math::Vec2& start, const gel::math::Vec2& end,
+    unsigned short flags ) const
+{
+    using namespace gel::math;
+
+    sgdc::DynamicArray<ICollider*> colliding;
+    float length = Vec::length( end - start );
+
+    if ( length == 0.0f )
+    {
+        return find( RectangleBounds( start.x, start.y, 0.0f, 0.0f ), flags );
+    }
+
+    Vec2 dir = ( end - start ) / length;
+    CellWalk walk;
+    ICollider* collider;
+    unsigned int mask;
+    unsigned int k;
+    unsigned int lane;
+    float entry;
+    float leave;
+
+    beginWalk( start, dir, length, &walk );
+
+    do
+    {
+        const PackedColliderArray& contents =
+            d_cells[getIndex( walk.row, walk.col )].contents;
+        RectangleBounds bounds = walkBounds( start, dir, walk );
+
+        for ( k = 0; k < contents.size(); k += PackedColliderArray::LANES )
+        {
+            mask = contents.overlapMask( k, bounds );
+
+            for ( lane = k; mask != 0; ++lane, mask >>= 1 )
+            {
+                if ( !( mask & 1 ) ||
+                     !intersectRay( start.x, start.y, dir.x, dir.y,
+                                    contents.left( lane ),
+                                    contents.top( lane ),
+                                    contents.right( lane ),
+                                    contents.bottom( lane ),
+                                    length, &entry, &leave ) ||
+                     !isWalkReference( walk, contents, lane, entry ) )
+                {
+                    continue;
+                }
+
+                collider = contents.collider( lane );
+
+                if ( collider->canCollide( flags ) &&
+                     ( !contents.isPrecise( lane ) ||
+                       collider->doesCollide(
+                           rayBounds( start, dir, entry, leave ) ) ) )
+                {
+                    colliding.push( collider );
+                }
+            }
+        }
+    } while ( advanceWalk( &walk ) );
+
+    return colliding;
+}
+
+sgdc::DynamicArray<ICollider*> NxNSceneGraph::circleQuery(
+    const gel::math::Vec2& center, float radius, unsigned short flags ) const
+{
+    assert( radius >= 0.0f );
+
+    sgdc::DynamicArray<ICollider*> colliding;
+    RectangleBounds bounds( center.x - radius, center.y - radius,
+                            radius * 2.0f, radius * 2.0f );
+    CellRegion region = getCellRegion( bounds );
+    ICollider* collider;
+    unsigned int mask;
+    unsigned int i;
+    unsigned int j;
+    unsigned int k;
+    unsigned int lane;
+
+    for ( i = region.top; i <= region.bottom; ++i )
+    {
+        for ( j = region.left; j <= region.right; ++j )
+        {
+            const PackedColliderArray& contents =
+                d_cells[getIndex( i, j )].contents;
+
+            for ( k = 0; k < contents.size();
+                  k += PackedColliderArray::LANES )
+            {
+                mask = contents.overlapMask( k, bounds );
+
+                for ( lane = k; mask != 0; ++lane, mask >>= 1 )
+                {
+                    if ( !( mask & 1 ) ||
+                         !isReference( region, contents, lane, i, j ) )
+                    {
+                        continue;
+                    }
+
+                    if ( contents.distanceSquared( lane, center.x,
+                                                   center.y ) >
+                         radius * radius )
+                    {
+                        continue;
+                    }
+
+                    collider = contents.collider( lane );
+
+                    // a collider can only be tested against a rectangle so
+                    // precise shapes are confirmed against the circle's
+                    // bounds
+                    if ( collider->canCollide( flags ) &&
+                         ( !contents.isPrecise( lane ) ||
+                           collider->doesCollide( bounds ) ) )
+                    {
+                        colliding.push( collider );
+                    }
                 }
             }
         }
     }
 
-    return colliding.values();
+    return colliding;
+}
+
+sgdc::DynamicArray<ICollider*> NxNSceneGraph::nearest(
+    float x, float y, unsigned int count, unsigned short flags ) const
+{
+    NearestColliders nearest( count );
+    float cellSize = d_size / d_divs;
+    int row = getRow( y );
+    int col = getColumn( x );
+    int last = d_divs - 1;
+    int rings = std::max( std::max( row, last - row ),
+                          std::max( col, last - col ) );
+    int ring;
+    int i;
+    int j;
+    float edge;
+    float bound;
+
+    if ( count == 0 )
+    {
+        return nearest.sorted();
+    }
+
+    // distance from the point to the closest edge of its own cell
+    edge = std::max( 0.0f,
+                     std::min( std::min( x - col * cellSize,
+                                         ( col + 1 ) * cellSize - x ),
+                               std::min( y - row * cellSize,
+                                         ( row + 1 ) * cellSize - y ) ) );
+
+    for ( ring = 0; ring <= rings; ++ring )
+    {
+        // every cell in the ring is at least this far from the point
+        bound = ring == 0 ? 0.0f : ( ring - 1 ) * cellSize + edge;
+
+        if ( nearest.isFull() && nearest.farthest() <= bound * bound )
+        {
+            break;
+        }
+
+        for ( i = std::max( row - ring, 0 );
+              i <= std::min( row + ring, last );
+              ++i )
+        {
+            if ( i == row - ring || i == row + ring )
+            {
+                // top and bottom edges of the ring
+                for ( j = std::max( col - ring, 0 );
+                      j <= std::min( col + ring, last );
+                      ++j )
+                {
+                    searchCell( i, j, x, y, flags, &nearest );
+                }
+            }
+            else
+            {
+                // left and right edges of the ring
+                if ( col - ring >= 0 )
+                {
+                    searchCell( i, col - ring, x, y, flags, &nearest );
+                }
+
+                if ( col + ring <= last )
+                {
+                    searchCell( i, col + ring, x, y, flags, &nearest );
+                }
+            }
+        }
+    }
+
+    return nearest.sorted();
+}
+
+void NxNSceneGraph::findBatch(
+    const sgdc::DynamicArray<Query>& queries,
+    sgdc::DynamicArray<sgdc::DynamicArray<ICollider*>>& results ) const
+{
+    // minimum number of queries worth handing to another worker
+    const unsigned int GRAIN = 32;
+
+    unsigned int count = queries.size();
+    unsigned int i;
+
+    // every range writes to its own pre-sized slots so no locking is needed
+    results = sgdc::DynamicArray<sgdc::DynamicArray<ICollider*>>(
+        std::max( count, 1u ) );
+    for ( i = 0; i < count; ++i )
+    {
+        results.push( sgdc::DynamicArray<ICollider*>() );
+    }
+
+    sgdj::JobSystem::inst().parallelFor( count, GRAIN,
+        [this, &queries, &results]( unsigned int start, unsigned int end ) {
+            findRange( &queries, &results, start, end );
+        } );
 }
 
 // HELPER FUNCTIONS
+void NxNSceneGraph::findRange(
+    const sgdc::DynamicArray<Query>* queries,
+    sgdc::DynamicArray<sgdc::DynamicArray<ICollider*>>* results,
+    unsigned int start, unsigned int end ) const
+{
+    unsigned int i;
+    for ( i = start; i < end; ++i )
+    {
+        const Query& query = ( *queries )[i];
+        ( *results )[i] = find( query.bounds, query.flags );
+    }
+}
+
+void NxNSceneGraph::beginWalk( const gel::math::Vec2& origin,
+                               const gel::math::Vec2& direction,
+                               float distance, CellWalk* walk ) const
+{
+    const float inf = std::numeric_limits<float>::infinity();
+    float cellSize = d_size / d_divs;
+
+    // an origin outside of the graph starts in the edge cell it clamps to
+    walk->col = getColumn( origin.x );
+    walk->row = getRow( origin.y );
+    walk->prevCol = walk->col;
+    walk->prevRow = walk->row;
+    walk->first = true;
+    walk->enter = 0.0f;
+    walk->end = distance;
+
+    if ( direction.x > 0.0f )
+    {
+        walk->stepX = 1;
+        walk->nextX = ( ( walk->col + 1 ) * cellSize - origin.x ) /
+                      direction.x;
+        walk->deltaX = cellSize / direction.x;
+    }
+    else if ( direction.x < 0.0f )
+    {
+        walk->stepX = -1;
+        walk->nextX = ( walk->col * cellSize - origin.x ) / direction.x;
+        walk->deltaX = -cellSize / direction.x;
+    }
+    else
+    {
+        walk->stepX = 0;
+        walk->nextX = inf;
+        walk->deltaX = inf;
+    }
+
+    if ( direction.y > 0.0f )
+    {
+        walk->stepY = 1;
+        walk->nextY = ( ( walk->row + 1 ) * cellSize - origin.y ) /
+                      direction.y;
+        walk->deltaY = cellSize / direction.y;
+    }
+    else if ( direction.y < 0.0f )
+    {
+        walk->stepY = -1;
+        walk->nextY = ( walk->row * cellSize - origin.y ) / direction.y;
+        walk->deltaY = -cellSize / direction.y;
+    }
+    else
+    {
+        walk->stepY = 0;
+        walk->nextY = inf;
+        walk->deltaY = inf;
+    }
+
+    // the edge cells have no far edge
+    if ( ( walk->stepX < 0 && walk->col == 0 ) ||
+         ( walk->stepX > 0 && walk->col == d_divs - 1 ) )
+    {
+        walk->nextX = inf;
+    }
+
+    if ( ( walk->stepY < 0 && walk->row == 0 ) ||
+         ( walk->stepY > 0 && walk->row == d_divs - 1 ) )
+    {
+        walk->nextY = inf;
+    }
+
+    walk->exit = std::min( std::min( walk->nextX, walk->nextY ), walk->end );
+}
+
+bool NxNSceneGraph::advanceWalk( CellWalk* walk ) const
+{
+    const float inf = std::numeric_limits<float>::infinity();
+
+    if ( walk->exit >= walk->end )
+    {
+        return false;
+    }
+
+    walk->prevCol = walk->col;
+    walk->prevRow = walk->row;
+    walk->first = false;
+
+    // step across whichever cell edge is reached first, which is never
+    // the missing far edge of an edge cell as the walk would have ended
+    if ( walk->nextX < walk->nextY )
+    {
+        walk->col += walk->stepX;
+        walk->nextX = ( walk->stepX < 0 && walk->col == 0 ) ||
+                      ( walk->stepX > 0 && walk->col == d_divs - 1 )
+                      ? inf : walk->nextX + walk->deltaX;
+    }
+    else
+    {
+        walk->row += walk->stepY;
+        walk->nextY = ( walk->stepY < 0 && walk->row == 0 ) ||
+                      ( walk->stepY > 0 && walk->row == d_divs - 1 )
+                      ? inf : walk->nextY + walk->deltaY;
+    }
+
+    walk->enter = walk->exit;
+    walk->exit = std::min( std::min( walk->nextX, walk->nextY ), walk->end );
+
+    return true;
+}
+
+void NxNSceneGraph::searchCell( unsigned int row, unsigned int col, float x,
+                                float y, unsigned short flags,
+                                NearestColliders* nearest ) const
+{
+    const PackedColliderArray& contents =
+        d_cells[getIndex( row, col )].contents;
+    ICollider* collider;
+    unsigned int i;
+    float distance;
+
+    for ( i = 0; i < contents.size(); ++i )
+    {
+        distance = contents.distanceSquared( i, x, y );
+
+        if ( nearest->isFull() && distance >= nearest->farthest() )
+        {
+            continue;
+        }
+
+        collider = contents.collider( i );
+
+        // colliders spanning several cells are seen once per cell
+        if ( collider->canCollide( flags ) && !nearest->contains( collider ) )
+        {
+            nearest->offer( collider, distance );
+        }
+    }
+}
+
+RectangleBounds NxNSceneGraph::walkBounds( const gel::math::Vec2& origin,
+                                           const gel::math::Vec2& direction,
+                                           const CellWalk& walk ) const
+{
+    // grown slightly so bounds that only touch the ray are not rounded away
+    float slack = d_size / d_divs * 0.0001f;
+    RectangleBounds bounds = rayBounds( origin, direction, walk.enter,
+                                        std::max( walk.enter, walk.exit ) );
+
+    return RectangleBounds( bounds.x() - slack, bounds.y() - slack,
+                            bounds.width() + slack * 2.0f,
+                            bounds.height() + slack * 2.0f );
+}
+
 void NxNSceneGraph::initializeCells()
 {
     unsigned int i;
@@ -132,8 +659,7 @@ void NxNSceneGraph::initializeCells()
             d_cells[getIndex( i, j )].bounds =
                 RectangleBounds( left, top, cellSize, cellSize );
 
-            d_cells[getIndex( i, j )].contents =
-                sgdc::DynamicArray<ICollider*>();
+            d_cells[getIndex( i, j )].contents = PackedColliderArray();
         }
     }
 
@@ -152,28 +678,12 @@ void NxNSceneGraph::initializeCells()
 NxNSceneGraph::CellRegion
 NxNSceneGraph::getCellRegion( const RectangleBounds& bounds ) const
 {
-    // clip bounds to graph region
-    RectangleBounds clipped = RectangleBounds(
-        std::max( 0.0f, bounds.x() ),
-        std::max( 0.0f, bounds.y() ),
-        std::max( 0.0f, ( bounds.right() > d_size ) ?
-                          d_size - bounds.x() :
-                          bounds.width() ),
-        std::max( 0.0f, ( bounds.bottom() > d_size ) ?
-                          d_size - bounds.y() :
-                          bounds.height() ) );
-
-    // convert bounds to indices
-    float cellSize = d_size / d_divs;
+    // convert bounds to indices clipped to the graph region
     CellRegion r;
-    r.left = static_cast<unsigned int>(
-        std::floor( clipped.left() / cellSize ) );
-    r.top = static_cast<unsigned int>(
-        std::floor( clipped.top() / cellSize ) );
-    r.right = static_cast<unsigned int>(
-        std::ceil( clipped.right() / cellSize ) );
-    r.bottom = static_cast<unsigned int>(
-        std::ceil( clipped.bottom() / cellSize ) );
+    r.left = getColumn( bounds.left() );
+    r.top = getRow( bounds.top() );
+    r.right = getColumn( bounds.right() );
+    r.bottom = getRow( bounds.bottom() );
 
     return r;
 }
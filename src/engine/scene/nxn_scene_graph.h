@@ -4,6 +4,11 @@
 
 #include "../containers/dynamic_array.h"
 #include "icollider.h"
+#include "nearest_colliders.h"
+#include "packed_collider_array.h"
+#include <algorithm>
+#include <cmath>
+#include <gel/math/vec.h>
 
 namespace StevensDev
 {
@@ -37,14 +42,34 @@ namespace sgds
 
 class NxNSceneGraph
 {
+  public:
+    // TYPES
+    struct Query
+    {
+        RectangleBounds bounds;
+          // The region to search.
+
+        unsigned short flags;
+          // The flags that the colliders must be able to collide with.
+    };
+
+    struct RayHit
+    {
+        ICollider* collider;
+          // The collider that was hit or nullptr if nothing was hit.
+
+        float distance;
+          // The distance along the ray to the hit.
+    };
+
   private:
     struct Cell
     {
         RectangleBounds bounds;
           // The bounds of the cell.
 
-        sgdc::DynamicArray<ICollider*> contents;
-          // The list of items inside of the cell.
+        PackedColliderArray contents;
+          // The items inside of the cell and their cached bounds.
     };
 
     struct CellRegion
@@ -62,6 +87,53 @@ class NxNSceneGraph
           // The bottom-most row in the region.
     };
 
+    struct CellWalk
+    {
+        unsigned int row;
+          // The row of the current cell.
+
+        unsigned int col;
+          // The column of the current cell.
+
+        unsigned int prevRow;
+          // The row of the previously visited cell.
+
+        unsigned int prevCol;
+          // The column of the previously visited cell.
+
+        bool first;
+          // If the current cell is the first cell of the walk.
+
+        float enter;
+          // The distance along the ray where it enters the current cell.
+
+        float exit;
+          // The distance along the ray where it leaves the current cell.
+
+        float end;
+          // The distance along the ray where the walk ends.
+
+        int stepX;
+          // The column step taken when crossing a vertical cell edge.
+
+        int stepY;
+          // The row step taken when crossing a horizontal cell edge.
+
+        float nextX;
+          // The distance along the ray to the next vertical cell edge or
+          // infinity past the last one.
+
+        float nextY;
+          // The distance along the ray to the next horizontal cell edge or
+          // infinity past the last one.
+
+        float deltaX;
+          // The distance along the ray between vertical cell edges.
+
+        float deltaY;
+          // The distance along the ray between horizontal cell edges.
+    };
+
     sgdm::AllocatorGuard<Cell> d_cellAlloc;
       // Allocates the cells.
 
@@ -83,9 +155,74 @@ class NxNSceneGraph
     unsigned int getIndex( unsigned int row, unsigned int col ) const;
       // Gets the index of the cell at the given row and column.
 
+    unsigned int getColumn( float x ) const;
+      // Gets the column that contains the given x position clamped to the
+      // graph, or the first column if x is not a number.
+
+    unsigned int getRow( float y ) const;
+      // Gets the row that contains the given y position clamped to the
+      // graph.
+
     CellRegion getCellRegion( const RectangleBounds& bounds ) const;
       // Get the region of cells that the given bounds collides with.
 
+    bool isReference( const CellRegion& region,
+                      const PackedColliderArray& contents,
+                      unsigned int index, unsigned int row,
+                      unsigned int col ) const;
+      // Checks if the cell at the given row and column is the one that
+      // reports the collider at the given index of its contents for a
+      // query over the region.
+      //
+      // An item that spans several cells is only reported by the first cell
+      // that it shares with the region which prevents duplicates.
+
+    bool isWalkReference( const CellWalk& walk,
+                          const PackedColliderArray& contents,
+                          unsigned int index, float entry ) const;
+      // Checks if the current cell of the walk is the one that reports the
+      // collider at the given index of its contents, which the ray enters
+      // at the given distance.
+      //
+      // This is the first cell that holds the collider where the walk has
+      // reached the entry distance. A walk only ever steps forward along
+      // each axis, so the cells it visits that hold a collider are visited
+      // one after another and the previous cell settles whether this one
+      // is the first.
+
+    void beginWalk( const gel::math::Vec2& origin,
+                    const gel::math::Vec2& direction, float distance,
+                    CellWalk* walk ) const;
+      // Starts a walk over the cells that the ray passes through within the
+      // given distance.
+      //
+      // The edge cells reach out past the graph, as they hold the colliders
+      // clamped into them, so a ray outside of the graph walks along them.
+      //
+      // Requirements:
+      // direction is unit length
+
+    bool advanceWalk( CellWalk* walk ) const;
+      // Steps the walk into the next cell along the ray and returns false
+      // if the walk has ended.
+
+    void searchCell( unsigned int row, unsigned int col, float x, float y,
+                     unsigned short flags, NearestColliders* nearest ) const;
+      // Offers the colliders with the given flags in the cell to the
+      // nearest collection by their distance from the point.
+
+    RectangleBounds walkBounds( const gel::math::Vec2& origin,
+                                const gel::math::Vec2& direction,
+                                const CellWalk& walk ) const;
+      // Gets the bounds of the part of the ray in the current cell.
+
+    void findRange(
+        const sgdc::DynamicArray<Query>* queries,
+        sgdc::DynamicArray<sgdc::DynamicArray<ICollider*>>* results,
+        unsigned int start, unsigned int end ) const;
+      // Runs the queries in the range [start, end) and stores their results
+      // at the same indices.
+
   public:
     // CONSTRUCTORS
     NxNSceneGraph();
@@ -119,23 +256,96 @@ class NxNSceneGraph
       // Removes a collider from the scene.
 
     sgdc::DynamicArray<ICollider*> find( float x, float y, float width,
-                                         float height );
+                                         float height ) const;
       // Finds the colliders in the specified region.
 
     sgdc::DynamicArray<ICollider*> find( float x, float y, float width,
-                                         float height, unsigned short flags );
+                                         float height,
+                                         unsigned short flags ) const;
       // Finds the colliders in the specified region with the given flags.
 
-    sgdc::DynamicArray<ICollider*> find( const RectangleBounds& bounds );
+    sgdc::DynamicArray<ICollider*> find( const RectangleBounds& bounds ) const;
       // Finds the colliders in the specified rectangular region.
 
     sgdc::DynamicArray<ICollider*> find( const RectangleBounds& bounds,
-                                         unsigned short flags );
+                                         unsigned short flags ) const;
       // Finds the flags in the specified rectangular region with the given
       // flags.
+      //
+      // Bounds are tested against the cached bounds of each collider four
+      // at a time and doesCollide is only called for precise colliders.
 
-    sgdc::DynamicArray<ICollider*> find( const ICollider* collider );
+    sgdc::DynamicArray<ICollider*> find( const ICollider* collider ) const;
       // Gets the colliders that are colliding with the given object.
+
+    RayHit raycast( const gel::math::Vec2& origin,
+                    const gel::math::Vec2& direction,
+                    float maxDistance, unsigned short flags ) const;
+      // Finds the first collider with the given flags that the ray hits
+      // within the max distance.
+      //
+      // The cells are walked in order along the ray and the walk stops as
+      // soon as a hit is closer than the end of the current cell. The hit
+      // collider is nullptr if nothing is hit. Like find, colliders outside
+      // of the graph are hit through the edge cells they are clamped into.
+      //
+      // Requirements:
+      // direction is not zero
+
+    sgdc::DynamicArray<ICollider*> segmentQuery(
+        const gel::math::Vec2& start, const gel::math::Vec2& end ) const;
+      // Finds the colliders that the line segment passes through.
+
+    sgdc::DynamicArray<ICollider*> segmentQuery(
+        const gel::math::Vec2& start, const gel::math::Vec2& end,
+        unsigned short flags ) const;
+      // Finds the colliders with the given flags that the line segment
+      // passes through.
+      //
+      // Colliders are reported in the order of the cells where the segment
+      // reaches them. Colliders outside of the graph are found as they are
+      // by raycast.
+
+    sgdc::DynamicArray<ICollider*> circleQuery(
+        const gel::math::Vec2& center, float radius ) const;
+      // Finds the colliders that overlap the circle.
+
+    sgdc::DynamicArray<ICollider*> circleQuery(
+        const gel::math::Vec2& center, float radius,
+        unsigned short flags ) const;
+      // Finds the colliders with the given flags that overlap the circle.
+      //
+      // Bounds are tested against the circle's bounds four at a time before
+      // the distance to the circle's center is checked.
+      //
+      // Precise colliders are confirmed with doesCollide against the
+      // circle's bounds since colliders can only test rectangles, so a
+      // shape that only overlaps the corners of those bounds outside of the
+      // circle is still reported.
+
+    sgdc::DynamicArray<ICollider*> nearest( float x, float y,
+                                            unsigned int count ) const;
+      // Finds up to count of the colliders closest to the point.
+
+    sgdc::DynamicArray<ICollider*> nearest( float x, float y,
+                                            unsigned int count,
+                                            unsigned short flags ) const;
+      // Finds up to count of the colliders with the given flags closest to
+      // the point ordered from closest to farthest.
+      //
+      // Rings of cells are searched outward from the point's cell and the
+      // search stops once no unsearched cell can hold a closer collider.
+      // Distances are measured to the colliders' bounds.
+
+    void findBatch(
+        const sgdc::DynamicArray<Query>& queries,
+        sgdc::DynamicArray<sgdc::DynamicArray<ICollider*>>& results ) const;
+      // Runs each query and stores its results at the same index in results
+      // splitting the batch across the job system's workers.
+      //
+      // The results are identical to calling find for each query in order.
+      // The graph must not be modified during the call and the colliders'
+      // canCollide and doesCollide must be safe to call concurrently.
 };
 
 // FREE OPERATORS
@@ -184,7 +394,8 @@ NxNSceneGraph::~NxNSceneGraph()
 // MEMBER FUNCTIONS
 inline
 sgdc::DynamicArray<ICollider*> NxNSceneGraph::find( float x, float y,
-                                                    float width, float height )
+                                                    float width,
+                                                    float height ) const
 {
     return find( x, y, width, height, 0 );
 }
@@ -193,24 +404,46 @@ inline
 sgdc::DynamicArray<ICollider*> NxNSceneGraph::find( float x, float y,
                                                     float width, float height,
                                                     unsigned short flags )
+    const
 {
     return find( RectangleBounds( x, y, width, height ), flags );
 }
 
 inline
 sgdc::DynamicArray<ICollider*> NxNSceneGraph::find(
-    const RectangleBounds& bounds )
+    const RectangleBounds& bounds ) const
 {
     return find( bounds, 0 );
 }
 
 inline
 sgdc::DynamicArray<ICollider*> NxNSceneGraph::find(
-    const ICollider* collider )
+    const ICollider* collider ) const
 {
     return find( collider->bounds(), collider->flags() );
 }
 
+inline
+sgdc::DynamicArray<ICollider*> NxNSceneGraph::nearest(
+    float x, float y, unsigned int count ) const
+{
+    return nearest( x, y, count, 0 );
+}
+
+inline
+sgdc::DynamicArray<ICollider*> NxNSceneGraph::segmentQuery(
+    const gel::math::Vec2& start, const gel::math::Vec2& end ) const
+{
+    return segmentQuery( start, end, 0 );
+}
+
+inline
+sgdc::DynamicArray<ICollider*> NxNSceneGraph::circleQuery(
+    const gel::math::Vec2& center, float radius ) const
+{
+    return circleQuery( center, radius, 0 );
+}
+
 // HELPER FUNCTIONS
 inline
 unsigned int
@@ -219,6 +452,61 @@ NxNSceneGraph::getIndex( unsigned int row, unsigned int col ) const
     return row * d_divs + col;
 }
 
+inline
+unsigned int NxNSceneGraph::getColumn( float x ) const
+{
+    float column = std::floor( x / ( d_size / d_divs ) );
+
+    // clamp before converting since a float that is out of range or not a
+    // number has no unsigned value
+    if ( !( column > 0.0f ) )
+    {
+        return 0;
+    }
+
+    if ( column >= d_divs - 1 )
+    {
+        return d_divs - 1;
+    }
+
+    return static_cast<unsigned int>( column );
+}
+
+inline
+unsigned int NxNSceneGraph::getRow( float y ) const
+{
+    // the graph is square so rows and columns are the same size
+    return getColumn( y );
+}
+
+inline
+bool NxNSceneGraph::isReference( const CellRegion& region,
+                                 const PackedColliderArray& contents,
+                                 unsigned int index, unsigned int row,
+                                 unsigned int col ) const
+{
+    return std::max( region.top, getRow( contents.top( index ) ) ) == row &&
+           std::max( region.left, getColumn( contents.left( index ) ) ) == col;
+}
+
+inline
+bool NxNSceneGraph::isWalkReference( const CellWalk& walk,
+                                     const PackedColliderArray& contents,
+                                     unsigned int index, float entry ) const
+{
+    if ( walk.exit < entry )
+    {
+        return false;
+    }
+
+    // the previous cell ended before the entry so it could not report it
+    return walk.first || walk.enter < entry ||
+           walk.prevRow < getRow( contents.top( index ) ) ||
+           walk.prevRow > getRow( contents.bottom( index ) ) ||
+           walk.prevCol < getColumn( contents.left( index ) ) ||
+           walk.prevCol > getColumn( contents.right( index ) );
+}
+
 } // End nspc sgds
 
 } // End nspc StevensDev
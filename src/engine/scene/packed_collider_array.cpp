@@ -0,0 +1,78 @@
+// packed_collider_array.cpp
+#include "packed_collider_array.h"
+
+namespace StevensDev
+{
+
+namespace sgds
+{
+
+// MEMBER FUNCTIONS
+bool PackedColliderArray::remove( const ICollider* collider )
+{
+    const float inf = std::numeric_limits<float>::infinity();
+    unsigned int i;
+    unsigned int last;
+
+    for ( i = 0; i < d_size && d_colliders[i] != collider; ++i )
+    {
+        // do nothing
+    }
+
+    if ( i >= d_size )
+    {
+        return false;
+    }
+
+    // fill the hole with the last collider
+    last = d_size - 1;
+    d_left[i] = d_left[last];
+    d_top[i] = d_top[last];
+    d_right[i] = d_right[last];
+    d_bottom[i] = d_bottom[last];
+    d_colliders[i] = d_colliders[last];
+    d_precise[i] = d_precise[last];
+
+    d_left[last] = inf;
+    d_top[last] = inf;
+    d_right[last] = -inf;
+    d_bottom[last] = -inf;
+    --d_size;
+
+    return true;
+}
+
+// HELPER FUNCTIONS
+void PackedColliderArray::grow()
+{
+    float* left = d_left;
+    float* top = d_top;
+    float* right = d_right;
+    float* bottom = d_bottom;
+    ICollider** colliders = d_colliders;
+    bool* precise = d_precise;
+    unsigned int capacity = d_capacity;
+
+    allocate( ( capacity > 0 ) ? capacity * 2 : LANES * 2 );
+
+    if ( capacity > 0 )
+    {
+        sgdm::Mem::copy<float>( d_left, left, d_size );
+        sgdm::Mem::copy<float>( d_top, top, d_size );
+        sgdm::Mem::copy<float>( d_right, right, d_size );
+        sgdm::Mem::copy<float>( d_bottom, bottom, d_size );
+        sgdm::Mem::copy<ICollider*>( d_colliders, colliders, d_size );
+        sgdm::Mem::copy<bool>( d_precise, precise, d_size );
+
+        d_edgeAlloc.release( left, capacity );
+        d_edgeAlloc.release( top, capacity );
+        d_edgeAlloc.release( right, capacity );
+        d_edgeAlloc.release( bottom, capacity );
+        d_colliderAlloc.release( colliders, capacity );
+        d_preciseAlloc.release( precise, capacity );
+    }
+}
+
+} // End nspc sgds
+
+} // End nspc StevensDev
@@ -0,0 +1,411 @@
+// packed_collider_array.h
+//
+// Stores a set of colliders alongside a packed structure-of-arrays copy of
+// their bounds. Keeping the edges in separate contiguous arrays allows the
+// overlap test to be run against several colliders at once using SIMD
+// instructions without chasing a pointer into each collider.
+//
+// The bounds are cached when the collider is added so a collider that moves
+// must be removed and added again for the cached bounds to be updated.
+#ifndef INCLUDED_PACKED_COLLIDER_ARRAY
+#define INCLUDED_PACKED_COLLIDER_ARRAY
+
+#include "../memory/allocator_guard.h"
+#include "../memory/mem.h"
+#include <assert.h>
+#include "icollider.h"
+#include <algorithm>
+#include <limits>
+
+#if defined( __SSE__ )
+#include <xmmintrin.h>
+#endif
+
+namespace StevensDev
+{
+
+namespace sgds
+{
+
+class PackedColliderArray
+{
+  public:
+    // CONSTANTS
+    static const unsigned int LANES = 4;
+      // The number of colliders that are checked by each overlap test.
+
+  private:
+    // MEMBERS
+    sgdm::AllocatorGuard<float> d_edgeAlloc;
+      // Allocates the edge arrays.
+
+    sgdm::AllocatorGuard<ICollider*> d_colliderAlloc;
+      // Allocates the collider array.
+
+    sgdm::AllocatorGuard<bool> d_preciseAlloc;
+      // Allocates the precision flag array.
+
+    float* d_left;
+      // The left edge of each collider's bounds.
+
+    float* d_top;
+      // The top edge of each collider's bounds.
+
+    float* d_right;
+      // The right edge of each collider's bounds.
+
+    float* d_bottom;
+      // The bottom edge of each collider's bounds.
+
+    ICollider** d_colliders;
+      // The colliders.
+
+    bool* d_precise;
+      // If each collider must be checked with doesCollide after its bounds
+      // overlap.
+
+    unsigned int d_size;
+      // The number of colliders.
+
+    unsigned int d_capacity;
+      // The number of colliders that can be stored before growing.
+      //
+      // This is always a multiple of LANES so a full block can be read.
+
+    // HELPER FUNCTIONS
+    void allocate( unsigned int capacity );
+      // Allocates the arrays for the given capacity and clears the edges.
+
+    void release();
+      // Releases the arrays.
+
+    void copy( const PackedColliderArray& other );
+      // Copies the contents of the other array into this one.
+      //
+      // Requirements:
+      // this has at least as much capacity as other.
+
+    void grow();
+      // Doubles the capacity.
+
+  public:
+    // CONSTRUCTORS
+    PackedColliderArray();
+      // Constructs a new empty array.
+
+    PackedColliderArray( const PackedColliderArray& other );
+      // Constructs a copy of the other array.
+
+    ~PackedColliderArray();
+      // Destructs the array.
+
+    // OPERATORS
+    PackedColliderArray& operator=( const PackedColliderArray& other );
+      // Makes this a copy of the other array.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int size() const;
+      // Gets the number of colliders.
+
+    ICollider* collider( unsigned int index ) const;
+      // Gets the collider at the given index.
+
+    float left( unsigned int index ) const;
+      // Gets the cached left edge of the collider at the given index.
+
+    float top( unsigned int index ) const;
+      // Gets the cached top edge of the collider at the given index.
+
+    float right( unsigned int index ) const;
+      // Gets the cached right edge of the collider at the given index.
+
+    float bottom( unsigned int index ) const;
+      // Gets the cached bottom edge of the collider at the given index.
+
+    bool isPrecise( unsigned int index ) const;
+      // Checks if the collider at the given index has a precise shape.
+
+    float distanceSquared( unsigned int index, float x, float y ) const;
+      // Gets the squared distance from the point to the closest point of
+      // the cached bounds of the collider at the given index.
+      //
+      // The distance is zero when the point is inside of the bounds.
+
+    // MEMBER FUNCTIONS
+    void push( ICollider* collider );
+      // Adds the collider and caches its bounds.
+
+    bool remove( const ICollider* collider );
+      // Removes the collider and returns if it was found.
+      //
+      // The last collider takes the place of the removed one so the order is
+      // not preserved.
+
+    unsigned int overlapMask( unsigned int start,
+                              const RectangleBounds& bounds ) const;
+      // Tests the LANES colliders beginning at the given index against the
+      // bounds and returns a mask where bit n is set if the collider at
+      // start + n overlaps them.
+      //
+      // Requirements:
+      // start is a multiple of LANES
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream,
+                          const PackedColliderArray& array )
+{
+    sgdd::JsonPrinter p( stream );
+    p.open().print( "size", array.size() ).close();
+    return stream;
+}
+
+// CONSTRUCTORS
+inline
+PackedColliderArray::PackedColliderArray()
+    : d_edgeAlloc(), d_colliderAlloc(), d_preciseAlloc(), d_left( nullptr ),
+      d_top( nullptr ), d_right( nullptr ), d_bottom( nullptr ),
+      d_colliders( nullptr ), d_precise( nullptr ), d_size( 0 ),
+      d_capacity( 0 )
+{
+}
+
+inline
+PackedColliderArray::PackedColliderArray( const PackedColliderArray& other )
+    : d_edgeAlloc(), d_colliderAlloc(), d_preciseAlloc(), d_left( nullptr ),
+      d_top( nullptr ), d_right( nullptr ), d_bottom( nullptr ),
+      d_colliders( nullptr ), d_precise( nullptr ), d_size( 0 ),
+      d_capacity( 0 )
+{
+    if ( other.d_capacity > 0 )
+    {
+        allocate( other.d_capacity );
+        copy( other );
+    }
+}
+
+inline
+PackedColliderArray::~PackedColliderArray()
+{
+    release();
+}
+
+// OPERATORS
+inline
+PackedColliderArray& PackedColliderArray::operator=(
+    const PackedColliderArray& other )
+{
+    if ( &other == this )
+    {
+        return *this;
+    }
+
+    release();
+
+    if ( other.d_capacity > 0 )
+    {
+        allocate( other.d_capacity );
+        copy( other );
+    }
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int PackedColliderArray::size() const
+{
+    return d_size;
+}
+
+inline
+ICollider* PackedColliderArray::collider( unsigned int index ) const
+{
+    assert( index < d_size );
+    return d_colliders[index];
+}
+
+inline
+float PackedColliderArray::left( unsigned int index ) const
+{
+    assert( index < d_size );
+    return d_left[index];
+}
+
+inline
+float PackedColliderArray::top( unsigned int index ) const
+{
+    assert( index < d_size );
+    return d_top[index];
+}
+
+inline
+float PackedColliderArray::right( unsigned int index ) const
+{
+    assert( index < d_size );
+    return d_right[index];
+}
+
+inline
+float PackedColliderArray::bottom( unsigned int index ) const
+{
+    assert( index < d_size );
+    return d_bottom[index];
+}
+
+inline
+bool PackedColliderArray::isPrecise( unsigned int index ) const
+{
+    assert( index < d_size );
+    return d_precise[index];
+}
+
+inline
+float PackedColliderArray::distanceSquared( unsigned int index, float x,
+                                            float y ) const
+{
+    assert( index < d_size );
+
+    float dx = std::max( 0.0f, std::max( d_left[index] - x,
+                                         x - d_right[index] ) );
+    float dy = std::max( 0.0f, std::max( d_top[index] - y,
+                                         y - d_bottom[index] ) );
+
+    return dx * dx + dy * dy;
+}
+
+// MEMBER FUNCTIONS
+inline
+void PackedColliderArray::push( ICollider* collider )
+{
+    assert( collider != nullptr );
+
+    if ( d_size >= d_capacity )
+    {
+        grow();
+    }
+
+    const RectangleBounds& bounds = collider->bounds();
+
+    d_left[d_size] = bounds.left();
+    d_top[d_size] = bounds.top();
+    d_right[d_size] = bounds.right();
+    d_bottom[d_size] = bounds.bottom();
+    d_colliders[d_size] = collider;
+    d_precise[d_size] = collider->isPrecise();
+    ++d_size;
+}
+
+inline
+unsigned int PackedColliderArray::overlapMask(
+    unsigned int start, const RectangleBounds& bounds ) const
+{
+    assert( start % LANES == 0 );
+    assert( start < d_size );
+
+    // lanes past the end hold cleared edges so they must be masked off
+    unsigned int count = d_size - start;
+    unsigned int valid = ( count >= LANES ) ? ( 1u << LANES ) - 1 :
+                                              ( 1u << count ) - 1;
+
+#if defined( __SSE__ )
+    __m128 left = _mm_loadu_ps( d_left + start );
+    __m128 top = _mm_loadu_ps( d_top + start );
+    __m128 right = _mm_loadu_ps( d_right + start );
+    __m128 bottom = _mm_loadu_ps( d_bottom + start );
+
+    // same comparisons as RectangleBounds::doesCollide
+    __m128 horizontal = _mm_and_ps(
+        _mm_cmple_ps( left, _mm_set1_ps( bounds.right() ) ),
+        _mm_cmpge_ps( right, _mm_set1_ps( bounds.left() ) ) );
+    __m128 vertical = _mm_and_ps(
+        _mm_cmple_ps( top, _mm_set1_ps( bounds.bottom() ) ),
+        _mm_cmpge_ps( bottom, _mm_set1_ps( bounds.top() ) ) );
+
+    return static_cast<unsigned int>(
+        _mm_movemask_ps( _mm_and_ps( horizontal, vertical ) ) ) & valid;
+#else
+    unsigned int mask = 0;
+    unsigned int i;
+    for ( i = 0; i < LANES; ++i )
+    {
+        if ( d_left[start + i] <= bounds.right() &&
+             d_right[start + i] >= bounds.left() &&
+             d_top[start + i] <= bounds.bottom() &&
+             d_bottom[start + i] >= bounds.top() )
+        {
+            mask |= 1u << i;
+        }
+    }
+
+    return mask & valid;
+#endif
+}
+
+// HELPER FUNCTIONS
+inline
+void PackedColliderArray::allocate( unsigned int capacity )
+{
+    assert( capacity % LANES == 0 );
+
+    // unused lanes are given inverted bounds so a block can always be read
+    const float inf = std::numeric_limits<float>::infinity();
+
+    d_left = d_edgeAlloc.get( capacity );
+    d_top = d_edgeAlloc.get( capacity );
+    d_right = d_edgeAlloc.get( capacity );
+    d_bottom = d_edgeAlloc.get( capacity );
+    d_colliders = d_colliderAlloc.get( capacity );
+    d_precise = d_preciseAlloc.get( capacity );
+    d_capacity = capacity;
+
+    sgdm::Mem::set<float>( d_left, inf, capacity );
+    sgdm::Mem::set<float>( d_top, inf, capacity );
+    sgdm::Mem::set<float>( d_right, -inf, capacity );
+    sgdm::Mem::set<float>( d_bottom, -inf, capacity );
+}
+
+inline
+void PackedColliderArray::release()
+{
+    if ( d_capacity > 0 )
+    {
+        d_edgeAlloc.release( d_left, d_capacity );
+        d_edgeAlloc.release( d_top, d_capacity );
+        d_edgeAlloc.release( d_right, d_capacity );
+        d_edgeAlloc.release( d_bottom, d_capacity );
+        d_colliderAlloc.release( d_colliders, d_capacity );
+        d_preciseAlloc.release( d_precise, d_capacity );
+    }
+
+    d_left = nullptr;
+    d_top = nullptr;
+    d_right = nullptr;
+    d_bottom = nullptr;
+    d_colliders = nullptr;
+    d_precise = nullptr;
+    d_size = 0;
+    d_capacity = 0;
+}
+
+inline
+void PackedColliderArray::copy( const PackedColliderArray& other )
+{
+    assert( d_capacity >= other.d_size );
+
+    sgdm::Mem::copy<float>( d_left, other.d_left, other.d_size );
+    sgdm::Mem::copy<float>( d_top, other.d_top, other.d_size );
+    sgdm::Mem::copy<float>( d_right, other.d_right, other.d_size );
+    sgdm::Mem::copy<float>( d_bottom, other.d_bottom, other.d_size );
+    sgdm::Mem::copy<ICollider*>( d_colliders, other.d_colliders,
+                                 other.d_size );
+    sgdm::Mem::copy<bool>( d_precise, other.d_precise, other.d_size );
+    d_size = other.d_size;
+}
+
+} // End nspc sgds
+
+} // End nspc StevensDev
+
+#endif
@@ -1,5 +1,7 @@
 // scene.cpp
 #include "scene.h"
+#include "../profiling/profile_scope.h"
+#include "../time/time_source.h"
 
 namespace StevensDev
 {
@@ -7,39 +9,170 @@ namespace StevensDev
 namespace sgds
 {
 
+// CONSTANTS
+const unsigned int Scene::MAX_DEFERRALS;
+
 Scene Scene::d_instance = Scene();
 
 void Scene::tick()
 {
+    sgdk::EngineClock::inst().update();
+    d_clock.update();
+
+    tick( d_clock.elapsedSeconds() );
+}
+
+void Scene::tick( float elapsedS )
+{
+#ifdef GAME_PROFILE
+    // gather the zones that were recorded during the previous frame
+    sgdp::Profiler::inst().collect();
+#endif
+
+    PROFILE_SCOPE( "Scene::tick" );
+
+    d_frameStart = sgdk::TimeSource::now();
+
+    unsigned int steps = d_timestep.advance( elapsedS );
+    unsigned int i;
+
+    for ( i = 0; i < steps; ++i )
+    {
+        step( d_timestep.dt() );
+    }
+
+    // draw if possible
+    if ( d_renderer != nullptr )
+    {
+        d_renderer->draw( d_timestep.alpha() );
+    }
+}
+
+void Scene::step( float dtS )
+{
+    const sgdc::DynamicArray<ITickable*>& tickables = d_tickables.tickables();
     unsigned int i;
 
     // pre-tick cycle
-    for ( i = 0; i < d_tickables.size(); ++i )
     {
-        d_tickables[i]->preTick();
+        PROFILE_SCOPE( "ITickable::preTick" );
+
+        applyChanges();
+
+        d_tickables.beginStep( d_steps++, dtS );
+
+        if ( d_isParallel )
+        {
+            d_schedule.preTick( [this]( unsigned int index )
+                                {
+                                    return claim( index );
+                                } );
+        }
+        else
+        {
+            for ( i = 0; i < tickables.size(); ++i )
+            {
+                if ( claim( i ) )
+                {
+                    tickables[i]->preTick();
+                }
+            }
+        }
     }
 
     // tick cycle
-    for ( i = 0; i < d_tickables.size(); ++i )
     {
-        d_tickables[i]->tick( d_clock.getElapsedTime().asSeconds() );
+        PROFILE_SCOPE( "ITickable::tick" );
+
+        applyChanges();
+
+        if ( d_isParallel )
+        {
+            d_schedule.tick( [this]( unsigned int index )
+                             {
+                                 return d_tickables.isDue( index );
+                             },
+                             [this]( unsigned int index )
+                             {
+                                 return d_tickables.dt( index );
+                             } );
+        }
+        else
+        {
+            for ( i = 0; i < tickables.size(); ++i )
+            {
+                if ( d_tickables.isDue( i ) )
+                {
+                    tickables[i]->tick( d_tickables.dt( i ) );
+                }
+            }
+        }
     }
 
-    // draw if possible
-    if ( d_renderer != nullptr )
+    // post-tick cycle
     {
-        d_renderer->draw();
+        PROFILE_SCOPE( "ITickable::postTick" );
+
+        applyChanges();
+
+        if ( d_isParallel )
+        {
+            d_schedule.postTick( [this]( unsigned int index )
+                                 {
+                                     return d_tickables.isDue( index );
+                                 } );
+        }
+        else
+        {
+            for ( i = 0; i < tickables.size(); ++i )
+            {
+                if ( d_tickables.isDue( i ) )
+                {
+                    tickables[i]->postTick();
+                }
+            }
+        }
+
+        d_tickables.endStep();
     }
+}
 
-    // post-tick cycle
-    for ( i = 0; i < d_tickables.size(); ++i )
+// HELPER FUNCTIONS
+bool Scene::claim( unsigned int index )
+{
+    if ( !d_tickables.isDue( index ) )
     {
-        d_tickables[i]->postTick();
+        return false;
     }
 
-    d_clock.restart();
+    // deferrable work waits for a frame with time to spare, but not so
+    // long that it starves when no frame has any
+    if ( d_tickBudget > 0 && d_tickables.isDeferrable( index ) &&
+         d_tickables.deferrals( index ) < MAX_DEFERRALS &&
+         sgdk::TimeUnits::toSeconds( sgdk::TimeSource::now() -
+                                     d_frameStart ) > d_tickBudget )
+    {
+        d_tickables.defer( index );
+        return false;
+    }
+
+    return true;
+}
+
+void Scene::applyChanges()
+{
+    if ( d_tickables.flush() )
+    {
+        d_isScheduleDirty = true;
+    }
+
+    if ( d_isParallel && d_isScheduleDirty )
+    {
+        d_schedule.build( d_tickables.tickables() );
+        d_isScheduleDirty = false;
+    }
 }
 
 } // End nspc sgds
 
-} // End nspc StevensDev
\ No newline at end of file
+} // End nspc StevensDev
@@ -2,8 +2,14 @@
 #ifndef INCLUDED_SCENE
 #define INCLUDED_SCENE
 
-#include "../rendering/renderer.h"
+#include "../rendering/irenderer.h"
+#include "../time/clock.h"
+#include "../time/engine_clock.h"
+#include "../time/time_units.h"
+#include "fixed_timestep.h"
 #include "itickable.h"
+#include "tick_schedule.h"
+#include "tickable_registry.h"
 
 namespace StevensDev
 {
@@ -13,18 +19,59 @@ namespace sgds
 
 class Scene
 {
+  public:
+    // CONSTANTS
+    static const unsigned int MAX_DEFERRALS = 4;
+      // The most steps in a row that a deferrable tickable is deferred
+      // before it runs regardless of the budget.
+
   private:
     static Scene d_instance;
       // The singleton instance.
 
-    sgdr::Renderer* d_renderer;
+    sgdr::IRenderer* d_renderer;
       // The renderer used to draw the scene.
 
-    sgdc::DynamicArray<ITickable*> d_tickables;
-      // The objects in the scene.
+    TickableRegistry d_tickables;
+      // The objects in the scene in dispatch order.
+
+    sgdk::Clock d_clock;
+      // The clock used for timing which follows the engine clock.
+
+    TickSchedule d_schedule;
+      // The waves used to tick in parallel.
+
+    bool d_isScheduleDirty;
+      // If the tickables changed since the schedule was built.
+
+    bool d_isParallel;
+      // If tickables with conflict-free accesses tick concurrently.
+
+    FixedTimestep d_timestep;
+      // Converts elapsed time into simulation steps.
+
+    unsigned long long d_steps;
+      // The number of simulation steps that have been taken.
 
-    sf::Clock d_clock;
-      // The clock used for timing.
+    float d_tickBudget;
+      // The time in seconds after which deferrable tickables are deferred
+      // or zero if there is no budget.
+
+    sgdk::TimePoint d_frameStart;
+      // When the current frame started.
+
+    // HELPER FUNCTIONS
+    void step( float dtS );
+      // Runs every phase of one simulation step.
+
+    bool claim( unsigned int index );
+      // Checks if the tickable at the dispatch index is due this step,
+      // deferring it first if it is deferrable, the frame is over budget
+      // and it has not been deferred too many steps in a row.
+
+    void applyChanges();
+      // Applies queued tickable additions and removals and rebuilds the
+      // parallel schedule if needed.
 
     // CONSTRUCTORS
     Scene();
@@ -49,9 +96,42 @@ class Scene
     float getHeight() const;
       // Gets the height of the scene (window) in pixels.
 
+    bool isParallel() const;
+      // Checks if tickables are ticked in parallel.
+
+    sgdk::Clock& clock();
+      // Gets the clock that times the scene.
+      //
+      // Scaling or pausing it slows or stops the simulation without
+      // affecting other subsystems.
+
+    float step() const;
+      // Gets the length of a simulation step in seconds or zero if every
+      // frame takes one step of the elapsed time.
+
+    unsigned int maxSteps() const;
+      // Gets the maximum number of simulation steps taken in one frame.
+
+    float interpolation() const;
+      // Gets how far in [0, 1] the last frame was between the previous and
+      // current simulation steps.
+
+    float tickBudget() const;
+      // Gets the time in seconds after which deferrable tickables are
+      // deferred or zero if there is no budget.
+
     // MEMBER FUNCTIONS
     void tick();
-      // Updates the scene.
+      // Updates the engine clock and then the scene using the time that
+      // elapsed on the scene clock.
+
+    void tick( float elapsedS );
+      // Updates the scene as if the elapsed time in seconds had passed.
+      //
+      // Every tickable that runs each step sees the same delta time while
+      // those with longer intervals see the time since they last ran. With
+      // a fixed step this runs as many whole steps as have accumulated, up
+      // to the maximum, and then draws once.
 
     void addRenderable( const sgdr::RenderableSprite* sprite );
       // Add a sprite to the scene.
@@ -59,14 +139,59 @@ class Scene
     void removeRenderable( const sgdr::RenderableSprite* sprite );
       // Removes a sprite from the scene.
 
-    void addTickable( ITickable* tickable );
-      // Adds a tickable to the scene.
+    TickableHandle addTickable( ITickable* tickable, int priority = 0,
+                                unsigned int interval = 1,
+                                bool isDeferrable = false );
+      // Adds a tickable to the scene with the priority and returns its
+      // handle.
+      //
+      // Lower priorities tick first and equal priorities tick in the order
+      // they were added. The tickable joins at the start of the next phase.
+      //
+      // With an interval of N the tickable runs on one step out of every N
+      // and ticks with the time of all N. Tickables with the same interval
+      // are spread evenly across the steps in the order they were added.
+      // Deferrable tickables may also be deferred to a later step when the
+      // tick budget is used up, whatever their priority.
+
+    bool removeTickable( TickableHandle handle );
+      // Removes a tickable from the scene and returns false if the handle
+      // does not refer to one.
+      //
+      // The tickable leaves at the start of the next phase and must stay
+      // alive until then.
 
     void removeTickable( ITickable* tickable );
       // Removes a tickable from the scene.
+      //
+      // This searches every tickable so prefer removing by handle.
 
-    void setRenderer( sgdr::Renderer* renderer );
+    void setRenderer( sgdr::IRenderer* renderer );
       // Sets the renderer that is used by the scene.
+      //
+      // A null renderer lets the scene run without a window.
+
+    void setStep( float stepS );
+      // Sets the length of a simulation step in seconds or zero so that
+      // every frame takes one step of the elapsed time.
+
+    void setMaxSteps( unsigned int maxSteps );
+      // Sets the maximum number of simulation steps taken in one frame.
+
+    void setTickBudget( float budgetS );
+      // Sets the time in seconds into a frame after which deferrable
+      // tickables that have not started the step are deferred to the next
+      // one or zero to never defer them.
+      //
+      // A tickable is never deferred more than MAX_DEFERRALS steps in a
+      // row so it still runs when every frame is over budget.
+
+    void setParallel( bool isParallel );
+      // Sets if tickables are ticked in parallel.
+      //
+      // When parallel, each phase runs the tickables in waves built from
+      // their declared accesses using the job system. Otherwise every
+      // tickable runs in the order it was added on the calling thread.
 
     // GLOBAL FUNCTIONS
     static Scene& inst();
@@ -81,13 +206,24 @@ std::ostream& operator<<( std::ostream& stream, const Scene& scene )
 
 // CONSTRUCTORS
 inline
-Scene::Scene() : d_renderer( nullptr ), d_tickables()
+Scene::Scene() : d_renderer( nullptr ), d_tickables(),
+                 d_clock( &sgdk::EngineClock::inst().clock() ), d_schedule(),
+                 d_isScheduleDirty( true ), d_isParallel( false ),
+                 d_timestep(), d_steps( 0 ), d_tickBudget( 0 ),
+                 d_frameStart( 0 )
 {
 }
 
 inline
 Scene::Scene( const Scene& scene ) : d_renderer( scene.d_renderer ),
-                                     d_tickables( scene.d_tickables )
+                                     d_tickables( scene.d_tickables ),
+                                     d_clock( scene.d_clock ),
+                                     d_schedule(), d_isScheduleDirty( true ),
+                                     d_isParallel( scene.d_isParallel ),
+                                     d_timestep( scene.d_timestep ),
+                                     d_steps( scene.d_steps ),
+                                     d_tickBudget( scene.d_tickBudget ),
+                                     d_frameStart( scene.d_frameStart )
 {
 }
 
@@ -103,6 +239,13 @@ Scene& Scene::operator=( const Scene& scene )
 {
     d_renderer = scene.d_renderer;
     d_tickables = scene.d_tickables;
+    d_clock = scene.d_clock;
+    d_isScheduleDirty = true;
+    d_isParallel = scene.d_isParallel;
+    d_timestep = scene.d_timestep;
+    d_steps = scene.d_steps;
+    d_tickBudget = scene.d_tickBudget;
+    d_frameStart = scene.d_frameStart;
     return *this;
 }
 
@@ -121,6 +264,42 @@ float Scene::getHeight() const
     return d_renderer->height();
 }
 
+inline
+bool Scene::isParallel() const
+{
+    return d_isParallel;
+}
+
+inline
+sgdk::Clock& Scene::clock()
+{
+    return d_clock;
+}
+
+inline
+float Scene::step() const
+{
+    return d_timestep.step();
+}
+
+inline
+unsigned int Scene::maxSteps() const
+{
+    return d_timestep.maxSteps();
+}
+
+inline
+float Scene::interpolation() const
+{
+    return d_timestep.alpha();
+}
+
+inline
+float Scene::tickBudget() const
+{
+    return d_tickBudget;
+}
+
 inline
 void Scene::addRenderable( const sgdr::RenderableSprite* sprite )
 {
@@ -136,23 +315,55 @@ void Scene::removeRenderable( const sgdr::RenderableSprite* sprite )
 }
 
 inline
-void Scene::addTickable( ITickable* tickable )
+TickableHandle Scene::addTickable( ITickable* tickable, int priority,
+                                   unsigned int interval, bool isDeferrable )
+{
+    return d_tickables.add( tickable, priority, interval, isDeferrable );
+}
+
+inline
+bool Scene::removeTickable( TickableHandle handle )
 {
-    d_tickables.push( tickable );
+    return d_tickables.remove( handle );
 }
 
 inline
 void Scene::removeTickable( ITickable* tickable )
 {
-    d_tickables.remove( tickable );
+    d_tickables.remove( d_tickables.find( tickable ) );
 }
 
 inline
-void Scene::setRenderer( sgdr::Renderer* renderer )
+void Scene::setRenderer( sgdr::IRenderer* renderer )
 {
     d_renderer = renderer;
 }
 
+inline
+void Scene::setStep( float stepS )
+{
+    d_timestep.setStep( stepS );
+}
+
+inline
+void Scene::setMaxSteps( unsigned int maxSteps )
+{
+    d_timestep.setMaxSteps( maxSteps );
+}
+
+inline
+void Scene::setTickBudget( float budgetS )
+{
+    assert( budgetS >= 0 );
+    d_tickBudget = budgetS;
+}
+
+inline
+void Scene::setParallel( bool isParallel )
+{
+    d_isParallel = isParallel;
+}
+
 inline
 Scene& Scene::inst()
 {
@@ -0,0 +1,15 @@
+// tick_access.cpp
+#include "tick_access.h"
+
+namespace StevensDev
+{
+
+namespace sgds
+{
+
+// CONSTANTS
+const unsigned int TickAccess::MAX_RESOURCES;
+
+} // End nspc sgds
+
+} // End nspc StevensDev
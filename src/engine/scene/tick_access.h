@@ -0,0 +1,211 @@
+// tick_access.h
+//
+// Describes the resources that a tickable reads and writes while it ticks
+// and the ordering group that it belongs to. Resources are identified by
+// the game as indices in [0, MAX_RESOURCES).
+//
+// Tickables whose accesses do not conflict may tick at the same time. A
+// default constructed access is exclusive and conflicts with everything so
+// tickables that do not declare their accesses keep running alone.
+#ifndef INCLUDED_TICK_ACCESS
+#define INCLUDED_TICK_ACCESS
+
+#include <assert.h>
+#include <ostream>
+
+namespace StevensDev
+{
+
+namespace sgds
+{
+
+class TickAccess
+{
+  public:
+    // CONSTANTS
+    static const unsigned int MAX_RESOURCES = 64;
+      // The number of distinct resources that can be declared.
+
+  private:
+    unsigned long long d_reads;
+      // The set of resources that are read.
+
+    unsigned long long d_writes;
+      // The set of resources that are written.
+
+    unsigned int d_group;
+      // The ordering group.
+
+    bool d_isExclusive;
+      // If this conflicts with every other access.
+
+  public:
+    // CONSTRUCTORS
+    TickAccess();
+      // Constructs a new exclusive access in group zero.
+
+    TickAccess( const TickAccess& access );
+      // Constructs a copy of the access.
+
+    ~TickAccess();
+      // Destructs the access.
+
+    // OPERATORS
+    TickAccess& operator=( const TickAccess& access );
+      // Makes this a copy of the access.
+
+    // ACCESSOR FUNCTIONS
+    unsigned long long readSet() const;
+      // Gets the set of resources that are read.
+
+    unsigned long long writeSet() const;
+      // Gets the set of resources that are written.
+
+    unsigned int group() const;
+      // Gets the ordering group.
+
+    bool isExclusive() const;
+      // Checks if this conflicts with every other access.
+
+    // MUTATOR FUNCTIONS
+    TickAccess& reads( unsigned int resource );
+      // Declares that the resource is read and makes this non-exclusive.
+
+    TickAccess& writes( unsigned int resource );
+      // Declares that the resource is written and makes this
+      // non-exclusive.
+
+    TickAccess& inGroup( unsigned int group );
+      // Sets the ordering group.
+      //
+      // Every tickable in a lower group finishes each phase before any
+      // tickable in a higher group starts it.
+
+    TickAccess& exclusive();
+      // Makes this conflict with every other access.
+
+    // MEMBER FUNCTIONS
+    bool conflicts( const TickAccess& access ) const;
+      // Checks if the two accesses cannot run at the same time.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const TickAccess& access )
+{
+    return stream << "{ \"reads\": " << access.readSet()
+                  << ", \"writes\": " << access.writeSet()
+                  << ", \"group\": " << access.group()
+                  << ", \"exclusive\": "
+                  << ( access.isExclusive() ? "true" : "false" ) << " }";
+}
+
+// CONSTRUCTORS
+inline
+TickAccess::TickAccess()
+    : d_reads( 0 ), d_writes( 0 ), d_group( 0 ), d_isExclusive( true )
+{
+}
+
+inline
+TickAccess::TickAccess( const TickAccess& access )
+    : d_reads( access.d_reads ), d_writes( access.d_writes ),
+      d_group( access.d_group ), d_isExclusive( access.d_isExclusive )
+{
+}
+
+inline
+TickAccess::~TickAccess()
+{
+}
+
+// OPERATORS
+inline
+TickAccess& TickAccess::operator=( const TickAccess& access )
+{
+    d_reads = access.d_reads;
+    d_writes = access.d_writes;
+    d_group = access.d_group;
+    d_isExclusive = access.d_isExclusive;
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned long long TickAccess::readSet() const
+{
+    return d_reads;
+}
+
+inline
+unsigned long long TickAccess::writeSet() const
+{
+    return d_writes;
+}
+
+inline
+unsigned int TickAccess::group() const
+{
+    return d_group;
+}
+
+inline
+bool TickAccess::isExclusive() const
+{
+    return d_isExclusive;
+}
+
+// MUTATOR FUNCTIONS
+inline
+TickAccess& TickAccess::reads( unsigned int resource )
+{
+    assert( resource < MAX_RESOURCES );
+
+    d_reads |= 1ull << resource;
+    d_isExclusive = false;
+
+    return *this;
+}
+
+inline
+TickAccess& TickAccess::writes( unsigned int resource )
+{
+    assert( resource < MAX_RESOURCES );
+
+    d_writes |= 1ull << resource;
+    d_isExclusive = false;
+
+    return *this;
+}
+
+inline
+TickAccess& TickAccess::inGroup( unsigned int group )
+{
+    d_group = group;
+
+    return *this;
+}
+
+inline
+TickAccess& TickAccess::exclusive()
+{
+    d_isExclusive = true;
+
+    return *this;
+}
+
+// MEMBER FUNCTIONS
+inline
+bool TickAccess::conflicts( const TickAccess& access ) const
+{
+    return d_isExclusive || access.d_isExclusive ||
+           ( d_writes & ( access.d_reads | access.d_writes ) ) != 0 ||
+           ( access.d_writes & d_reads ) != 0;
+}
+
+} // End nspc sgds
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,103 @@
+// tick_schedule.cpp
+#include "tick_schedule.h"
+#include <algorithm>
+
+namespace StevensDev
+{
+
+namespace sgds
+{
+
+// CONSTANTS
+const unsigned int TickSchedule::GRAIN;
+
+// MEMBER FUNCTIONS
+void TickSchedule::build( const sgdc::DynamicArray<ITickable*>& tickables )
+{
+    unsigned int count = tickables.size();
+    sgdc::DynamicArray<TickAccess> accesses( count > 0 ? count : 1 );
+    sgdc::DynamicArray<unsigned int> waves( count > 0 ? count : 1 );
+    unsigned int groupFloor = 0;
+    unsigned int groupTop = 0;
+    unsigned int group = 0;
+    unsigned int next;
+    unsigned int end = 0;
+    unsigned int wave;
+    unsigned int i;
+    unsigned int j;
+    bool isPending;
+
+    clear();
+
+    for ( i = 0; i < count; ++i )
+    {
+        accesses.push( tickables[i]->access() );
+        waves.push( 0 );
+    }
+
+    // place each group, lowest first, after every wave of the groups below
+    // it and each tickable after every earlier one in its group that it
+    // conflicts with
+    isPending = count > 0;
+    if ( isPending )
+    {
+        group = accesses[0].group();
+        for ( i = 1; i < count; ++i )
+        {
+            group = std::min( group, accesses[i].group() );
+        }
+    }
+
+    while ( isPending )
+    {
+        isPending = false;
+        next = group;
+
+        for ( i = 0; i < count; ++i )
+        {
+            if ( accesses[i].group() == group )
+            {
+                waves[i] = groupFloor;
+                for ( j = 0; j < i; ++j )
+                {
+                    if ( accesses[j].group() == group &&
+                         accesses[i].conflicts( accesses[j] ) )
+                    {
+                        waves[i] = std::max( waves[i], waves[j] + 1 );
+                    }
+                }
+
+                groupTop = std::max( groupTop, waves[i] + 1 );
+            }
+            else if ( accesses[i].group() > group &&
+                      ( !isPending || accesses[i].group() < next ) )
+            {
+                next = accesses[i].group();
+                isPending = true;
+            }
+        }
+
+        groupFloor = groupTop;
+        group = next;
+    }
+
+    // lay the tickables out wave by wave keeping the order they were added
+    for ( wave = 0; wave < groupFloor; ++wave )
+    {
+        for ( i = 0; i < count; ++i )
+        {
+            if ( waves[i] == wave )
+            {
+                d_order.push( tickables[i] );
+                d_indices.push( i );
+                ++end;
+            }
+        }
+
+        d_waveEnds.push( end );
+    }
+}
+
+} // End nspc sgds
+
+} // End nspc StevensDev
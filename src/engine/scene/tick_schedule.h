@@ -0,0 +1,279 @@
+// tick_schedule.h
+//
+// Orders tickables into waves using their declared accesses so that each
+// wave holds only tickables that do not conflict with one another. The
+// waves of a phase run one after another while the tickables in a wave run
+// across the job system's workers.
+//
+// Lower groups always finish before higher ones and, within a group,
+// conflicting tickables keep the order in which they were added.
+//
+// Each phase can also be limited to the tickables that are due, which are
+// identified by the index that they had in the list that was built from.
+#ifndef INCLUDED_TICK_SCHEDULE
+#define INCLUDED_TICK_SCHEDULE
+
+#include "../containers/dynamic_array.h"
+#include "../jobs/job_system.h"
+#include <assert.h>
+#include "itickable.h"
+
+namespace StevensDev
+{
+
+namespace sgds
+{
+
+class TickSchedule
+{
+  private:
+    // CONSTANTS
+    static const unsigned int GRAIN = 1;
+      // The number of tickables run by each job.
+
+    // MEMBERS
+    sgdc::DynamicArray<ITickable*> d_order;
+      // The scheduled tickables ordered wave by wave.
+
+    sgdc::DynamicArray<unsigned int> d_indices;
+      // The index in the built list of each scheduled tickable.
+
+    sgdc::DynamicArray<unsigned int> d_waveEnds;
+      // The index one past the last tickable of each wave.
+
+    // HELPER FUNCTIONS
+    template <typename F>
+    void runWaves( const F& function );
+      // Runs the function on every tickable and its index one wave at a
+      // time.
+
+  public:
+    // CONSTRUCTORS
+    TickSchedule();
+      // Constructs a new empty schedule.
+
+    TickSchedule( const TickSchedule& schedule );
+      // Constructs a copy of the schedule.
+
+    ~TickSchedule();
+      // Destructs the schedule.
+
+    // OPERATORS
+    TickSchedule& operator=( const TickSchedule& schedule );
+      // Makes this a copy of the schedule.
+
+    // ACCESSOR FUNCTIONS
+    unsigned int size() const;
+      // Gets the number of scheduled tickables.
+
+    unsigned int waves() const;
+      // Gets the number of waves.
+
+    unsigned int waveSize( unsigned int wave ) const;
+      // Gets the number of tickables in the wave.
+
+    ITickable* get( unsigned int wave, unsigned int index ) const;
+      // Gets a tickable in the wave.
+
+    // MEMBER FUNCTIONS
+    void build( const sgdc::DynamicArray<ITickable*>& tickables );
+      // Replaces the schedule with one for the tickables which are given
+      // in the order that they were added.
+
+    void clear();
+      // Removes every tickable from the schedule.
+
+    void preTick();
+      // Pre-ticks every tickable.
+
+    void tick( float dtS );
+      // Ticks every tickable using the delta time.
+
+    void postTick();
+      // Post-ticks every tickable.
+
+    template <typename P>
+    void preTick( const P& isDue );
+      // Pre-ticks every tickable whose index satisfies the predicate.
+
+    template <typename P, typename D>
+    void tick( const P& isDue, const D& dtOf );
+      // Ticks every tickable whose index satisfies the predicate using the
+      // delta time that is given for its index.
+
+    template <typename P>
+    void postTick( const P& isDue );
+      // Post-ticks every tickable whose index satisfies the predicate.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream,
+                          const TickSchedule& schedule )
+{
+    return stream << "{ \"size\": " << schedule.size()
+                  << ", \"waves\": " << schedule.waves() << " }";
+}
+
+// CONSTRUCTORS
+inline
+TickSchedule::TickSchedule() : d_order(), d_indices(), d_waveEnds()
+{
+}
+
+inline
+TickSchedule::TickSchedule( const TickSchedule& schedule )
+    : d_order( schedule.d_order ), d_indices( schedule.d_indices ),
+      d_waveEnds( schedule.d_waveEnds )
+{
+}
+
+inline
+TickSchedule::~TickSchedule()
+{
+}
+
+// OPERATORS
+inline
+TickSchedule& TickSchedule::operator=( const TickSchedule& schedule )
+{
+    d_order = schedule.d_order;
+    d_indices = schedule.d_indices;
+    d_waveEnds = schedule.d_waveEnds;
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+unsigned int TickSchedule::size() const
+{
+    return d_order.size();
+}
+
+inline
+unsigned int TickSchedule::waves() const
+{
+    return d_waveEnds.size();
+}
+
+inline
+unsigned int TickSchedule::waveSize( unsigned int wave ) const
+{
+    assert( wave < d_waveEnds.size() );
+
+    return wave == 0 ? d_waveEnds[0]
+                     : d_waveEnds[wave] - d_waveEnds[wave - 1];
+}
+
+inline
+ITickable* TickSchedule::get( unsigned int wave, unsigned int index ) const
+{
+    assert( index < waveSize( wave ) );
+
+    return d_order[( wave == 0 ? 0 : d_waveEnds[wave - 1] ) + index];
+}
+
+// MEMBER FUNCTIONS
+inline
+void TickSchedule::clear()
+{
+    while ( d_order.size() > 0 )
+    {
+        d_order.pop();
+        d_indices.pop();
+    }
+
+    while ( d_waveEnds.size() > 0 )
+    {
+        d_waveEnds.pop();
+    }
+}
+
+inline
+void TickSchedule::preTick()
+{
+    preTick( []( unsigned int ) { return true; } );
+}
+
+inline
+void TickSchedule::tick( float dtS )
+{
+    tick( []( unsigned int ) { return true; },
+          [dtS]( unsigned int ) { return dtS; } );
+}
+
+inline
+void TickSchedule::postTick()
+{
+    postTick( []( unsigned int ) { return true; } );
+}
+
+template <typename P>
+void TickSchedule::preTick( const P& isDue )
+{
+    runWaves( [&isDue]( ITickable* tickable, unsigned int index )
+              {
+                  if ( isDue( index ) )
+                  {
+                      tickable->preTick();
+                  }
+              } );
+}
+
+template <typename P, typename D>
+void TickSchedule::tick( const P& isDue, const D& dtOf )
+{
+    runWaves( [&isDue, &dtOf]( ITickable* tickable, unsigned int index )
+              {
+                  if ( isDue( index ) )
+                  {
+                      tickable->tick( dtOf( index ) );
+                  }
+              } );
+}
+
+template <typename P>
+void TickSchedule::postTick( const P& isDue )
+{
+    runWaves( [&isDue]( ITickable* tickable, unsigned int index )
+              {
+                  if ( isDue( index ) )
+                  {
+                      tickable->postTick();
+                  }
+              } );
+}
+
+// HELPER FUNCTIONS
+template <typename F>
+void TickSchedule::runWaves( const F& function )
+{
+    unsigned int start = 0;
+    unsigned int wave;
+
+    for ( wave = 0; wave < d_waveEnds.size(); ++wave )
+    {
+        unsigned int end = d_waveEnds[wave];
+
+        sgdj::JobSystem::inst().parallelFor(
+            end - start, GRAIN,
+            [this, start, &function]( unsigned int first, unsigned int last )
+            {
+                unsigned int i;
+
+                for ( i = start + first; i < start + last; ++i )
+                {
+                    function( d_order[i], d_indices[i] );
+                }
+            } );
+
+        start = end;
+    }
+}
+
+} // End nspc sgds
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,201 @@
+// tickable_registry.cpp
+#include "tickable_registry.h"
+#include "../memory/allocator_guard.h"
+#include <algorithm>
+
+namespace StevensDev
+{
+
+namespace sgds
+{
+
+// CONSTANTS
+const TickableHandle TickableRegistry::INVALID_HANDLE;
+const unsigned int TickableRegistry::INDEX_BITS;
+const unsigned int TickableRegistry::INDEX_MASK;
+
+// ACCESSOR FUNCTIONS
+TickableHandle TickableRegistry::find( const ITickable* tickable ) const
+{
+    unsigned int i;
+
+    for ( i = 0; i < d_slots.size(); ++i )
+    {
+        if ( d_slots[i].isLive && d_slots[i].tickable == tickable )
+        {
+            return ( d_slots[i].generation << INDEX_BITS ) | i;
+        }
+    }
+
+    return INVALID_HANDLE;
+}
+
+// MEMBER FUNCTIONS
+TickableHandle TickableRegistry::add( ITickable* tickable, int priority,
+                                      unsigned int interval,
+                                      bool isDeferrable )
+{
+    assert( tickable != nullptr );
+    assert( interval > 0 );
+
+    unsigned int index;
+    Slot slot;
+
+    slot.tickable = tickable;
+    slot.priority = priority;
+    slot.sequence = d_sequence++;
+    slot.generation = 0;
+    slot.interval = interval;
+    slot.bucket = slot.sequence % interval;
+    slot.pendingDt = 0;
+    slot.isDeferrable = isDeferrable;
+    slot.isDue = false;
+    slot.deferrals = 0;
+    slot.isLive = true;
+    slot.isListed = false;
+
+    if ( d_free.size() > 0 )
+    {
+        index = d_free.pop();
+        slot.generation = d_slots[index].generation;
+    }
+    else
+    {
+        assert( d_slots.size() <= INDEX_MASK );
+
+        index = d_slots.size();
+        d_slots.push( slot );
+    }
+
+    // the top generation is the invalid handle so wrap before reaching it
+    if ( ( ( slot.generation << INDEX_BITS ) | index ) == INVALID_HANDLE )
+    {
+        slot.generation = 0;
+    }
+
+    d_slots[index] = slot;
+    d_pendingAddition.push( index );
+
+    return ( slot.generation << INDEX_BITS ) | index;
+}
+
+bool TickableRegistry::flush()
+{
+    bool isChanged = false;
+    unsigned int index;
+
+    // removals first so that a tickable added and removed before the flush
+    // is never listed
+    while ( d_pendingRemoval.size() > 0 )
+    {
+        index = d_pendingRemoval.popFront();
+
+        isChanged = isChanged || d_slots[index].isListed;
+
+        d_slots[index].tickable = nullptr;
+        d_slots[index].isListed = false;
+        d_slots[index].isDue = false;
+        d_slots[index].generation =
+            ( d_slots[index].generation + 1 ) & ( ~0u >> INDEX_BITS );
+        d_free.push( index );
+    }
+
+    while ( d_pendingAddition.size() > 0 )
+    {
+        index = d_pendingAddition.popFront();
+
+        if ( d_slots[index].isLive && !d_slots[index].isListed )
+        {
+            d_slots[index].isListed = true;
+            isChanged = true;
+        }
+    }
+
+    if ( isChanged )
+    {
+        rebuild();
+    }
+
+    return isChanged;
+}
+
+void TickableRegistry::beginStep( unsigned long long step, float dtS )
+{
+    unsigned int i;
+
+    for ( i = 0; i < d_order.size(); ++i )
+    {
+        Slot& slot = d_slots[d_order[i]];
+
+        slot.pendingDt += dtS;
+        slot.isDue = slot.deferrals > 0 ||
+                     step % slot.interval == slot.bucket;
+    }
+}
+
+void TickableRegistry::endStep()
+{
+    unsigned int i;
+
+    for ( i = 0; i < d_order.size(); ++i )
+    {
+        Slot& slot = d_slots[d_order[i]];
+
+        if ( slot.isDue )
+        {
+            slot.pendingDt = 0;
+            slot.isDue = false;
+            slot.deferrals = 0;
+        }
+    }
+}
+
+// HELPER FUNCTIONS
+void TickableRegistry::rebuild()
+{
+    sgdm::AllocatorGuard<unsigned int> alloc;
+    unsigned int count = 0;
+    unsigned int* order;
+    unsigned int i;
+
+    for ( i = 0; i < d_slots.size(); ++i )
+    {
+        count += d_slots[i].isListed ? 1 : 0;
+    }
+
+    order = alloc.get( count > 0 ? count : 1 );
+
+    for ( i = 0, count = 0; i < d_slots.size(); ++i )
+    {
+        if ( d_slots[i].isListed )
+        {
+            order[count++] = i;
+        }
+    }
+
+    std::sort( order, order + count,
+               [this]( unsigned int a, unsigned int b )
+               {
+                   const Slot& first = d_slots[a];
+                   const Slot& second = d_slots[b];
+
+                   return first.priority != second.priority ?
+                          first.priority < second.priority :
+                          first.sequence < second.sequence;
+               } );
+
+    d_tickables = sgdc::DynamicArray<ITickable*>( count > 0 ? count : 1 );
+    d_order = sgdc::DynamicArray<unsigned int>( count > 0 ? count : 1 );
+
+    for ( i = 0; i < count; ++i )
+    {
+        d_tickables.push( d_slots[order[i]].tickable );
+        d_order.push( order[i] );
+    }
+
+    alloc.release( order, count > 0 ? count : 1 );
+}
+
+} // End nspc sgds
+
+} // End nspc StevensDev
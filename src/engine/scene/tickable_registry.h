@@ -0,0 +1,366 @@
+// tickable_registry.h
+//
+// Keeps the tickables of a scene in dispatch order. Lower priorities are
+// dispatched first and tickables with equal priorities are dispatched in
+// the order that they were added.
+//
+// Like the event dispatcher, additions and removals are queued and only
+// applied by flush, which the scene calls between tick phases, so the
+// dispatch list never changes while it is being iterated. A removed
+// tickable is still dispatched until the next flush and must stay alive
+// until then.
+//
+// Registering and unregistering are constant time through handles. The
+// dispatch list is only rebuilt by a flush that applied a change.
+//
+// A tickable may also be given an update interval of N steps. Tickables
+// with the same interval are spread across N buckets so that only 1/N of
+// them run on any step, and each runs with all of the time that passed
+// since it last ran. Each step is bracketed by beginStep and endStep and a
+// tickable only runs its phases while it is due.
+#ifndef INCLUDED_TICKABLE_REGISTRY
+#define INCLUDED_TICKABLE_REGISTRY
+
+#include "../containers/dynamic_array.h"
+#include <assert.h>
+#include "itickable.h"
+
+namespace StevensDev
+{
+
+namespace sgds
+{
+
+typedef unsigned int TickableHandle;
+  // Identifies a registered tickable. Handles of removed tickables are
+  // never mistaken for the handles of later ones.
+
+class TickableRegistry
+{
+  public:
+    // CONSTANTS
+    static const TickableHandle INVALID_HANDLE = 0xffffffffu;
+      // A handle that never refers to a tickable.
+
+  private:
+    struct Slot
+    {
+        ITickable* tickable;
+          // The tickable or nullptr if the slot is free.
+
+        int priority;
+          // The dispatch priority where lower runs first.
+
+        unsigned int sequence;
+          // When the tickable was added relative to the others.
+
+        unsigned int generation;
+          // The number of times the slot has been freed.
+
+        unsigned int interval;
+          // The number of steps between runs.
+
+        unsigned int bucket;
+          // The step modulo the interval on which it runs.
+
+        float pendingDt;
+          // The time in seconds that passed since it last ran.
+
+        bool isDeferrable;
+          // If it may be deferred when a step is over budget.
+
+        bool isDue;
+          // If it runs during the current step.
+
+        unsigned int deferrals;
+          // The number of steps in a row that it was deferred.
+
+        bool isLive;
+          // If the tickable has not been removed.
+
+        bool isListed;
+          // If the tickable is in the dispatch list.
+    };
+
+    // CONSTANTS
+    static const unsigned int INDEX_BITS = 20;
+      // The number of handle bits that hold the slot index.
+
+    static const unsigned int INDEX_MASK = ( 1u << INDEX_BITS ) - 1;
+      // Extracts the slot index from a handle.
+
+    // MEMBERS
+    sgdc::DynamicArray<Slot> d_slots;
+      // Every slot that has been used.
+
+    sgdc::DynamicArray<unsigned int> d_free;
+      // The slots that can be reused.
+
+    sgdc::DynamicArray<unsigned int> d_pendingAddition;
+      // The slots to add to the dispatch list during the next flush.
+
+    sgdc::DynamicArray<unsigned int> d_pendingRemoval;
+      // The slots to remove from the dispatch list during the next flush.
+
+    sgdc::DynamicArray<ITickable*> d_tickables;
+      // The dispatch list.
+
+    sgdc::DynamicArray<unsigned int> d_order;
+      // The slot of each tickable in the dispatch list.
+
+    unsigned int d_sequence;
+      // The sequence given to the next added tickable.
+
+    // HELPER FUNCTIONS
+    int findSlot( TickableHandle handle ) const;
+      // Gets the slot of the live tickable with the handle or -1.
+
+    void rebuild();
+      // Rebuilds the dispatch list from the listed slots.
+
+  public:
+    // CONSTRUCTORS
+    TickableRegistry();
+      // Constructs a new empty registry.
+
+    TickableRegistry( const TickableRegistry& registry );
+      // Constructs a copy of the registry.
+
+    ~TickableRegistry();
+      // Destructs the registry.
+
+    // OPERATORS
+    TickableRegistry& operator=( const TickableRegistry& registry );
+      // Makes this a copy of the registry.
+
+    // ACCESSOR FUNCTIONS
+    const sgdc::DynamicArray<ITickable*>& tickables() const;
+      // Gets the tickables in dispatch order as of the last flush.
+
+    unsigned int size() const;
+      // Gets the number of tickables in the dispatch list.
+
+    unsigned int pending() const;
+      // Gets the number of additions and removals waiting for a flush.
+
+    bool contains( TickableHandle handle ) const;
+      // Checks if the handle refers to a tickable that was not removed.
+
+    TickableHandle find( const ITickable* tickable ) const;
+      // Gets the handle of a tickable that was not removed or
+      // INVALID_HANDLE.
+      //
+      // This searches every slot so prefer keeping the handle from add.
+
+    int priority( unsigned int index ) const;
+      // Gets the priority of the tickable at the dispatch index.
+
+    unsigned int interval( unsigned int index ) const;
+      // Gets the update interval of the tickable at the dispatch index.
+
+    bool isDeferrable( unsigned int index ) const;
+      // Checks if the tickable at the dispatch index may be deferred.
+
+    bool isDue( unsigned int index ) const;
+      // Checks if the tickable at the dispatch index runs this step.
+
+    unsigned int deferrals( unsigned int index ) const;
+      // Gets the number of steps in a row that the tickable at the
+      // dispatch index was deferred.
+
+    float dt( unsigned int index ) const;
+      // Gets the time in seconds that the tickable at the dispatch index
+      // should advance by this step.
+
+    // MEMBER FUNCTIONS
+    TickableHandle add( ITickable* tickable, int priority = 0,
+                        unsigned int interval = 1,
+                        bool isDeferrable = false );
+      // Queues the tickable to be added with the priority and update
+      // interval in steps and returns its handle.
+
+    bool remove( TickableHandle handle );
+      // Queues the tickable to be removed and returns false if the handle
+      // does not refer to a tickable.
+
+    bool flush();
+      // Applies the queued additions and removals and returns if the
+      // dispatch list changed.
+      //
+      // Tickables that are added during a step are not due until the next.
+
+    void beginStep( unsigned long long step, float dtS );
+      // Starts a step of dtS seconds and marks which tickables are due.
+
+    void defer( unsigned int index );
+      // Skips the tickable at the dispatch index for this step and makes
+      // it due on the next one.
+      //
+      // Requirements:
+      // the tickable has not run any phase this step
+
+    void endStep();
+      // Finishes the step and clears the time of every tickable that ran.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream,
+                          const TickableRegistry& registry )
+{
+    return stream << "{ \"size\": " << registry.size()
+                  << ", \"pending\": " << registry.pending() << " }";
+}
+
+// CONSTRUCTORS
+inline
+TickableRegistry::TickableRegistry()
+    : d_slots(), d_free(), d_pendingAddition(), d_pendingRemoval(),
+      d_tickables(), d_order(), d_sequence( 0 )
+{
+}
+
+inline
+TickableRegistry::TickableRegistry( const TickableRegistry& registry )
+    : d_slots( registry.d_slots ), d_free( registry.d_free ),
+      d_pendingAddition( registry.d_pendingAddition ),
+      d_pendingRemoval( registry.d_pendingRemoval ),
+      d_tickables( registry.d_tickables ), d_order( registry.d_order ),
+      d_sequence( registry.d_sequence )
+{
+}
+
+inline
+TickableRegistry::~TickableRegistry()
+{
+}
+
+// OPERATORS
+inline
+TickableRegistry& TickableRegistry::operator=(
+    const TickableRegistry& registry )
+{
+    d_slots = registry.d_slots;
+    d_free = registry.d_free;
+    d_pendingAddition = registry.d_pendingAddition;
+    d_pendingRemoval = registry.d_pendingRemoval;
+    d_tickables = registry.d_tickables;
+    d_order = registry.d_order;
+    d_sequence = registry.d_sequence;
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+const sgdc::DynamicArray<ITickable*>& TickableRegistry::tickables() const
+{
+    return d_tickables;
+}
+
+inline
+unsigned int TickableRegistry::size() const
+{
+    return d_tickables.size();
+}
+
+inline
+unsigned int TickableRegistry::pending() const
+{
+    return d_pendingAddition.size() + d_pendingRemoval.size();
+}
+
+inline
+bool TickableRegistry::contains( TickableHandle handle ) const
+{
+    return findSlot( handle ) >= 0;
+}
+
+inline
+int TickableRegistry::priority( unsigned int index ) const
+{
+    return d_slots[d_order[index]].priority;
+}
+
+inline
+unsigned int TickableRegistry::interval( unsigned int index ) const
+{
+    return d_slots[d_order[index]].interval;
+}
+
+inline
+bool TickableRegistry::isDeferrable( unsigned int index ) const
+{
+    return d_slots[d_order[index]].isDeferrable;
+}
+
+inline
+bool TickableRegistry::isDue( unsigned int index ) const
+{
+    return d_slots[d_order[index]].isDue;
+}
+
+inline
+unsigned int TickableRegistry::deferrals( unsigned int index ) const
+{
+    return d_slots[d_order[index]].deferrals;
+}
+
+inline
+float TickableRegistry::dt( unsigned int index ) const
+{
+    return d_slots[d_order[index]].pendingDt;
+}
+
+// MEMBER FUNCTIONS
+inline
+bool TickableRegistry::remove( TickableHandle handle )
+{
+    int slot = findSlot( handle );
+
+    if ( slot < 0 )
+    {
+        return false;
+    }
+
+    d_slots[slot].isLive = false;
+    d_pendingRemoval.push( static_cast<unsigned int>( slot ) );
+
+    return true;
+}
+
+inline
+void TickableRegistry::defer( unsigned int index )
+{
+    Slot& slot = d_slots[d_order[index]];
+
+    slot.isDue = false;
+    ++slot.deferrals;
+}
+
+// HELPER FUNCTIONS
+inline
+int TickableRegistry::findSlot( TickableHandle handle ) const
+{
+    unsigned int index = handle & INDEX_MASK;
+
+    if ( handle == INVALID_HANDLE || index >= d_slots.size() )
+    {
+        return -1;
+    }
+
+    const Slot& slot = d_slots[index];
+
+    if ( !slot.isLive || slot.generation != handle >> INDEX_BITS )
+    {
+        return -1;
+    }
+
+    return static_cast<int>( index );
+}
+
+} // End nspc sgds
+
+} // End nspc StevensDev
+
+#endif
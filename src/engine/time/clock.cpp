@@ -0,0 +1,2 @@
+// clock.cpp
+#include "clock.h"
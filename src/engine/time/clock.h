@@ -0,0 +1,279 @@
+// clock.h
+//
+// A game clock that follows the interface of gel::time::Clock, with a time
+// scale and pause, but keeps its time in whole nanoseconds.
+//
+// A clock either advances by durations that it is given or follows a parent
+// clock. A child clock advances by however much its parent advanced since
+// the child was last updated, scaled by its own time scale, so subsystems
+// can slow down or pause without affecting one another. Parents must be
+// updated before their children.
+#ifndef INCLUDED_CLOCK
+#define INCLUDED_CLOCK
+
+#include <assert.h>
+#include <ostream>
+#include "time_units.h"
+
+namespace StevensDev
+{
+
+namespace sgdk
+{
+
+class Clock
+{
+  private:
+    const Clock* d_parent;
+      // The clock that this follows or nullptr.
+
+    TimePoint d_time;
+      // The scaled time since the clock started.
+
+    TimePoint d_parentTime;
+      // The time of the parent when this was last updated.
+
+    Duration d_elapsed;
+      // The scaled time that passed during the last update.
+
+    float d_timeScale;
+      // The scale applied to time as it passes.
+
+    bool d_isPaused;
+      // If time does not pass.
+
+    // HELPER FUNCTIONS
+    Duration scale( Duration elapsed ) const;
+      // Applies the time scale and pause to the elapsed time.
+
+  public:
+    // CONSTRUCTORS
+    Clock();
+      // Constructs a new clock.
+
+    Clock( float timeScale );
+      // Constructs a new clock with the time scale.
+
+    Clock( const Clock* parent, float timeScale = 1.0f );
+      // Constructs a new clock that follows the parent.
+
+    Clock( const Clock& clock );
+      // Constructs a copy of the clock.
+
+    ~Clock();
+      // Destructs the clock.
+
+    // OPERATORS
+    Clock& operator=( const Clock& clock );
+      // Makes this a copy of the clock.
+
+    // ACCESSOR FUNCTIONS
+    const Clock* parent() const;
+      // Gets the clock that this follows or nullptr.
+
+    TimePoint time() const;
+      // Gets the scaled time in nanoseconds since the clock started.
+
+    Duration elapsed() const;
+      // Gets the scaled time in nanoseconds that passed during the last
+      // update.
+
+    float elapsedSeconds() const;
+      // Gets the scaled time in seconds that passed during the last update.
+
+    float timeScale() const;
+      // Gets the scale applied to time as it passes.
+
+    bool isPaused() const;
+      // Checks if time does not pass.
+
+    // MUTATOR FUNCTIONS
+    void setTimeScale( float timeScale );
+      // Sets the scale applied to time as it passes.
+
+    void setPaused( bool isPaused );
+      // Sets if time does not pass.
+
+    void setParent( const Clock* parent );
+      // Follows the parent from its current time or stops following any
+      // clock if the parent is nullptr.
+
+    // MEMBER FUNCTIONS
+    void update();
+      // Advances by the time the parent advanced since the last update.
+      //
+      // Requirements:
+      // the clock has a parent
+
+    void update( Duration elapsed );
+      // Advances by the elapsed real time in nanoseconds.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const Clock& clock )
+{
+    return stream << "{ \"time\": " << clock.time()
+                  << ", \"elapsed\": " << clock.elapsed()
+                  << ", \"timeScale\": " << clock.timeScale()
+                  << ", \"isPaused\": "
+                  << ( clock.isPaused() ? "true" : "false" ) << " }";
+}
+
+// CONSTRUCTORS
+inline
+Clock::Clock()
+    : d_parent( nullptr ), d_time( 0 ), d_parentTime( 0 ), d_elapsed( 0 ),
+      d_timeScale( 1.0f ), d_isPaused( false )
+{
+}
+
+inline
+Clock::Clock( float timeScale )
+    : d_parent( nullptr ), d_time( 0 ), d_parentTime( 0 ), d_elapsed( 0 ),
+      d_timeScale( timeScale ), d_isPaused( false )
+{
+    assert( timeScale >= 0 );
+}
+
+inline
+Clock::Clock( const Clock* parent, float timeScale )
+    : d_parent( parent ), d_time( 0 ),
+      d_parentTime( parent != nullptr ? parent->d_time : 0 ),
+      d_elapsed( 0 ), d_timeScale( timeScale ), d_isPaused( false )
+{
+    assert( timeScale >= 0 );
+}
+
+inline
+Clock::Clock( const Clock& clock )
+    : d_parent( clock.d_parent ), d_time( clock.d_time ),
+      d_parentTime( clock.d_parentTime ), d_elapsed( clock.d_elapsed ),
+      d_timeScale( clock.d_timeScale ), d_isPaused( clock.d_isPaused )
+{
+}
+
+inline
+Clock::~Clock()
+{
+}
+
+// OPERATORS
+inline
+Clock& Clock::operator=( const Clock& clock )
+{
+    d_parent = clock.d_parent;
+    d_time = clock.d_time;
+    d_parentTime = clock.d_parentTime;
+    d_elapsed = clock.d_elapsed;
+    d_timeScale = clock.d_timeScale;
+    d_isPaused = clock.d_isPaused;
+
+    return *this;
+}
+
+// ACCESSOR FUNCTIONS
+inline
+const Clock* Clock::parent() const
+{
+    return d_parent;
+}
+
+inline
+TimePoint Clock::time() const
+{
+    return d_time;
+}
+
+inline
+Duration Clock::elapsed() const
+{
+    return d_elapsed;
+}
+
+inline
+float Clock::elapsedSeconds() const
+{
+    return static_cast<float>( TimeUnits::toSeconds( d_elapsed ) );
+}
+
+inline
+float Clock::timeScale() const
+{
+    return d_timeScale;
+}
+
+inline
+bool Clock::isPaused() const
+{
+    return d_isPaused;
+}
+
+// MUTATOR FUNCTIONS
+inline
+void Clock::setTimeScale( float timeScale )
+{
+    assert( timeScale >= 0 );
+
+    d_timeScale = timeScale;
+}
+
+inline
+void Clock::setPaused( bool isPaused )
+{
+    d_isPaused = isPaused;
+}
+
+inline
+void Clock::setParent( const Clock* parent )
+{
+    assert( parent != this );
+
+    d_parent = parent;
+    d_parentTime = parent != nullptr ? parent->d_time : 0;
+}
+
+// MEMBER FUNCTIONS
+inline
+void Clock::update()
+{
+    assert( d_parent != nullptr );
+
+    TimePoint parentTime = d_parent->d_time;
+
+    update( static_cast<Duration>( parentTime - d_parentTime ) );
+    d_parentTime = parentTime;
+}
+
+inline
+void Clock::update( Duration elapsed )
+{
+    assert( elapsed >= 0 );
+
+    d_elapsed = scale( elapsed );
+    d_time += static_cast<TimePoint>( d_elapsed );
+}
+
+// HELPER FUNCTIONS
+inline
+Duration Clock::scale( Duration elapsed ) const
+{
+    if ( d_isPaused )
+    {
+        return 0;
+    }
+
+    if ( d_timeScale == 1.0f )
+    {
+        return elapsed;
+    }
+
+    return static_cast<Duration>( static_cast<double>( elapsed ) *
+                                  d_timeScale + 0.5 );
+}
+
+} // End nspc sgdk
+
+} // End nspc StevensDev
+
+#endif
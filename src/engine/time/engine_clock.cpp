@@ -0,0 +1,15 @@
+// engine_clock.cpp
+#include "engine_clock.h"
+
+namespace StevensDev
+{
+
+namespace sgdk
+{
+
+// GLOBALS
+EngineClock EngineClock::d_instance = EngineClock();
+
+} // End nspc sgdk
+
+} // End nspc StevensDev
@@ -0,0 +1,143 @@
+// engine_clock.h
+//
+// The root of the engine's clocks. It advances once per frame by the real
+// time read from the time source and every subsystem clock follows it,
+// directly or through other clocks.
+#ifndef INCLUDED_ENGINE_CLOCK
+#define INCLUDED_ENGINE_CLOCK
+
+#include "clock.h"
+#include "time_source.h"
+
+namespace StevensDev
+{
+
+namespace sgdk
+{
+
+class EngineClock
+{
+  private:
+    // GLOBALS
+    static EngineClock d_instance;
+      // The singleton instance.
+
+    // MEMBERS
+    Clock d_clock;
+      // The root clock.
+
+    TimePoint d_lastUpdate;
+      // The real time of the last update.
+
+    bool d_isStarted;
+      // If the clock has been updated at least once.
+
+    // CONSTRUCTORS
+    EngineClock();
+      // Constructs a new engine clock.
+
+    EngineClock( const EngineClock& clock );
+      // The engine clock cannot be copied.
+
+    // OPERATORS
+    EngineClock& operator=( const EngineClock& clock );
+      // The engine clock cannot be copied.
+
+  public:
+    // CONSTRUCTORS
+    ~EngineClock();
+      // Destructs the engine clock.
+
+    // ACCESSOR FUNCTIONS
+    Clock& clock();
+      // Gets the root clock that subsystem clocks follow.
+
+    const Clock& clock() const;
+      // Gets the root clock that subsystem clocks follow.
+
+    TimePoint lastUpdate() const;
+      // Gets the real time of the last update.
+
+    // MEMBER FUNCTIONS
+    void update();
+      // Advances the root clock by the real time since the last update.
+      //
+      // The first update starts the clock without advancing it.
+
+    void restart();
+      // Makes the next update start the clock again.
+
+    // GLOBAL FUNCTIONS
+    static EngineClock& inst();
+      // Gets the engine clock.
+};
+
+// FREE OPERATORS
+inline
+std::ostream& operator<<( std::ostream& stream, const EngineClock& clock )
+{
+    return stream << "{ \"clock\": " << clock.clock()
+                  << ", \"lastUpdate\": " << clock.lastUpdate() << " }";
+}
+
+// CONSTRUCTORS
+inline
+EngineClock::EngineClock()
+    : d_clock(), d_lastUpdate( 0 ), d_isStarted( false )
+{
+}
+
+inline
+EngineClock::~EngineClock()
+{
+}
+
+// ACCESSOR FUNCTIONS
+inline
+Clock& EngineClock::clock()
+{
+    return d_clock;
+}
+
+inline
+const Clock& EngineClock::clock() const
+{
+    return d_clock;
+}
+
+inline
+TimePoint EngineClock::lastUpdate() const
+{
+    return d_lastUpdate;
+}
+
+// MEMBER FUNCTIONS
+inline
+void EngineClock::update()
+{
+    TimePoint now = TimeSource::now();
+
+    d_clock.update( d_isStarted ?
+                    static_cast<Duration>( now - d_lastUpdate ) : 0 );
+    d_lastUpdate = now;
+    d_isStarted = true;
+}
+
+inline
+void EngineClock::restart()
+{
+    d_isStarted = false;
+}
+
+// GLOBAL FUNCTIONS
+inline
+EngineClock& EngineClock::inst()
+{
+    return d_instance;
+}
+
+} // End nspc sgdk
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,42 @@
+// time_source.cpp
+#include "time_source.h"
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#if defined( _POSIX_TIMERS ) && _POSIX_TIMERS > 0 && \
+    defined( CLOCK_MONOTONIC )
+#define SGDK_USE_CLOCK_GETTIME
+#else
+#include <chrono>
+#endif
+
+namespace StevensDev
+{
+
+namespace sgdk
+{
+
+// GLOBAL FUNCTIONS
+TimePoint TimeSource::now()
+{
+#ifdef SGDK_USE_CLOCK_GETTIME
+    struct timespec spec;
+
+    clock_gettime( CLOCK_MONOTONIC, &spec );
+
+    return static_cast<TimePoint>( spec.tv_sec ) *
+           TimeUnits::NANOS_PER_SECOND +
+           static_cast<TimePoint>( spec.tv_nsec );
+#else
+    return static_cast<TimePoint>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch() ).count() );
+#endif
+}
+
+} // End nspc sgdk
+
+} // End nspc StevensDev
@@ -0,0 +1,30 @@
+// time_source.h
+//
+// Reads the monotonic system clock. On POSIX systems this is clock_gettime
+// with CLOCK_MONOTONIC, which Linux serves from the TSC without a system
+// call, and elsewhere it falls back to std::chrono::steady_clock.
+#ifndef INCLUDED_TIME_SOURCE
+#define INCLUDED_TIME_SOURCE
+
+#include "time_units.h"
+
+namespace StevensDev
+{
+
+namespace sgdk
+{
+
+struct TimeSource
+{
+    // GLOBAL FUNCTIONS
+    static TimePoint now();
+      // Gets the current monotonic time in nanoseconds.
+      //
+      // This is safe to call from any thread and never goes backwards.
+};
+
+} // End nspc sgdk
+
+} // End nspc StevensDev
+
+#endif
@@ -0,0 +1,17 @@
+// time_units.cpp
+#include "time_units.h"
+
+namespace StevensDev
+{
+
+namespace sgdk
+{
+
+// CONSTANTS
+const Duration TimeUnits::NANOS_PER_MICRO;
+const Duration TimeUnits::NANOS_PER_MILLI;
+const Duration TimeUnits::NANOS_PER_SECOND;
+
+} // End nspc sgdk
+
+} // End nspc StevensDev
@@ -0,0 +1,76 @@
+// time_units.h
+//
+// Engine time is kept as whole nanoseconds so that it stays exact for the
+// whole uptime of the game. Floating point seconds are only produced at the
+// edges where systems need a delta time.
+#ifndef INCLUDED_TIME_UNITS
+#define INCLUDED_TIME_UNITS
+
+namespace StevensDev
+{
+
+namespace sgdk
+{
+
+typedef unsigned long long TimePoint;
+  // Defines a point in time as nanoseconds since an arbitrary start.
+
+typedef long long Duration;
+  // Defines a length of time in nanoseconds.
+
+struct TimeUnits
+{
+    // CONSTANTS
+    static const Duration NANOS_PER_MICRO = 1000ll;
+      // The number of nanoseconds in a microsecond.
+
+    static const Duration NANOS_PER_MILLI = 1000000ll;
+      // The number of nanoseconds in a millisecond.
+
+    static const Duration NANOS_PER_SECOND = 1000000000ll;
+      // The number of nanoseconds in a second.
+
+    // GLOBAL FUNCTIONS
+    static double toSeconds( Duration duration );
+      // Converts the duration to seconds.
+
+    static double toMilliseconds( Duration duration );
+      // Converts the duration to milliseconds.
+
+    static double toMicroseconds( Duration duration );
+      // Converts the duration to microseconds.
+
+    static Duration fromSeconds( double seconds );
+      // Converts seconds to the nearest duration.
+};
+
+inline
+double TimeUnits::toSeconds( Duration duration )
+{
+    return static_cast<double>( duration ) / NANOS_PER_SECOND;
+}
+
+inline
+double TimeUnits::toMilliseconds( Duration duration )
+{
+    return static_cast<double>( duration ) / NANOS_PER_MILLI;
+}
+
+inline
+double TimeUnits::toMicroseconds( Duration duration )
+{
+    return static_cast<double>( duration ) / NANOS_PER_MICRO;
+}
+
+inline
+Duration TimeUnits::fromSeconds( double seconds )
+{
+    return static_cast<Duration>( seconds * NANOS_PER_SECOND +
+                                  ( seconds < 0 ? -0.5 : 0.5 ) );
+}
+
+} // End nspc sgdk
+
+} // End nspc StevensDev
+
+#endif
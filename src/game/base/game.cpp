@@ -4,6 +4,8 @@
 #include <game/objects/actor.h>
 #include <game/controllers/player_controller.h>
 #include "engine/assets/resource_manager.h"
+#include "engine/events/event_bus.h"
+#include "engine/jobs/job_system.h"
 #include "engine/scene/world_view.h"
 #include "engine/input/input.h"
 #include "engine/scene/scene.h"
@@ -14,6 +16,30 @@ namespace StevensDev
 namespace mgb
 {
 
+// MUTATOR FUNCTIONS
+void Game::setRecording()
+{
+    assert( !d_isRunning );
+    assert( d_replayer == nullptr );
+
+    d_isRecording = true;
+    d_log = sgdl::FrameLog( sgdi::Input::INPUT_TYPE_COUNT );
+}
+
+void Game::setReplay( const sgdl::FrameLog& log )
+{
+    assert( !d_isRunning );
+    assert( !d_isRecording );
+    assert( log.inputCount() == sgdi::Input::INPUT_TYPE_COUNT );
+
+    // the recorded times are replayed instead of a fixed step
+    setHeadless();
+
+    d_log = log;
+    delete d_replayer;
+    d_replayer = new sgdl::Replayer( &d_log );
+}
+
 // MEMBER FUNCTIONS
 void Game::initialize( const std::string& name )
 {
@@ -23,6 +49,10 @@ void Game::initialize( const std::string& name )
 
     d_name = name;
 
+    // the main thread is a worker too
+    unsigned int threads = std::thread::hardware_concurrency();
+    sgdj::JobSystem::inst().initialize( threads > 1 ? threads - 1 : 0 );
+
     // load resources
     d_resources.addPackageResources( "res/res.db" );
 
@@ -38,14 +68,62 @@ void Game::initialize( const std::string& name )
     sgds::Scene& scene = sgds::Scene::inst();
     sgds::WorldView& world = sgds::WorldView::inst();
 
-    scene.setRenderer( &d_renderer );
+    if ( d_isHeadless )
+    {
+        // nothing is drawn and the devices are never touched
+        d_nullRenderer = sgdr::NullRenderer( 800, 600 );
+        scene.setRenderer( &d_nullRenderer );
+        input.setSource( &d_script );
+    }
+    else
+    {
+        d_renderer = new sgdr::Renderer();
+        scene.setRenderer( d_renderer );
+    }
+
+    // recording and replaying sit between input and where it comes from
+    // and see every event that is dispatched
+    if ( d_isRecording )
+    {
+        d_recorder = new sgdl::Recorder(
+            d_isHeadless ? static_cast<sgdi::IInputSource*>( &d_script )
+                         : &d_devices,
+            &d_log );
+        input.setSource( d_recorder );
+        sgde::EventBus::dispatcher().setObserver( d_recorder->observer() );
+    }
+    else if ( d_replayer != nullptr )
+    {
+        input.setSource( d_replayer );
+        sgde::EventBus::dispatcher().setObserver( d_replayer->observer() );
+    }
+
+    // input is read before anything else ticks
+    scene.addTickable( &input, -1 );
+
+    // events posted by other threads are dispatched right after input
+    scene.addTickable( &sgde::EventBus::queue(), -1 );
+
+    // queued events are delivered after the game tickables and, unlike
+    // the low priority work below, on every step
+    scene.addTickable( &sgde::EventBus::dispatcher(), 1 );
+
+    // simulate at a fixed rate no matter how fast frames are drawn
+    scene.setStep( 1.0f / 60.0f );
+
+    // collect unused resources every few steps and only with time to spare
+    scene.addTickable( &sgda::ResourceManager::inst(), 1,
+                       sgda::ResourceManager::CLEAN_INTERVAL, true );
 
     d_events.push( STATUS_INITIALIZED );
 }
 
 void Game::startup()
 {
-    d_renderer.setupWindow( 800, 600 );
+    if ( !d_isHeadless )
+    {
+        d_renderer->setupWindow( 800, 600 );
+    }
 
     sgds::WorldView::initialize( sgds::RectangleBounds( 0, 0, 800, 600 ),
                                  sgds::RectangleBounds( 0, 0, 800, 600 ),
@@ -61,14 +139,45 @@ void Game::startup()
 
 void Game::update()
 {
-    if ( d_renderer.isActive() )
+    const sgdr::IRenderer* renderer =
+        d_isHeadless ? &d_nullRenderer
+                     : static_cast<const sgdr::IRenderer*>( d_renderer );
+
+    if ( !renderer->isActive() ||
+         ( d_frameLimit > 0 && d_frames >= d_frameLimit ) )
+    {
+        d_isRunning = false;
+        return;
+    }
+
+    sgds::Scene& scene = sgds::Scene::inst();
+    float elapsedS = 0;
+
+    if ( d_replayer != nullptr )
+    {
+        if ( !d_replayer->tick( scene ) )
+        {
+            d_isRunning = false;
+            return;
+        }
+    }
+    else if ( d_isHeadless && d_headlessStep > 0 )
     {
-        sgds::Scene::inst().tick();
+        elapsedS = d_headlessStep;
+        scene.tick( elapsedS );
     }
     else
     {
-        d_isRunning = false;
+        scene.tick();
+        elapsedS = scene.clock().elapsedSeconds();
     }
+
+    if ( d_recorder != nullptr )
+    {
+        d_recorder->endFrame( elapsedS );
+    }
+
+    ++d_frames;
 }
 
 Game::EngineEvent Game::poll()
@@ -83,6 +192,19 @@ Game::EngineEvent Game::poll()
 
 void Game::shutdown()
 {
+    sgdj::JobSystem::inst().shutdown();
+
+    sgds::Scene::inst().setRenderer( nullptr );
+    delete d_renderer;
+    d_renderer = nullptr;
+
+    sgdi::Input::inst().setSource( nullptr );
+    sgde::EventBus::dispatcher().setObserver( sgde::EventListener() );
+    delete d_recorder;
+    d_recorder = nullptr;
+    delete d_replayer;
+    d_replayer = nullptr;
+
     d_isDead = true;
 }
 
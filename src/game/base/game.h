@@ -4,7 +4,13 @@
 
 #include "engine/assets/resource_database.h"
 #include "engine/containers/dynamic_array.h"
+#include "engine/input/device_input.h"
+#include "engine/input/scripted_input.h"
+#include "engine/rendering/null_renderer.h"
 #include "engine/rendering/renderer.h"
+#include "engine/replay/frame_log.h"
+#include "engine/replay/recorder.h"
+#include "engine/replay/replayer.h"
 #include <string>
 
 namespace StevensDev
@@ -20,8 +26,29 @@ class Game
     sgda::ResourceDatabase d_resources;
       // The game's resource database.
 
-    sgdr::Renderer d_renderer;
-      // The game's renderer.
+    sgdr::Renderer* d_renderer;
+      // The game's renderer or nullptr when headless.
+      //
+      // This is only created for windowed games since constructing one
+      // needs a display.
+
+    sgdr::NullRenderer d_nullRenderer;
+      // The renderer used when headless.
+
+    sgdi::ScriptedInput d_script;
+      // The input used when headless.
+
+    sgdi::DeviceInput d_devices;
+      // The input that is recorded when windowed.
+
+    sgdl::FrameLog d_log;
+      // The frames being recorded or replayed.
+
+    sgdl::Recorder* d_recorder;
+      // Records the frames into the log or nullptr when not recording.
+
+    sgdl::Replayer* d_replayer;
+      // Plays the frames in the log or nullptr when not replaying.
 
     sgdc::DynamicArray<unsigned int> d_events;
       // The list of broadcasted events that are waiting to be consumed.
@@ -29,6 +56,23 @@ class Game
     std::string d_name;
       // The instance's name.
 
+    unsigned long long d_frames;
+      // The number of updates that ticked the scene.
+
+    unsigned long long d_frameLimit;
+      // The number of updates to run before stopping or zero to run until
+      // the window is closed.
+
+    float d_headlessStep;
+      // The simulated time in seconds that each headless update ticks or
+      // zero to use the time that really elapsed.
+
+    bool d_isHeadless;
+      // If the game runs without a window.
+
+    bool d_isRecording;
+      // If the game records its frames into the log.
+
     bool d_isRunning;
       // If the game is still running.
 
@@ -103,6 +147,43 @@ class Game
     const std::string& name() const;
           // Gets the name of the game.
 
+    bool isHeadless() const;
+      // Checks if the game runs without a window.
+
+    unsigned long long frames() const;
+      // Gets the number of updates that ticked the scene.
+
+    sgdi::ScriptedInput& script();
+      // Gets the script that feeds input when headless.
+
+    const sgdl::FrameLog& log() const;
+      // Gets the frames that were recorded or are replayed.
+
+    const sgdl::Replayer* replayer() const;
+      // Gets the replayer or nullptr if the game is not replaying.
+
+    // MUTATOR FUNCTIONS
+    void setHeadless( float stepS = 0.0f );
+      // Makes the game run without a window, drawing to a null renderer
+      // and reading input from the script.
+      //
+      // Each update ticks stepS seconds of simulated time as fast as it
+      // can or, when zero, the time that really elapsed without any frame
+      // limit. This must be called before the game is initialized.
+
+    void setFrameLimit( unsigned long long frames );
+      // Sets the number of updates to run before stopping or zero to run
+      // until the window is closed.
+
+    void setRecording();
+      // Makes the game record its input, frame times and events into the
+      // log. This must be called before the game is initialized.
+
+    void setReplay( const sgdl::FrameLog& log );
+      // Makes the game run headless, replaying the log as fast as it can
+      // and stopping at its end. This must be called before the game is
+      // initialized.
+
     // MEMBER FUNCTIONS
     void initialize( const std::string& name );
       // Prepares the game for startup.
@@ -141,14 +222,21 @@ class Game
 
 // CONSTRUCTORS
 inline
-Game::Game() : d_resources(), d_renderer(), d_events(),
-               d_isRunning( false ), d_isDead( false )
+Game::Game() : d_resources(), d_renderer( nullptr ), d_nullRenderer(),
+               d_script(), d_devices(), d_log(), d_recorder( nullptr ),
+               d_replayer( nullptr ), d_events(), d_frames( 0 ),
+               d_frameLimit( 0 ), d_headlessStep( 0 ), d_isHeadless( false ),
+               d_isRecording( false ), d_isRunning( false ),
+               d_isDead( false )
 {
 }
 
 inline
 Game::Game( const Game& game )
-    : d_resources(), d_renderer(), d_events(), d_isRunning( false ),
+    : d_resources(), d_renderer( nullptr ), d_nullRenderer(), d_script(),
+      d_devices(), d_log(), d_recorder( nullptr ), d_replayer( nullptr ),
+      d_events(), d_frames( 0 ), d_frameLimit( 0 ), d_headlessStep( 0 ),
+      d_isHeadless( false ), d_isRecording( false ), d_isRunning( false ),
       d_isDead( true )
 {
     throw std::runtime_error( "The game instance cannot be copied!" );
@@ -158,6 +246,9 @@ inline
 Game::~Game()
 {
     assert( d_isDead );
+    assert( d_renderer == nullptr );
+    assert( d_recorder == nullptr );
+    assert( d_replayer == nullptr );
 }
 
 // OPERATORS
@@ -176,6 +267,53 @@ const std::string& Game::name() const
     return d_name;
 }
 
+inline
+bool Game::isHeadless() const
+{
+    return d_isHeadless;
+}
+
+inline
+unsigned long long Game::frames() const
+{
+    return d_frames;
+}
+
+inline
+sgdi::ScriptedInput& Game::script()
+{
+    return d_script;
+}
+
+inline
+const sgdl::FrameLog& Game::log() const
+{
+    return d_log;
+}
+
+inline
+const sgdl::Replayer* Game::replayer() const
+{
+    return d_replayer;
+}
+
+// MUTATOR FUNCTIONS
+inline
+void Game::setHeadless( float stepS )
+{
+    assert( !d_isRunning );
+    assert( stepS >= 0 );
+
+    d_isHeadless = true;
+    d_headlessStep = stepS;
+}
+
+inline
+void Game::setFrameLimit( unsigned long long frames )
+{
+    d_frameLimit = frames;
+}
+
 // MEMBER FUNCTIONS
 inline
 bool Game::isRunning() const
@@ -64,9 +64,11 @@ void PlayerController::tick( float dt )
 
     const sgds::RectangleBounds& b = d_subject->bounds();
     WorldView& w = WorldView::inst();
+    Vec2& velocity =
+        d_subject->store()->velocities().get( d_subject->entity() );
 
     // check if it meets the minimum velocity for movement
-    bool hasMinVelocity = Vec::length( d_velocity ) > MIN_VELOCITY;
+    bool hasMinVelocity = Vec::length( velocity ) > MIN_VELOCITY;
 
     // is it moving faster than cutoff speed?
     // or is the acceleration greater than the static friction?
@@ -77,7 +79,7 @@ void PlayerController::tick( float dt )
         Vec2 friction;
         if ( hasMinVelocity )
         {
-            friction = KINETIC_FRICTION * Vec::normalize( -d_velocity );
+            friction = KINETIC_FRICTION * Vec::normalize( -velocity );
         }
         else
         {
@@ -88,22 +90,22 @@ void PlayerController::tick( float dt )
         Vec2 dVf = friction * dt;
 
         // prevent dVf from being greater than the velocity
-        if ( Vec::length( dVf ) > Vec::length( d_velocity ) )
+        if ( Vec::length( dVf ) > Vec::length( velocity ) )
         {
-            dVf = -d_velocity;
+            dVf = -velocity;
         }
 
         // apply forces to velocity
-        d_velocity += d_acceleration * dt + dVf;
+        velocity += d_acceleration * dt + dVf;
     }
 
     // check if new velocity meets cutoff
-    if ( Vec::length( d_velocity ) > MIN_VELOCITY )
+    if ( Vec::length( velocity ) > MIN_VELOCITY )
     {
         const float maxDisplacement = MAX_VELOCITY * dt;
 
         // calculate displacement
-        Vec2 dP = d_velocity * dt;
+        Vec2 dP = velocity * dt;
 
         // clamp displacement to one bounds offset
         if ( Vec::length( dP ) > maxDisplacement )
@@ -120,23 +122,23 @@ void PlayerController::tick( float dt )
         if ( nl < w.left() )
         {
             dP.x = b.left() - w.left();
-            d_velocity.x *= 0.05f;
+            velocity.x *= 0.05f;
         }
         else if ( nr > w.right() )
         {
             dP.x = w.right() - b.right();
-            d_velocity.x *= 0.05f;
+            velocity.x *= 0.05f;
         }
 
         if ( nt < w.top() )
         {
             dP.y = b.top() - w.top();
-            d_velocity.y *= 0.05f;
+            velocity.y *= 0.05f;
         }
         else if ( nb > w.bottom() )
         {
             dP.y = w.bottom() - b.bottom();
-            d_velocity.y *= 0.05f;
+            velocity.y *= 0.05f;
         }
 
         // move subject
@@ -46,11 +46,10 @@ class PlayerController : public sgds::ITickable
     gel::math::Vec2 d_acceleration;
       // The actor's current acceleration vector (OU/sec^2).
 
-    gel::math::Vec2 d_velocity;
-      // The actor's velocity vector (OU/sec).
-
     mgo::Actor* d_subject;
       // The controller's subject (or in this case player).
+      //
+      // The subject's velocity (OU/sec) is kept in its entity store.
 
   public:
     // CONSTRUCTORS
@@ -59,16 +58,19 @@ class PlayerController : public sgds::ITickable
 
     PlayerController( mgo::Actor* subject );
       // Constructs a new player controller using the given actor as it's
-      // subject.
+      // subject and gives the subject a velocity if it has none.
 
     PlayerController( mgo::Actor* subject,
                       const gel::math::Vec2& acceleration,
                       const gel::math::Vec2& velocity );
       // Constructs a new player controller for the given subject using
       // the initial speeds.
+      //
+      // The velocity replaces any that the subject already has.
 
     PlayerController( const PlayerController& controller );
-      // Constructs a copy of another player controller.
+      // Constructs a copy of another player controller that shares its
+      // subject's velocity.
 
     ~PlayerController();
       // Destructs the controller.
@@ -84,8 +86,8 @@ class PlayerController : public sgds::ITickable
     const gel::math::Vec2& acceleration() const;
       // Gets the player's current acceleration.
 
-    const gel::math::Vec2& velocity() const;
-      // Gets the player's current velocity.
+    gel::math::Vec2 velocity() const;
+      // Gets the player's current velocity or zero without a subject.
 
     // MEMBER FUNCTIONS
     virtual void preTick();
@@ -110,30 +112,38 @@ std::ostream& operator<<( std::ostream& stream,
 
 // CONSTRUCTORS
 inline
-PlayerController::PlayerController() : d_acceleration(), d_velocity(),
+PlayerController::PlayerController() : d_acceleration(),
                                        d_subject( nullptr )
 {
 }
 
 inline
 PlayerController::PlayerController( mgo::Actor* subject )
-    : d_acceleration(), d_velocity(), d_subject( subject )
+    : d_acceleration(), d_subject( subject )
 {
+    assert( subject != nullptr );
+
+    if ( !subject->store()->velocities().has( subject->entity() ) )
+    {
+        subject->store()->velocities().add( subject->entity(),
+                                            gel::math::Vec2( 0.0f ) );
+    }
 }
 
 inline
 PlayerController::PlayerController( mgo::Actor* subject,
                                     const gel::math::Vec2& acceleration,
                                     const gel::math::Vec2& velocity )
-    : d_acceleration( acceleration ), d_velocity( velocity ),
-      d_subject( subject )
+    : d_acceleration( acceleration ), d_subject( subject )
 {
+    assert( subject != nullptr );
+
+    subject->store()->velocities().add( subject->entity(), velocity );
 }
 
 inline
 PlayerController::PlayerController( const PlayerController& controller )
     : d_acceleration( controller.d_acceleration ),
-      d_velocity( controller.d_velocity ),
       d_subject( controller.d_subject )
 {
 }
@@ -149,7 +159,6 @@ PlayerController& PlayerController::operator=(
     const PlayerController& controller )
 {
     d_acceleration = controller.d_acceleration;
-    d_velocity = controller.d_velocity;
     d_subject = controller.d_subject;
 
     return *this;
@@ -168,9 +177,14 @@ const gel::math::Vec2& PlayerController::acceleration() const
 }
 
 inline
-const gel::math::Vec2& PlayerController::velocity() const
+gel::math::Vec2 PlayerController::velocity() const
 {
-    return d_velocity;
+    if ( d_subject == nullptr )
+    {
+        return gel::math::Vec2( 0.0f );
+    }
+
+    return d_subject->store()->velocities().get( d_subject->entity() );
 }
 
 } // End nspc mgc
@@ -1,8 +1,13 @@
 // actor.h
+//
+// An actor is a view over an entity in an entity store. Its bounds, flags
+// and sprite reference live in the store's component pools while the actor
+// keeps what is only used through it.
 #ifndef INCLUDED_ACTOR
 #define INCLUDED_ACTOR
 
 #include <engine/data/json_entity.h>
+#include <engine/entity/entity_store.h>
 #include <engine/rendering/renderable_sprite.h>
 #include <engine/scene/collision.h>
 #include <engine/scene/icollider.h>
@@ -30,12 +35,15 @@ class Actor : public sgds::ICollider
       // Global actor id counter.
 
     // MEMBERS
+    sgdn::EntityStore* d_store;
+      // The store that holds the actor's components.
+
+    sgdn::Entity d_entity;
+      // The actor's entity.
+
     sgdr::RenderableSprite d_sprite;
       // The actor's sprite.
 
-    sgds::RectangleBounds d_bounds;
-      // The actor's collision bounds.
-
     sgdd::JsonEntity d_properties;
       // The actor instance's properties.
 
@@ -45,15 +53,16 @@ class Actor : public sgds::ICollider
     ActorID d_id;
       // The actor's unique id.
 
-    unsigned short d_flags;
-      // The actor's collision bounds.
-
     // GLOBAL HELPER FUNCTIONS
     static ActorID nextID();
       // Gets the next actor ID.
       //
       // This is defined so that ActorID's type can be easily modified.
 
+    // HELPER FUNCTIONS
+    void attach( const sgds::RectangleBounds& bounds, unsigned short flags );
+      // Creates the actor's entity with the bounds, flags and sprite.
+
   public:
     // CONSTRUCTORS
     Actor();
@@ -63,16 +72,18 @@ class Actor : public sgds::ICollider
            const sgdr::RenderableSprite& sprite,
            const sgds::RectangleBounds& bounds,
            unsigned short flags,
-           const sgdd::JsonEntity& properties );
-      // Constructs a new actor with the given information.
+           const sgdd::JsonEntity& properties,
+           sgdn::EntityStore* store = &sgdn::EntityStore::inst() );
+      // Constructs a new actor with the given information whose bounds,
+      // flags and sprite are kept in the store.
       //
       // The bounds are in world units.
 
     Actor( const Actor& actor );
-      // Constructs a copy of the given actor.
+      // Constructs a copy of the given actor with an entity of its own.
 
     ~Actor();
-      // Destructs the actor.
+      // Destructs the actor and its entity.
 
     // OPERATORS
     Actor& operator=( const Actor& actor );
@@ -85,11 +96,20 @@ class Actor : public sgds::ICollider
     const std::string& name() const;
       // Gets the actor's name.
 
+    sgdn::Entity entity() const;
+      // Gets the actor's entity.
+
+    sgdn::EntityStore* store() const;
+      // Gets the store that holds the actor's components.
+
     virtual const sgdr::RenderableSprite& sprite() const;
       // Gets the actor's sprite.
 
     virtual const sgds::RectangleBounds& bounds() const;
       // Gets the actor's collision bounds (WU).
+      //
+      // The reference is only valid until bounds are added to or removed
+      // from the store.
 
     virtual float getPositionX() const;
       // Gets the actor's x position (WU).
@@ -138,44 +158,59 @@ std::ostream& operator<<( std::ostream& stream,
 
 // CONSTRUCTORS
 inline
-Actor::Actor() : d_sprite(), d_bounds(), d_properties(), d_name(),
-                 d_id( ActorID( INVALID ) ),
-                 d_flags( sgds::Collision::NO_COLLISION )
+Actor::Actor() : d_store( &sgdn::EntityStore::inst() ),
+                 d_entity( sgdn::Entities::INVALID ), d_sprite(),
+                 d_properties(), d_name(), d_id( ActorID( INVALID ) )
 {
+    attach( sgds::RectangleBounds(), sgds::Collision::NO_COLLISION );
 }
 
 inline
 Actor::Actor( const std::string& name, const sgdr::RenderableSprite& sprite,
               const sgds::RectangleBounds& bounds, unsigned short flags,
-              const sgdd::JsonEntity& properties )
-    : d_sprite( sprite ), d_bounds( bounds ), d_properties( properties ),
-      d_name( name ), d_id( nextID() ), d_flags( flags )
+              const sgdd::JsonEntity& properties, sgdn::EntityStore* store )
+    : d_store( store ), d_entity( sgdn::Entities::INVALID ),
+      d_sprite( sprite ), d_properties( properties ), d_name( name ),
+      d_id( nextID() )
 {
+    assert( store != nullptr );
+    attach( bounds, flags );
 }
 
 inline
 Actor::Actor( const Actor& actor )
-    : d_sprite( actor.d_sprite ), d_bounds( actor.d_bounds ),
-      d_properties( actor.d_properties ), d_name( actor.d_name ),
-      d_id( actor.d_id ), d_flags( actor.d_flags )
+    : d_store( actor.d_store ), d_entity( sgdn::Entities::INVALID ),
+      d_sprite( actor.d_sprite ), d_properties( actor.d_properties ),
+      d_name( actor.d_name ), d_id( actor.d_id )
 {
+    // the bounds are copied out since adding to the pool can reallocate it
+    sgds::RectangleBounds bounds = actor.bounds();
+
+    attach( bounds, actor.flags() );
 }
 
 inline
 Actor::~Actor()
 {
+    d_store->destroy( d_entity );
 }
 
 // OPERATORS
 inline
 Actor& Actor::operator=( const Actor& actor )
 {
+    sgds::RectangleBounds bounds = actor.bounds();
+    unsigned short flags = actor.flags();
+
+    d_store->destroy( d_entity );
+
+    d_store = actor.d_store;
     d_sprite = actor.d_sprite;
-    d_bounds = actor.d_bounds;
     d_properties = actor.d_properties;
     d_name = actor.d_name;
     d_id = actor.d_id;
-    d_flags = actor.d_flags;
+
+    attach( bounds, flags );
 
     return *this;
 }
@@ -193,6 +228,18 @@ const std::string& Actor::name() const
     return d_name;
 }
 
+inline
+sgdn::Entity Actor::entity() const
+{
+    return d_entity;
+}
+
+inline
+sgdn::EntityStore* Actor::store() const
+{
+    return d_store;
+}
+
 inline
 const sgdr::RenderableSprite& Actor::sprite() const
 {
@@ -202,25 +249,25 @@ const sgdr::RenderableSprite& Actor::sprite() const
 inline
 const sgds::RectangleBounds& Actor::bounds() const
 {
-    return d_bounds;
+    return d_store->bounds().get( d_entity );
 }
 
 inline
 float Actor::getPositionX() const
 {
-    return d_bounds.x();
+    return bounds().x();
 }
 
 inline
 float Actor::getPositionY() const
 {
-    return d_bounds.y();
+    return bounds().y();
 }
 
 inline
 unsigned short Actor::flags() const
 {
-    return d_flags;
+    return d_store->flags().get( d_entity );
 }
 
 inline
@@ -233,7 +280,7 @@ const sgdd::JsonEntity& Actor::properties() const
 inline
 void Actor::setFlags( unsigned short flags )
 {
-    d_flags = flags;
+    d_store->flags().get( d_entity ) = flags;
 }
 
 inline
@@ -246,21 +293,34 @@ inline
 void Actor::move( float x, float y )
 {
     sgds::WorldView& w = sgds::WorldView::inst();
+    sgds::RectangleBounds& b = d_store->bounds().get( d_entity );
+
     d_sprite.move( w.wuToDP( x ), w.wuToDP( y ) );
-    d_bounds.setPosition( d_bounds.x() + x, d_bounds.y() + y );
+    b.setPosition( b.x() + x, b.y() + y );
 }
 
 // MEMBER FUNCTIONS
 inline
 bool Actor::canCollide( unsigned short flags ) const
 {
-    return sgds::Collision::canCollide( d_flags, flags );
+    return sgds::Collision::canCollide( this->flags(), flags );
 }
 
 inline
 bool Actor::doesCollide( const sgds::RectangleBounds& candidate ) const
 {
-    return d_bounds.doesCollide( candidate );
+    return bounds().doesCollide( candidate );
+}
+
+// HELPER FUNCTIONS
+inline
+void Actor::attach( const sgds::RectangleBounds& bounds,
+                    unsigned short flags )
+{
+    d_entity = d_store->create();
+    d_store->bounds().add( d_entity, bounds );
+    d_store->flags().add( d_entity, flags );
+    d_store->sprites().add( d_entity, &d_sprite );
 }
 
 // GLOBAL FUNCTIONS
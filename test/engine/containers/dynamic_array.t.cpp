@@ -73,6 +73,14 @@ TEST( DynamicArrayTest, PushAndPop )
     array.popFront();
     array.push( 10 );
     EXPECT_EQ( 10,  array[array.size() - 1] );
+
+    // clearing starts over from the front
+    array.clear();
+    EXPECT_EQ( 0, array.size() );
+
+    array.push( 7 );
+    EXPECT_EQ( 7, array[0] );
+    EXPECT_EQ( 1, array.size() );
 }
 
 TEST( DynamicArrayTest, At )
@@ -116,6 +116,33 @@ TEST( MapTest, SetAndGet )
     }
 }
 
+TEST( MapTest, Rehashing )
+{
+    using namespace StevensDev::sgdc;
+    using namespace StevensDev::sgdm;
+
+    CountingAllocator<std::string> alloc;
+
+    Map<std::string> map( &alloc );
+    DynamicArray<std::string> keys = getKeys( &alloc );
+
+    // reading every key while the bins grow moves them out of the old bins
+    // without losing or duplicating any
+    int i;
+    int j;
+    for ( i = 0; i < keys.size(); ++i )
+    {
+        map[keys[i]] = keys[i];
+
+        for ( j = i; j >= 0; --j )
+        {
+            ASSERT_EQ( keys[j], map[keys[j]] );
+        }
+
+        ASSERT_EQ( i + 1, map.values().size() );
+    }
+}
+
 TEST( MapTest, KeysAndValues )
 {
 
@@ -0,0 +1,115 @@
+// component_pool.t.cpp
+#include <engine/entity/component_pool.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST( ComponentPoolTest, Construction )
+{
+    using namespace StevensDev::sgdn;
+
+    ComponentPool<int> pool;
+
+    EXPECT_EQ( 0, pool.size() );
+    EXPECT_FALSE( pool.has( 0 ) );
+    EXPECT_FALSE( pool.has( Entities::INVALID ) );
+    EXPECT_FALSE( pool.remove( 0 ) );
+
+    ComponentPool<int> copy( pool );
+
+    EXPECT_EQ( 0, copy.size() );
+}
+
+TEST( ComponentPoolTest, AddRemove )
+{
+    using namespace StevensDev::sgdn;
+
+    ComponentPool<int> pool;
+    Entity first = Entities::make( 0, 0 );
+    Entity second = Entities::make( 5, 0 );
+    Entity third = Entities::make( 2, 1 );
+
+    pool.add( first, 1 );
+    pool.add( second, 2 );
+    pool.add( third, 3 );
+
+    ASSERT_EQ( 3, pool.size() );
+    EXPECT_EQ( 2, pool.get( second ) );
+    EXPECT_EQ( second, pool.entity( 1 ) );
+
+    // adding again replaces the component
+    pool.add( second, 4 );
+
+    EXPECT_EQ( 3, pool.size() );
+    EXPECT_EQ( 4, pool.get( second ) );
+
+    // other generations of the same index are not the same entity
+    EXPECT_FALSE( pool.has( Entities::make( 2, 0 ) ) );
+
+    // removing keeps the components packed
+    EXPECT_TRUE( pool.remove( first ) );
+    EXPECT_FALSE( pool.has( first ) );
+    EXPECT_FALSE( pool.remove( first ) );
+
+    ASSERT_EQ( 2, pool.size() );
+    EXPECT_EQ( third, pool.entity( 0 ) );
+    EXPECT_EQ( 3, pool.at( 0 ) );
+    EXPECT_EQ( 3, pool.get( third ) );
+    EXPECT_EQ( 4, pool.get( second ) );
+
+    pool.clear();
+
+    EXPECT_EQ( 0, pool.size() );
+    EXPECT_FALSE( pool.has( second ) );
+    EXPECT_FALSE( pool.has( third ) );
+}
+
+TEST( ComponentPoolTest, Join )
+{
+    using namespace StevensDev::sgdn;
+
+    const unsigned int COUNT = 100;
+
+    ComponentPool<int> values;
+    ComponentPool<float> scales;
+    unsigned int visits = 0;
+    unsigned int i;
+
+    for ( i = 0; i < COUNT; ++i )
+    {
+        values.add( Entities::make( i, 0 ), i );
+
+        if ( i % 3 == 0 )
+        {
+            scales.add( Entities::make( i, 0 ), 2.0f );
+        }
+    }
+
+    join( values, scales,
+          [&visits]( Entity entity, int& value, float& scale )
+          {
+              EXPECT_EQ( 0, Entities::index( entity ) % 3 );
+              value = static_cast<int>( value * scale );
+              ++visits;
+          } );
+
+    EXPECT_EQ( ( COUNT + 2 ) / 3, visits );
+
+    for ( i = 0; i < COUNT; ++i )
+    {
+        EXPECT_EQ( i % 3 == 0 ? 2 * i : i,
+                   values.get( Entities::make( i, 0 ) ) );
+    }
+}
+
+TEST( ComponentPoolTest, Print )
+{
+    using namespace StevensDev::sgdn;
+
+    ComponentPool<int> pool;
+    std::ostringstream oss;
+
+    pool.add( 0, 1 );
+    oss << pool;
+
+    EXPECT_STREQ( "{ \"size\": 1 }", oss.str().c_str() );
+}
@@ -0,0 +1,67 @@
+// entity_store.t.cpp
+#include <engine/entity/entity_store.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST( EntityStoreTest, Construction )
+{
+    using namespace StevensDev::sgdn;
+
+    EntityStore store;
+
+    EXPECT_EQ( 0, store.size() );
+    EXPECT_FALSE( store.isAlive( 0 ) );
+    EXPECT_FALSE( store.isAlive( Entities::INVALID ) );
+    EXPECT_FALSE( store.destroy( 0 ) );
+
+    EntityStore copy( store );
+
+    EXPECT_EQ( 0, copy.size() );
+}
+
+TEST( EntityStoreTest, Lifetime )
+{
+    using namespace StevensDev::sgdn;
+    using namespace StevensDev::sgds;
+
+    EntityStore store;
+    Entity first = store.create();
+    Entity second = store.create();
+    Entity third;
+
+    EXPECT_EQ( 2, store.size() );
+    EXPECT_TRUE( store.isAlive( first ) );
+    EXPECT_NE( first, second );
+
+    store.bounds().add( first, RectangleBounds( 1, 2, 3, 4 ) );
+    store.flags().add( first, 7 );
+
+    // destroying removes every component
+    EXPECT_TRUE( store.destroy( first ) );
+    EXPECT_FALSE( store.destroy( first ) );
+    EXPECT_FALSE( store.isAlive( first ) );
+    EXPECT_FALSE( store.bounds().has( first ) );
+    EXPECT_FALSE( store.flags().has( first ) );
+    EXPECT_EQ( 1, store.size() );
+
+    // the index is reused with a new generation
+    third = store.create();
+
+    EXPECT_EQ( Entities::index( first ), Entities::index( third ) );
+    EXPECT_NE( first, third );
+    EXPECT_TRUE( store.isAlive( third ) );
+    EXPECT_FALSE( store.isAlive( first ) );
+}
+
+TEST( EntityStoreTest, Print )
+{
+    using namespace StevensDev::sgdn;
+
+    EntityStore store;
+    std::ostringstream oss;
+
+    store.create();
+    oss << store;
+
+    EXPECT_STREQ( "{ \"size\": 1 }", oss.str().c_str() );
+}
@@ -0,0 +1,126 @@
+// delegate.t.cpp
+#include <engine/events/delegate.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace
+{
+
+int twice( int value )
+{
+    return value * 2;
+}
+
+class Counter
+{
+  private:
+    int d_count;
+
+  public:
+    Counter() : d_count( 0 ) {}
+
+    int add( int amount ) { return d_count += amount; }
+
+    int count( int offset ) const { return d_count + offset; }
+};
+
+class Tracked
+{
+  private:
+    int* d_alive;
+
+  public:
+    Tracked( int* alive ) : d_alive( alive ) { ++*d_alive; }
+
+    Tracked( const Tracked& other ) : d_alive( other.d_alive )
+    {
+        ++*d_alive;
+    }
+
+    ~Tracked() { --*d_alive; }
+
+    int operator()( int value ) const { return value + *d_alive; }
+};
+
+} // End nspc anonymous
+
+TEST( DelegateTest, Calling )
+{
+    using namespace StevensDev::sgde;
+
+    typedef Delegate<int( int )> Callback;
+
+    Counter counter;
+    int captured = 3;
+    Callback empty;
+    Callback function( &twice );
+    Callback lambda = [captured]( int value ) { return value + captured; };
+    Callback member = Callback::bind<Counter, &Counter::add>( &counter );
+    Callback constMember = Callback::bind<Counter, &Counter::count>(
+        &counter );
+
+    EXPECT_FALSE( empty );
+    EXPECT_TRUE( function );
+
+    EXPECT_EQ( 8, function( 4 ) );
+    EXPECT_EQ( 7, lambda( 4 ) );
+    EXPECT_EQ( 5, member( 5 ) );
+    EXPECT_EQ( 7, member( 2 ) );
+    EXPECT_EQ( 8, constMember( 1 ) );
+
+    lambda = nullptr;
+    EXPECT_FALSE( lambda );
+}
+
+TEST( DelegateTest, Lifetime )
+{
+    using namespace StevensDev::sgde;
+
+    typedef Delegate<int( int )> Callback;
+
+    int alive = 0;
+
+    {
+        Callback first = Tracked( &alive );
+
+        EXPECT_EQ( 1, alive );
+        EXPECT_EQ( 2, first( 1 ) );
+
+        // copies hold their own callable
+        Callback second( first );
+
+        EXPECT_EQ( 2, alive );
+
+        // moves take the callable and leave the source empty
+        Callback third( std::move( first ) );
+
+        EXPECT_EQ( 2, alive );
+        EXPECT_FALSE( first );
+        EXPECT_EQ( 3, third( 1 ) );
+
+        second = &twice;
+        EXPECT_EQ( 1, alive );
+        EXPECT_EQ( 4, second( 2 ) );
+
+        second = third;
+        EXPECT_EQ( 2, alive );
+
+        third.reset();
+        EXPECT_EQ( 1, alive );
+    }
+
+    EXPECT_EQ( 0, alive );
+}
+
+TEST( DelegateTest, Print )
+{
+    using namespace StevensDev::sgde;
+
+    Delegate<void()> empty;
+    Delegate<void()> bound = []() {};
+    std::ostringstream stream;
+
+    stream << empty << " " << bound;
+
+    EXPECT_EQ( "{ \"isBound\": false } { \"isBound\": true }", stream.str() );
+}
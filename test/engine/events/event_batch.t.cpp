@@ -0,0 +1,88 @@
+// event_batch.t.cpp
+#include <engine/events/event_batch.h>
+#include <engine/events/event_span.h>
+#include <engine/events/test_event.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST( EventBatchTest, Flipping )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdt;
+
+    StevensDev::sgdm::FrameArena arena;
+    EventBatch<TestEvent> batch;
+
+    batch.push( &arena, TestEvent( "first" ) );
+    batch.push( &arena, TestEvent( "second" ) );
+
+    EXPECT_EQ( 2, batch.queued() );
+    EXPECT_EQ( 0, batch.size() );
+
+    batch.flip();
+
+    // events queued after the flip wait for the next one
+    batch.push( &arena, TestEvent( "third" ) );
+
+    EXPECT_EQ( 1, batch.queued() );
+    ASSERT_EQ( 2, batch.size() );
+    EXPECT_EQ( "first", batch.at( 0 ).type() );
+    EXPECT_EQ( "second", batch[1].type() );
+
+    IEventBatch* copy = batch.clone( &arena );
+
+    batch.clear();
+    batch.flip();
+
+    ASSERT_EQ( 1, batch.size() );
+    EXPECT_EQ( "third", batch.at( 0 ).type() );
+    EXPECT_EQ( 0, batch.queued() );
+
+    EXPECT_EQ( 2, copy->size() );
+    EXPECT_EQ( 1, copy->queued() );
+
+    // events can also be made in place
+    EXPECT_EQ( "fourth", batch.emplace( &arena, "fourth" ).type() );
+    EXPECT_EQ( 1, batch.queued() );
+
+    delete copy;
+}
+
+TEST( EventBatchTest, Spans )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdt;
+
+    StevensDev::sgdm::FrameArena arena;
+    EventBatch<TestEvent> batch;
+    TestEvent single( "single" );
+
+    batch.push( &arena, TestEvent( "batched" ) );
+    batch.push( &arena, TestEvent( "batched" ) );
+    batch.flip();
+
+    EventSpan many( single.typeId(), &batch );
+    EventSpan one( single.typeId(), &single );
+
+    EXPECT_EQ( 2, many.size() );
+    EXPECT_EQ( "batched", many.get<TestEvent>( 1 ).type() );
+    EXPECT_EQ( "batched", many[0].type() );
+    EXPECT_EQ( 1, one.size() );
+    EXPECT_EQ( &single, &one.get<TestEvent>( 0 ) );
+    EXPECT_EQ( single.typeId(), one.type() );
+}
+
+TEST( EventBatchTest, Print )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdt;
+
+    StevensDev::sgdm::FrameArena arena;
+    EventBatch<TestEvent> batch;
+    std::ostringstream oss;
+
+    batch.push( &arena, TestEvent() );
+    oss << batch;
+
+    EXPECT_STREQ( "{ \"queued\": 1, \"size\": 0 }", oss.str().c_str() );
+}
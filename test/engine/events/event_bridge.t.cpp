@@ -0,0 +1,108 @@
+// event_bridge.t.cpp
+#include "engine/events/event_bridge.h"
+#include "engine/events/test_event.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+TEST( EventBridgeTest, Forwarding )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdt;
+
+    EventDispatcher world;
+    EventDispatcher global;
+    std::string heard;
+
+    TestEvent score( "bridge-score.player" );
+    TestEvent hit( "bridge-hit" );
+
+    global.add( "bridge-score", [&]( const IEvent* e ) { heard += "g"; } );
+    global.add( "bridge-hit", [&]( const IEvent* e ) { heard += "h"; } );
+    world.add( "bridge-score", [&]( const IEvent* e ) { heard += "w"; } );
+
+    {
+        EventBridge bridge( &world, &global );
+
+        bridge.add( "bridge-score" );
+        world.postTick();
+        global.postTick();
+
+        // the types within a bridged category are passed on after the
+        // dispatcher's own listeners
+        world.dispatch( &score );
+        world.dispatch( &hit );
+
+        EXPECT_EQ( "wg", heard );
+        EXPECT_EQ( 1, bridge.passed() );
+
+        // forwarding never passes events back
+        heard.clear();
+        global.dispatch( &score );
+
+        EXPECT_EQ( "g", heard );
+
+        // queued events are passed on as they are delivered
+        heard.clear();
+        world.queue( score );
+        world.deliver();
+
+        EXPECT_EQ( "wg", heard );
+        EXPECT_EQ( 2, bridge.passed() );
+    }
+
+    // the bridge's listeners go with it
+    world.postTick();
+    heard.clear();
+    world.dispatch( &score );
+
+    EXPECT_EQ( "w", heard );
+    EXPECT_EQ( 1, world.listeners().size() );
+}
+
+TEST( EventBridgeTest, BothWays )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdt;
+
+    EventDispatcher left;
+    EventDispatcher right;
+    EventBridge bridge( &left, &right, EventBridge::BOTH_WAYS );
+    unsigned int heard[2] = { 0, 0 };
+
+    TestEvent chat( "bridge-chat" );
+
+    left.add( "bridge-chat", [&]( const IEvent* e ) { ++heard[0]; } );
+    right.add( "bridge-chat", [&]( const IEvent* e ) { ++heard[1]; } );
+    bridge.add( "bridge-chat" );
+    left.postTick();
+    right.postTick();
+
+    // each side hears the other once without the event echoing back
+    left.dispatch( &chat );
+
+    EXPECT_EQ( 1, heard[0] );
+    EXPECT_EQ( 1, heard[1] );
+
+    right.dispatch( &chat );
+
+    EXPECT_EQ( 2, heard[0] );
+    EXPECT_EQ( 2, heard[1] );
+    EXPECT_EQ( 2, bridge.passed() );
+}
+
+TEST( EventBridgeTest, Print )
+{
+    using namespace StevensDev::sgde;
+
+    EventDispatcher source;
+    EventDispatcher target;
+    EventBridge bridge( &source, &target );
+    std::ostringstream stream;
+
+    bridge.add( "bridge-printed" );
+    stream << bridge;
+
+    EXPECT_EQ( "{ \"direction\": \"forward\", \"size\": 1, \"passed\": 0 }",
+               stream.str() );
+}
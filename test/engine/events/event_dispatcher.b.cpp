@@ -0,0 +1,420 @@
+// event_dispatcher.b.cpp
+//
+// Measures event dispatching and prints every result as one JSON object
+// per line so that runs of different versions can be compared with:
+//
+//     ./benchmarks --gtest_filter=EventDispatcherBenchmark.* | grep "^{"
+#include <algorithm>
+#include <chrono>
+#include <engine/data/json_printer.h>
+#include <engine/events/event_dispatcher.h>
+#include <engine/events/event_queue.h>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined( __GLIBC__ ) && \
+    ( __GLIBC__ > 2 || ( __GLIBC__ == 2 && __GLIBC_MINOR__ >= 33 ) )
+#define HAS_MALLINFO2
+#include <malloc.h>
+#endif
+
+namespace
+{
+
+const unsigned int EVENTS = 1000000;
+  // The number of events dispatched by each throughput run.
+
+const unsigned int FRAMES = 2000;
+  // The number of frames simulated by each churn run.
+
+const unsigned int EVENTS_PER_FRAME = 256;
+  // The number of events raised each frame.
+
+const unsigned int LATENCY_EVENTS = 100000;
+  // The number of events whose latency is measured.
+
+const unsigned int LISTENERS = 100000;
+  // The number of listeners registered to measure their memory.
+
+typedef std::chrono::steady_clock Clock;
+
+class BenchmarkEvent : public StevensDev::sgde::IEvent
+{
+  private:
+    const std::string* d_type;
+    StevensDev::sgde::EventTypeId d_typeId;
+
+  public:
+    Clock::time_point sent;
+
+    BenchmarkEvent( const std::string* type,
+                    StevensDev::sgde::EventTypeId typeId )
+        : d_type( type ), d_typeId( typeId ), sent( Clock::now() ) {}
+
+    const std::string& type() const { return *d_type; }
+
+    StevensDev::sgde::EventTypeId typeId() const { return d_typeId; }
+};
+
+struct Latencies
+{
+    std::vector<double> samples;
+      // The nanoseconds between sending and receiving each event.
+
+    void receive( const StevensDev::sgde::IEvent* event )
+    {
+        samples.push_back( std::chrono::duration<double, std::nano>(
+            Clock::now() -
+            static_cast<const BenchmarkEvent*>( event )->sent ).count() );
+    }
+};
+
+void intern( std::vector<std::string>* names,
+             std::vector<StevensDev::sgde::EventTypeId>* ids,
+             const char* prefix, unsigned int count )
+{
+    using namespace StevensDev::sgde;
+
+    unsigned int i;
+
+    names->reserve( count );
+
+    for ( i = 0; i < count; ++i )
+    {
+        std::ostringstream name;
+        name << "benchmark-" << prefix << "-" << i;
+
+        names->push_back( name.str() );
+        ids->push_back( EventTypes::inst().intern( names->back() ) );
+    }
+}
+
+void report( const char* benchmark, const char* mode, Latencies& latencies )
+{
+    using namespace StevensDev::sgdd;
+
+    std::vector<double>& samples = latencies.samples;
+    double total = 0.0;
+    unsigned int i;
+
+    std::sort( samples.begin(), samples.end() );
+
+    for ( i = 0; i < samples.size(); ++i )
+    {
+        total += samples[i];
+    }
+
+    JsonPrinter p( std::cout );
+    p.open().print( "benchmark", benchmark )
+            .print( "mode", mode )
+            .print( "events", samples.size() )
+            .print( "meanNs", total / samples.size() )
+            .print( "p50Ns", samples[samples.size() / 2] )
+            .print( "p99Ns", samples[samples.size() * 99 / 100] )
+            .print( "maxNs", samples.back() )
+            .close();
+    std::cout << std::endl;
+}
+
+std::size_t heapBytes()
+{
+#if defined( HAS_MALLINFO2 )
+    struct mallinfo2 info = mallinfo2();
+
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+} // End nspc anonymous
+
+TEST( EventDispatcherBenchmark, Throughput )
+{
+    using namespace StevensDev::sgdd;
+    using namespace StevensDev::sgde;
+
+    const unsigned int TYPES[] = { 1, 16, 256 };
+    const unsigned int PER_TYPE[] = { 1, 8, 64 };
+
+    unsigned long long calls = 0;
+    unsigned int t;
+    unsigned int l;
+    unsigned int i;
+    unsigned int j;
+
+    for ( t = 0; t < sizeof( TYPES ) / sizeof( TYPES[0] ); ++t )
+    {
+        std::vector<std::string> names;
+        std::vector<EventTypeId> ids;
+        std::ostringstream prefix;
+
+        prefix << "throughput" << TYPES[t];
+        intern( &names, &ids, prefix.str().c_str(), TYPES[t] );
+
+        std::vector<BenchmarkEvent> events;
+        for ( i = 0; i < TYPES[t]; ++i )
+        {
+            events.push_back( BenchmarkEvent( &names[i], ids[i] ) );
+        }
+
+        for ( l = 0; l < sizeof( PER_TYPE ) / sizeof( PER_TYPE[0] ); ++l )
+        {
+            EventDispatcher dispatcher;
+            unsigned long long* sink = &calls;
+
+            for ( i = 0; i < TYPES[t]; ++i )
+            {
+                for ( j = 0; j < PER_TYPE[l]; ++j )
+                {
+                    dispatcher.add( ids[i],
+                        [sink]( const IEvent* e ) { ++*sink; } );
+                }
+            }
+
+            dispatcher.postTick();
+
+            auto start = Clock::now();
+            for ( i = 0; i < EVENTS; ++i )
+            {
+                dispatcher.dispatch( &events[i % TYPES[t]] );
+            }
+            auto end = Clock::now();
+
+            double s = std::chrono::duration<double>( end - start ).count();
+
+            JsonPrinter p( std::cout );
+            p.open().print( "benchmark", "throughput" )
+                    .print( "types", TYPES[t] )
+                    .print( "listenersPerType", PER_TYPE[l] )
+                    .print( "eventsPerSecond", EVENTS / s )
+                    .print( "callsPerSecond", EVENTS * PER_TYPE[l] / s )
+                    .close();
+            std::cout << std::endl;
+        }
+    }
+
+    EXPECT_LT( 0, calls );
+}
+
+TEST( EventDispatcherBenchmark, Churn )
+{
+    using namespace StevensDev::sgdd;
+    using namespace StevensDev::sgde;
+
+    const unsigned int TYPES = 64;
+    const unsigned int PER_TYPE = 8;
+    const unsigned int CHURN[] = { 0, 1, 16, 128 };
+
+    std::vector<std::string> names;
+    std::vector<EventTypeId> ids;
+    unsigned long long calls = 0;
+    unsigned long long* sink = &calls;
+    unsigned int c;
+    unsigned int f;
+    unsigned int i;
+
+    intern( &names, &ids, "churn", TYPES );
+
+    std::vector<BenchmarkEvent> events;
+    for ( i = 0; i < TYPES; ++i )
+    {
+        events.push_back( BenchmarkEvent( &names[i], ids[i] ) );
+    }
+
+    for ( c = 0; c < sizeof( CHURN ) / sizeof( CHURN[0] ); ++c )
+    {
+        EventDispatcher dispatcher;
+        std::vector<EventHandle> handles;
+        std::minstd_rand random( 585 );
+
+        for ( i = 0; i < TYPES * PER_TYPE; ++i )
+        {
+            handles.push_back( dispatcher.add( ids[i % TYPES],
+                [sink]( const IEvent* e ) { ++*sink; } ) );
+        }
+
+        dispatcher.postTick();
+
+        // each frame replaces some listeners and raises a burst of events
+        auto start = Clock::now();
+        for ( f = 0; f < FRAMES; ++f )
+        {
+            for ( i = 0; i < CHURN[c]; ++i )
+            {
+                unsigned int index = random() % handles.size();
+
+                dispatcher.remove( handles[index] );
+                handles[index] = dispatcher.add( ids[random() % TYPES],
+                    [sink]( const IEvent* e ) { ++*sink; } );
+            }
+
+            for ( i = 0; i < EVENTS_PER_FRAME; ++i )
+            {
+                dispatcher.dispatch( &events[i % TYPES] );
+            }
+
+            dispatcher.postTick();
+        }
+        auto end = Clock::now();
+
+        double s = std::chrono::duration<double>( end - start ).count();
+
+        JsonPrinter p( std::cout );
+        p.open().print( "benchmark", "churn" )
+                .print( "types", TYPES )
+                .print( "listenersPerType", PER_TYPE )
+                .print( "changesPerFrame", CHURN[c] )
+                .print( "eventsPerSecond", FRAMES * EVENTS_PER_FRAME / s )
+                .print( "usPerFrame", s * 1e6 / FRAMES )
+                .close();
+        std::cout << std::endl;
+    }
+
+    EXPECT_LT( 0, calls );
+}
+
+TEST( EventDispatcherBenchmark, QueuedLatency )
+{
+    using namespace StevensDev::sgde;
+
+    std::vector<std::string> names;
+    std::vector<EventTypeId> ids;
+    EventDispatcher dispatcher;
+    Latencies latencies;
+    unsigned int i;
+
+    intern( &names, &ids, "queued", 1 );
+
+    latencies.samples.reserve( LATENCY_EVENTS );
+    dispatcher.setDeliveryPhase( EventDispatcher::DELIVER_MANUALLY );
+    dispatcher.add( ids[0],
+                    EventListener::bind<Latencies, &Latencies::receive>(
+                        &latencies ) );
+    dispatcher.postTick();
+
+    // a frame's burst is emitted and then delivered together
+    for ( i = 0; i < LATENCY_EVENTS; ++i )
+    {
+        dispatcher.emit<BenchmarkEvent>( &names[0], ids[0] );
+
+        if ( ( i + 1 ) % EVENTS_PER_FRAME == 0 )
+        {
+            dispatcher.deliver();
+        }
+    }
+
+    dispatcher.deliver();
+
+    ASSERT_EQ( LATENCY_EVENTS, latencies.samples.size() );
+
+    report( "latency", "queued", latencies );
+}
+
+TEST( EventDispatcherBenchmark, CrossThreadLatency )
+{
+    using namespace StevensDev::sgde;
+
+    std::vector<std::string> names;
+    std::vector<EventTypeId> ids;
+    EventDispatcher dispatcher;
+    EventQueue queue( &dispatcher );
+    Latencies latencies;
+
+    intern( &names, &ids, "cross-thread", 1 );
+
+    latencies.samples.reserve( LATENCY_EVENTS );
+    dispatcher.add( ids[0],
+                    EventListener::bind<Latencies, &Latencies::receive>(
+                        &latencies ) );
+    dispatcher.postTick();
+
+    std::thread producer( [&]() {
+        unsigned int i;
+
+        for ( i = 0; i < LATENCY_EVENTS; ++i )
+        {
+            // the event is stamped when it is made so retries count
+            BenchmarkEvent* event = new BenchmarkEvent( &names[0], ids[0] );
+
+            while ( !queue.post( event ) )
+            {
+                std::this_thread::yield();
+            }
+        }
+    } );
+
+    // the main thread drains as fast as it can as if every tick were empty
+    while ( latencies.samples.size() < LATENCY_EVENTS )
+    {
+        if ( queue.drain() == 0 )
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+
+    report( "latency", "crossThread", latencies );
+}
+
+TEST( EventDispatcherBenchmark, ListenerMemory )
+{
+    using namespace StevensDev::sgdd;
+    using namespace StevensDev::sgde;
+
+    const unsigned int TYPES = 64;
+
+    std::vector<std::string> names;
+    std::vector<EventTypeId> ids;
+    unsigned long long calls = 0;
+    unsigned long long* sink = &calls;
+    unsigned int i;
+
+    intern( &names, &ids, "memory", TYPES );
+
+    std::size_t before = heapBytes();
+
+    if ( before == 0 )
+    {
+        std::cout << "Heap usage is only measured with glibc." << std::endl;
+        return;
+    }
+
+    {
+        EventDispatcher dispatcher;
+
+        for ( i = 0; i < LISTENERS; ++i )
+        {
+            dispatcher.add( ids[i % TYPES],
+                            [sink]( const IEvent* e ) { ++*sink; } );
+        }
+
+        dispatcher.postTick();
+
+        // routes are built on the first dispatch of each type
+        for ( i = 0; i < TYPES; ++i )
+        {
+            BenchmarkEvent event( &names[i], ids[i] );
+            dispatcher.dispatch( &event );
+        }
+
+        std::size_t after = heapBytes();
+
+        JsonPrinter p( std::cout );
+        p.open().print( "benchmark", "memory" )
+                .print( "types", TYPES )
+                .print( "listeners", LISTENERS )
+                .print( "bytesPerListener",
+                        double( after - before ) / LISTENERS )
+                .close();
+        std::cout << std::endl;
+    }
+
+    EXPECT_EQ( LISTENERS, calls );
+}
@@ -2,8 +2,37 @@
 #include "engine/events/event_dispatcher.h"
 #include "engine/events/test_event.h"
 #include "engine/events/test_listener.h"
+#include "engine/time/time_source.h"
+#include <functional>
 #include <gtest/gtest.h>
 
+namespace
+{
+
+class CountedEvent : public StevensDev::sgde::IEvent
+{
+  private:
+    static const std::string TYPE;
+
+    int* d_alive;
+
+  public:
+    CountedEvent( int* alive ) : d_alive( alive ) { ++*d_alive; }
+
+    CountedEvent( const CountedEvent& other ) : d_alive( other.d_alive )
+    {
+        ++*d_alive;
+    }
+
+    ~CountedEvent() { --*d_alive; }
+
+    const std::string& type() const { return TYPE; }
+};
+
+const std::string CountedEvent::TYPE = "counted";
+
+} // End nspc anonymous
+
 TEST( EventDispatcherTest, Construction )
 {
     using namespace StevensDev::sgde;
@@ -50,6 +79,364 @@ TEST( EventDispatcherTest, Dispatching )
     EXPECT_FALSE( listener.wasCalled() );
 }
 
+TEST( EventDispatcherTest, InternedTypes )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdt;
+
+    EventDispatcher d;
+
+    TestListener first;
+    TestListener second;
+    TestListener other;
+    TestEvent event( "interned" );
+    TestEvent otherEvent( "interned-other" );
+
+    EventTypeId type = EventTypes::inst().intern( "interned" );
+
+    // names and identifiers register the same listeners
+    EventHandle firstHandle = d.add( type, std::bind(
+        &TestListener::receive, &first, std::placeholders::_1 ) );
+    d.add( "interned", std::bind(
+        &TestListener::receive, &second, std::placeholders::_1 ) );
+    d.add( otherEvent.typeId(), std::bind(
+        &TestListener::receive, &other, std::placeholders::_1 ) );
+    d.postTick();
+
+    d.dispatch( &event );
+
+    EXPECT_EQ( type, event.typeId() );
+    EXPECT_TRUE( first.wasCalled() );
+    EXPECT_TRUE( second.wasCalled() );
+    EXPECT_FALSE( other.wasCalled() );
+
+    // listeners added together are still removed by handle
+    d.remove( "interned", firstHandle );
+    d.postTick();
+    first.reset();
+    second.reset();
+
+    d.dispatch( &event );
+
+    EXPECT_FALSE( first.wasCalled() );
+    EXPECT_TRUE( second.wasCalled() );
+}
+
+TEST( EventDispatcherTest, Ordering )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdt;
+
+    EventDispatcher d;
+
+    TestEvent event( "ordered" );
+    std::string calls;
+    EventHandle handles[4];
+
+    handles[0] = d.add( "ordered", [&]( const IEvent* e ) { calls += "a"; } );
+    handles[1] = d.add( "ordered", [&]( const IEvent* e ) { calls += "b"; } );
+    handles[2] = d.add( "ordered", [&]( const IEvent* e ) { calls += "c"; } );
+    d.postTick();
+
+    // listeners are called in the order they were added
+    d.dispatch( &event );
+
+    EXPECT_EQ( "abc", calls );
+
+    EXPECT_TRUE( d.remove( handles[1] ) );
+    EXPECT_FALSE( d.remove( handles[1] ) );
+    handles[3] = d.add( "ordered", [&]( const IEvent* e ) { calls += "d"; } );
+
+    // removals are not applied until the post-tick phase
+    calls.clear();
+    d.dispatch( &event );
+
+    EXPECT_EQ( "abc", calls );
+    EXPECT_EQ( 2, d.listeners().pending() );
+
+    d.postTick();
+    calls.clear();
+    d.dispatch( &event );
+
+    EXPECT_EQ( "acd", calls );
+    EXPECT_EQ( 3, d.listeners().size() );
+    EXPECT_FALSE( d.listeners().contains( handles[1] ) );
+    EXPECT_TRUE( d.listeners().contains( handles[3] ) );
+}
+
+TEST( EventDispatcherTest, Categories )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdt;
+
+    EventDispatcher d;
+
+    TestEvent player( "dispatch-hit.player" );
+    TestEvent other( "dispatch-miss" );
+    std::string calls;
+    unsigned int spans = 0;
+
+    d.add( "dispatch-hit", [&]( const IEvent* e ) { calls += "c"; } );
+    d.add( "dispatch-hit.player", [&]( const IEvent* e ) { calls += "p"; } );
+    d.addBatch( "dispatch-hit", [&]( const EventSpan& span ) { ++spans; } );
+    d.postTick();
+
+    // a type's own listeners run before those of its categories
+    d.dispatch( &player );
+
+    EXPECT_EQ( "pc", calls );
+    EXPECT_EQ( 1, spans );
+
+    d.dispatch( &other );
+
+    EXPECT_EQ( "pc", calls );
+
+    // types interned after registering are still routed
+    TestEvent wall( "dispatch-hit.wall.stone" );
+
+    calls.clear();
+    d.dispatch( &wall );
+
+    EXPECT_EQ( "c", calls );
+    EXPECT_EQ( 2, spans );
+
+    // queued events are delivered type by type with a span for each
+    d.queue( wall );
+    d.queue( wall );
+    d.queue( player );
+    calls.clear();
+    d.deliver();
+
+    EXPECT_EQ( "pccc", calls );
+    EXPECT_EQ( 4, spans );
+}
+
+TEST( EventDispatcherTest, Queueing )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdt;
+
+    EventDispatcher d;
+
+    TestListener listener;
+    TestEvent event( "queued" );
+    unsigned int spans = 0;
+    unsigned int events = 0;
+
+    d.add( "queued", std::bind(
+        &TestListener::receive, &listener, std::placeholders::_1 ) );
+    d.addBatch( "queued", [&]( const EventSpan& span )
+                          {
+                              ++spans;
+                              events += span.size();
+
+                              // queueing during delivery waits a delivery
+                              if ( spans == 1 )
+                              {
+                                  d.queue( span.get<TestEvent>( 0 ) );
+                              }
+                          } );
+    d.postTick();
+
+    EXPECT_EQ( EventDispatcher::DELIVER_ON_POST_TICK, d.deliveryPhase() );
+
+    d.queue( event );
+    d.queue( event );
+    d.queue( event );
+
+    EXPECT_EQ( 3, d.queued() );
+    EXPECT_FALSE( listener.wasCalled() );
+
+    // other phases do not deliver
+    d.preTick();
+    d.tick( 0.1f );
+
+    EXPECT_FALSE( listener.wasCalled() );
+
+    d.postTick();
+
+    EXPECT_TRUE( listener.wasCalled() );
+    EXPECT_EQ( 1, spans );
+    EXPECT_EQ( 3, events );
+    EXPECT_EQ( 1, d.queued() );
+
+    // manual delivery
+    d.setDeliveryPhase( EventDispatcher::DELIVER_MANUALLY );
+    d.postTick();
+
+    EXPECT_EQ( 1, spans );
+
+    d.deliver();
+
+    EXPECT_EQ( 2, spans );
+    EXPECT_EQ( 4, events );
+    EXPECT_EQ( 0, d.queued() );
+
+    // immediate dispatch gives batch listeners a span of one
+    d.dispatch( &event );
+
+    EXPECT_EQ( 3, spans );
+    EXPECT_EQ( 5, events );
+
+    // copies keep their own queues
+    d.queue( event );
+
+    EventDispatcher copy( d );
+
+    d.deliver();
+
+    EXPECT_EQ( 0, d.queued() );
+    EXPECT_EQ( 1, copy.queued() );
+}
+
+TEST( EventDispatcherTest, Emitting )
+{
+    using namespace StevensDev::sgde;
+
+    EventDispatcher d;
+
+    int alive = 0;
+    unsigned int received = 0;
+
+    d.addBatch( "counted", [&]( const EventSpan& span )
+                           {
+                               received += span.size();
+
+                               // events made during delivery wait for the
+                               // next one
+                               if ( received == 2 )
+                               {
+                                   d.emit<CountedEvent>( &alive );
+                               }
+                           } );
+    d.postTick();
+
+    // events are made in place and live until they have been delivered
+    d.emit<CountedEvent>( &alive );
+    d.queue( CountedEvent( &alive ) );
+
+    EXPECT_EQ( 2, alive );
+    EXPECT_EQ( 2, d.queued() );
+    EXPECT_LT( 0, d.arena().used() );
+
+    d.deliver();
+
+    EXPECT_EQ( 2, received );
+    EXPECT_EQ( 1, alive );
+    EXPECT_EQ( 1, d.queued() );
+
+    unsigned int capacity = d.arena().capacity();
+
+    d.deliver();
+
+    EXPECT_EQ( 3, received );
+    EXPECT_EQ( 0, alive );
+    EXPECT_EQ( 0, d.arena().used() );
+
+    // later frames reuse the arena's memory
+    d.emit<CountedEvent>( &alive );
+    d.deliver();
+
+    EXPECT_EQ( capacity, d.arena().capacity() );
+
+    // undelivered events are destructed with the dispatcher
+    {
+        EventDispatcher other;
+
+        other.emit<CountedEvent>( &alive );
+
+        EventDispatcher copy( other );
+
+        EXPECT_EQ( 2, alive );
+    }
+
+    EXPECT_EQ( 0, alive );
+}
+
+TEST( EventDispatcherTest, Stats )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdk;
+    using namespace StevensDev::sgdt;
+
+    EventDispatcher d;
+    EventStats stats;
+
+    TestEvent event( "dispatch-timed" );
+    EventTypeId type = event.typeId();
+    unsigned int storms = 0;
+
+    d.add( type, [&]( const IEvent* e ) {} );
+    EventHandle slow = d.add( type, [&]( const IEvent* e ) {
+        TimePoint start = TimeSource::now();
+
+        while ( TimeSource::now() - start < 100000 )
+        {
+            // stand in for an expensive listener
+        }
+    } );
+    d.postTick();
+
+    // nothing is recorded until the dispatcher is given stats
+    d.dispatch( &event );
+
+    EXPECT_EQ( nullptr, d.stats() );
+    EXPECT_EQ( 0, stats.size() );
+
+    stats.setRateThreshold( 2 );
+    stats.setStormListener(
+        [&]( EventTypeId t, const EventTypeStats& s ) { ++storms; } );
+    d.setStats( &stats );
+    d.setDeliveryPhase( EventDispatcher::DELIVER_MANUALLY );
+
+    d.dispatch( &event );
+    d.queue( event );
+    d.queue( event );
+    d.deliver();
+
+    ASSERT_LT( type, stats.size() );
+    EXPECT_EQ( 3, stats[type].frameCount );
+    EXPECT_EQ( slow, stats[type].slowestHandle );
+    EXPECT_LE( 100000, stats[type].slowest );
+    EXPECT_LT( stats[type].slowest, stats[type].frameTime );
+
+    // each post-tick ends a frame of the stats
+    d.postTick();
+
+    EXPECT_EQ( 1, stats.frames() );
+    EXPECT_EQ( 1, storms );
+    EXPECT_EQ( 0, stats[type].frameCount );
+
+    d.setStats( nullptr );
+}
+
+TEST( EventDispatcherTest, Observer )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdt;
+
+    EventDispatcher d;
+
+    TestListener listener;
+    TestEvent event( "unlistened" );
+
+    d.setObserver( std::bind( &TestListener::receive, &listener,
+                              std::placeholders::_1 ) );
+
+    // the observer sees events that nothing listens to
+    d.dispatch( &event );
+
+    EXPECT_TRUE( listener.wasCalled() );
+    EXPECT_STREQ( "unlistened", listener.receivedType().c_str() );
+
+    d.setObserver( EventListener() );
+    listener.reset();
+
+    d.dispatch( &event );
+
+    EXPECT_FALSE( listener.wasCalled() );
+}
+
 TEST( EventDispatcher, Print )
 {
     using namespace StevensDev::sgde;
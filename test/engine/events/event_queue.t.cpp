@@ -0,0 +1,129 @@
+// event_queue.t.cpp
+#include "engine/events/event_dispatcher.h"
+#include "engine/events/event_queue.h"
+#include "engine/events/test_event.h"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+
+TEST( EventQueueTest, Posting )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdt;
+
+    EventDispatcher dispatcher;
+    EventQueue queue( &dispatcher, 4 );
+    TestEvent event( "posted" );
+    unsigned int received = 0;
+    unsigned int i;
+
+    dispatcher.add( "posted", [&]( const IEvent* e ) { ++received; } );
+    dispatcher.postTick();
+
+    EXPECT_EQ( 4, queue.capacity() );
+
+    // a full queue rejects instead of blocking
+    for ( i = 0; i < 4; ++i )
+    {
+        EXPECT_TRUE( queue.postCopy( event ) );
+    }
+
+    EXPECT_FALSE( queue.postCopy( event ) );
+    EXPECT_EQ( 4, queue.size() );
+    EXPECT_EQ( 0, received );
+
+    queue.preTick();
+
+    EXPECT_EQ( 4, received );
+    EXPECT_EQ( 0, queue.size() );
+    EXPECT_EQ( 4, queue.posted() );
+    EXPECT_EQ( 1, queue.rejected() );
+    EXPECT_EQ( 4, queue.drained() );
+    EXPECT_EQ( 4, queue.highWater() );
+
+    // the cells are reused once drained
+    EXPECT_TRUE( queue.post( new TestEvent( "posted" ) ) );
+    EXPECT_EQ( 1, queue.drain() );
+    EXPECT_EQ( 5, received );
+    EXPECT_EQ( 4, queue.highWater() );
+
+    queue.resetStats();
+
+    EXPECT_EQ( 0, queue.posted() );
+    EXPECT_EQ( 0, queue.highWater() );
+
+    // undrained events are deleted with the queue
+    queue.postCopy( event );
+}
+
+TEST( EventQueueTest, Producers )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdt;
+
+    const unsigned int THREADS = 4;
+    const unsigned int POSTS = 5000;
+
+    EventDispatcher dispatcher;
+    EventQueue queue( &dispatcher, 256 );
+    std::thread producers[THREADS];
+    std::atomic<unsigned int> finished( 0 );
+    unsigned int received = 0;
+    unsigned int i;
+
+    dispatcher.add( "produced", [&]( const IEvent* e ) { ++received; } );
+    dispatcher.postTick();
+
+    for ( i = 0; i < THREADS; ++i )
+    {
+        producers[i] = std::thread( [&queue, &finished]()
+        {
+            TestEvent event( "produced" );
+            unsigned int j;
+
+            // retry when full as a producer under back-pressure would
+            for ( j = 0; j < POSTS; ++j )
+            {
+                while ( !queue.postCopy( event ) )
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            ++finished;
+        } );
+    }
+
+    while ( finished.load() < THREADS || queue.size() > 0 )
+    {
+        queue.drain();
+    }
+
+    for ( i = 0; i < THREADS; ++i )
+    {
+        producers[i].join();
+    }
+
+    queue.drain();
+
+    EXPECT_EQ( THREADS * POSTS, received );
+    EXPECT_EQ( THREADS * POSTS, queue.posted() );
+    EXPECT_EQ( THREADS * POSTS, queue.drained() );
+    EXPECT_LE( queue.highWater(), 256 );
+}
+
+TEST( EventQueueTest, Print )
+{
+    using namespace StevensDev::sgde;
+
+    EventDispatcher dispatcher;
+    EventQueue queue( &dispatcher, 8 );
+    std::ostringstream oss;
+
+    oss << queue;
+
+    EXPECT_STREQ( "{ \"size\": 0, \"capacity\": 8, \"posted\": 0, "
+                  "\"rejected\": 0, \"drained\": 0, \"highWater\": 0 }",
+                  oss.str().c_str() );
+}
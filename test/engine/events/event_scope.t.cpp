@@ -0,0 +1,124 @@
+// event_scope.t.cpp
+#include "engine/events/event_bus.h"
+#include "engine/events/event_scope.h"
+#include "engine/events/test_event.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+
+TEST( EventScopeTest, Nesting )
+{
+    using namespace StevensDev::sgde;
+
+    EventDispatcher& global = EventBus::dispatcher();
+    EventQueue& globalQueue = EventBus::queue();
+    EventDispatcher outer;
+    EventDispatcher inner;
+    EventQueue outerQueue( &outer );
+    EventQueue innerQueue( &inner );
+
+    EXPECT_EQ( nullptr, EventScope::current() );
+    EXPECT_EQ( &global, &EventBus::globalDispatcher() );
+
+    {
+        EventScope outerScope( &outerQueue );
+
+        EXPECT_EQ( &outer, &EventBus::dispatcher() );
+        EXPECT_EQ( &outerQueue, &EventBus::queue() );
+
+        {
+            EventScope innerScope( &innerQueue );
+
+            EXPECT_EQ( &innerScope, EventScope::current() );
+            EXPECT_EQ( &inner, &EventBus::dispatcher() );
+            EXPECT_EQ( &innerQueue, &EventBus::queue() );
+            EXPECT_EQ( &global, &EventBus::globalDispatcher() );
+        }
+
+        EXPECT_EQ( &outer, &EventBus::dispatcher() );
+        EXPECT_EQ( &outerQueue, &EventBus::queue() );
+    }
+
+    EXPECT_EQ( nullptr, EventScope::current() );
+    EXPECT_EQ( &global, &EventBus::dispatcher() );
+    EXPECT_EQ( &globalQueue, &EventBus::queue() );
+}
+
+TEST( EventScopeTest, Queues )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdt;
+
+    EventDispatcher dispatcher;
+    EventQueue queue( &dispatcher );
+    EventScope scope( &queue );
+    unsigned int heard = 0;
+
+    dispatcher.add( "scoped", [&]( const IEvent* e ) { ++heard; } );
+    dispatcher.postTick();
+
+    // the scope dispatches what is posted to its queue
+    EXPECT_EQ( &queue, scope.queue() );
+    EXPECT_EQ( &dispatcher, scope.dispatcher() );
+    EXPECT_TRUE( EventBus::queue().postCopy( TestEvent( "scoped" ) ) );
+    EXPECT_EQ( 1, queue.drain() );
+    EXPECT_EQ( 1, heard );
+}
+
+TEST( EventScopeTest, Threads )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdt;
+
+    EventDispatcher first;
+    EventDispatcher second;
+    EventQueue firstQueue( &first );
+    EventQueue secondQueue( &second );
+    unsigned int heard[2] = { 0, 0 };
+    std::thread threads[2];
+    unsigned int i;
+
+    first.add( "scoped", [&]( const IEvent* e ) { ++heard[0]; } );
+    first.postTick();
+    second.add( "scoped", [&]( const IEvent* e ) { ++heard[1]; } );
+    second.postTick();
+
+    // each thread raises events on its own bus without seeing the other's
+    threads[0] = std::thread( [&]() {
+        EventScope scope( &firstQueue );
+        TestEvent event( "scoped" );
+
+        EventBus::dispatcher().dispatch( &event );
+    } );
+
+    threads[1] = std::thread( [&]() {
+        EventScope scope( &secondQueue );
+        TestEvent event( "scoped" );
+
+        EventBus::dispatcher().dispatch( &event );
+        EventBus::dispatcher().dispatch( &event );
+    } );
+
+    for ( i = 0; i < 2; ++i )
+    {
+        threads[i].join();
+    }
+
+    EXPECT_EQ( 1, heard[0] );
+    EXPECT_EQ( 2, heard[1] );
+    EXPECT_EQ( nullptr, EventScope::current() );
+}
+
+TEST( EventScopeTest, Print )
+{
+    using namespace StevensDev::sgde;
+
+    EventDispatcher dispatcher;
+    EventQueue queue( &dispatcher );
+    EventScope scope( &queue );
+    std::ostringstream stream;
+
+    stream << scope;
+
+    EXPECT_EQ( "{ \"isCurrent\": true }", stream.str() );
+}
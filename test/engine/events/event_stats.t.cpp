@@ -0,0 +1,109 @@
+// event_stats.t.cpp
+#include <engine/events/event_stats.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST( EventStatsTest, Recording )
+{
+    using namespace StevensDev::sgde;
+
+    EventStats stats;
+    EventTypeId type = EventTypes::inst().intern( "stats-recorded" );
+
+    EXPECT_EQ( 0, stats.size() );
+
+    stats.countEvents( type, 3 );
+    stats.timeListener( type, 7, 100 );
+    stats.timeListener( type, 9, 300 );
+    stats.timeListener( type, 11, 200 );
+
+    ASSERT_LT( type, stats.size() );
+    EXPECT_EQ( 3, stats[type].frameCount );
+    EXPECT_EQ( 600, stats[type].frameTime );
+    EXPECT_EQ( 300, stats[type].slowest );
+    EXPECT_EQ( 9, stats[type].slowestHandle );
+
+    // frame counts restart while the totals keep growing
+    stats.endFrame();
+    stats.countEvents( type, 1 );
+    stats.timeListener( type, 7, 50 );
+
+    EXPECT_EQ( 1, stats.frames() );
+    EXPECT_EQ( 1, stats[type].frameCount );
+    EXPECT_EQ( 50, stats[type].frameTime );
+    EXPECT_EQ( 4, stats[type].count );
+    EXPECT_EQ( 650, stats[type].time );
+    EXPECT_EQ( 9, stats[type].slowestHandle );
+    EXPECT_EQ( 0, stats[type].storms );
+
+    stats.reset();
+
+    EXPECT_EQ( 0, stats.size() );
+    EXPECT_EQ( 0, stats.frames() );
+}
+
+TEST( EventStatsTest, Storms )
+{
+    using namespace StevensDev::sgde;
+
+    EventStats stats;
+    EventTypeId busy = EventTypes::inst().intern( "stats-busy" );
+    EventTypeId slow = EventTypes::inst().intern( "stats-slow" );
+    EventTypeId calm = EventTypes::inst().intern( "stats-calm" );
+    std::string storms;
+
+    stats.setRateThreshold( 10 );
+    stats.setTimeThreshold( 1000 );
+    stats.setStormListener(
+        [&]( EventTypeId type, const EventTypeStats& typeStats ) {
+            storms += EventTypes::inst().name( type ) + " ";
+        } );
+
+    stats.countEvents( busy, 11 );
+    stats.countEvents( slow, 1 );
+    stats.timeListener( slow, 1, 1001 );
+    stats.countEvents( calm, 10 );
+    stats.timeListener( calm, 2, 1000 );
+
+    // types are only reported once their frame ends
+    EXPECT_EQ( "", storms );
+
+    stats.endFrame();
+
+    EXPECT_EQ( 1, stats[busy].storms );
+    EXPECT_EQ( 1, stats[slow].storms );
+    EXPECT_EQ( 0, stats[calm].storms );
+    EXPECT_NE( std::string::npos, storms.find( "stats-busy " ) );
+    EXPECT_NE( std::string::npos, storms.find( "stats-slow " ) );
+    EXPECT_EQ( std::string::npos, storms.find( "stats-calm " ) );
+
+    // a quiet frame reports nothing
+    storms.clear();
+    stats.countEvents( busy, 1 );
+    stats.endFrame();
+
+    EXPECT_EQ( "", storms );
+    EXPECT_EQ( 1, stats[busy].storms );
+}
+
+TEST( EventStatsTest, Print )
+{
+    using namespace StevensDev::sgde;
+
+    EventStats stats;
+    std::ostringstream empty;
+    std::ostringstream stream;
+
+    empty << stats;
+
+    EXPECT_EQ( "{ \"frames\": 0, \"types\": {} }", empty.str() );
+
+    stats.countEvents( EventTypes::inst().intern( "stats-printed" ), 2 );
+    stats.timeListener( EventTypes::inst().intern( "stats-printed" ), 5, 40 );
+    stats.endFrame();
+    stream << stats;
+
+    EXPECT_EQ( "{ \"frames\": 1, \"types\": { \"stats-printed\": "
+               "{ \"count\": 2, \"time\": 40, \"slowest\": 40, "
+               "\"slowestHandle\": 5, \"storms\": 0 } } }", stream.str() );
+}
@@ -0,0 +1,93 @@
+// event_types.t.cpp
+#include <engine/events/event_types.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+
+TEST( EventTypesTest, Interning )
+{
+    using namespace StevensDev::sgde;
+
+    EventTypes& types = EventTypes::inst();
+
+    EventTypeId first = types.intern( "types-first" );
+    EventTypeId second = types.intern( "types-second" );
+
+    // identifiers are dense and stable
+    EXPECT_NE( first, second );
+    EXPECT_EQ( first, types.intern( "types-first" ) );
+    EXPECT_LT( first, types.size() );
+    EXPECT_LT( second, types.size() );
+    EXPECT_EQ( "types-second", types.name( second ) );
+}
+
+TEST( EventTypesTest, Categories )
+{
+    using namespace StevensDev::sgde;
+
+    EventTypes& types = EventTypes::inst();
+
+    EventTypeId leaf = types.intern( "types-tree.branch.leaf" );
+    EventTypeId branch = types.intern( "types-tree.branch" );
+    EventTypeId root = types.intern( "types-tree" );
+    EventTypeId other = types.intern( "types-tree.other" );
+
+    // categories are interned with the types within them
+    EXPECT_LT( branch, leaf );
+    EXPECT_LT( root, branch );
+    EXPECT_EQ( branch, types.parent( leaf ) );
+    EXPECT_EQ( root, types.parent( branch ) );
+    EXPECT_EQ( EventTypes::NO_TYPE, types.parent( root ) );
+
+    EXPECT_TRUE( types.isWithin( leaf, root ) );
+    EXPECT_TRUE( types.isWithin( leaf, leaf ) );
+    EXPECT_TRUE( types.isWithin( other, root ) );
+    EXPECT_FALSE( types.isWithin( other, branch ) );
+    EXPECT_FALSE( types.isWithin( root, leaf ) );
+
+    // a leading separator does not make an empty category
+    EXPECT_EQ( EventTypes::NO_TYPE, types.parent( types.intern( ".dot" ) ) );
+}
+
+TEST( EventTypesTest, Threads )
+{
+    using namespace StevensDev::sgde;
+
+    EventTypes& types = EventTypes::inst();
+
+    EventTypeId ids[4];
+    std::thread threads[4];
+    unsigned int i;
+
+    for ( i = 0; i < 4; ++i )
+    {
+        threads[i] = std::thread( [&types, &ids, i]()
+                                  {
+                                      ids[i] = types.intern( "types-shared" );
+                                  } );
+    }
+
+    for ( i = 0; i < 4; ++i )
+    {
+        threads[i].join();
+    }
+
+    for ( i = 1; i < 4; ++i )
+    {
+        EXPECT_EQ( ids[0], ids[i] );
+    }
+}
+
+TEST( EventTypesTest, Print )
+{
+    using namespace StevensDev::sgde;
+
+    EventTypes& types = EventTypes::inst();
+    std::ostringstream oss;
+    std::ostringstream expected;
+
+    expected << "{ \"size\": " << types.size() << " }";
+    oss << types;
+
+    EXPECT_EQ( expected.str(), oss.str() );
+}
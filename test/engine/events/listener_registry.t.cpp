@@ -0,0 +1,137 @@
+// listener_registry.t.cpp
+#include <engine/events/listener_registry.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace
+{
+
+void ignore( const StevensDev::sgde::IEvent* event )
+{
+}
+
+void ignoreSpan( const StevensDev::sgde::EventSpan& span )
+{
+}
+
+} // End nspc anonymous
+
+TEST( ListenerRegistryTest, Handles )
+{
+    using namespace StevensDev::sgde;
+
+    ListenerRegistry registry;
+    EventHandle first = registry.add( 0, &ignore );
+    EventHandle second = registry.addBatch( 0, &ignoreSpan );
+
+    EXPECT_NE( first, second );
+    EXPECT_TRUE( registry.contains( first ) );
+    EXPECT_EQ( 2, registry.pending() );
+    EXPECT_EQ( 0, registry.size() );
+    EXPECT_EQ( 0, registry.types() );
+
+    EXPECT_TRUE( registry.flush() );
+    EXPECT_FALSE( registry.flush() );
+
+    ASSERT_EQ( 1, registry.types() );
+    ASSERT_EQ( 2, registry.listeners( 0 ).size() );
+    EXPECT_TRUE( static_cast<bool>( registry.listeners( 0 )[0].listener ) );
+    EXPECT_TRUE(
+        static_cast<bool>( registry.listeners( 0 )[1].batchListener ) );
+
+    // removed handles stop working at once and are never reused
+    EXPECT_TRUE( registry.remove( first ) );
+    EXPECT_FALSE( registry.contains( first ) );
+    EXPECT_FALSE( registry.remove( first ) );
+    registry.flush();
+
+    EventHandle third = registry.add( 0, &ignore );
+
+    registry.flush();
+
+    EXPECT_NE( first, third );
+    EXPECT_FALSE( registry.contains( first ) );
+    EXPECT_TRUE( registry.contains( third ) );
+    EXPECT_FALSE( registry.remove( ListenerRegistry::INVALID_HANDLE ) );
+    EXPECT_EQ( 2, registry.size() );
+
+    // listeners removed before they are listed never are
+    EventHandle fleeting = registry.add( 1, &ignore );
+
+    registry.remove( fleeting );
+    registry.flush();
+
+    EXPECT_EQ( 2, registry.size() );
+    EXPECT_EQ( 1, registry.types() );
+}
+
+TEST( ListenerRegistryTest, Tombstones )
+{
+    using namespace StevensDev::sgde;
+
+    ListenerRegistry registry;
+    EventHandle handles[8];
+    unsigned int i;
+
+    for ( i = 0; i < 8; ++i )
+    {
+        handles[i] = registry.add( 3, &ignore );
+    }
+
+    registry.flush();
+
+    // a few removals leave tombstones in place
+    registry.remove( handles[1] );
+    registry.remove( handles[4] );
+    registry.flush();
+
+    const StevensDev::sgdc::DynamicArray<RegisteredListener>& list =
+        registry.listeners( 3 );
+
+    EXPECT_EQ( 6, registry.size() );
+    ASSERT_EQ( 8, list.size() );
+    EXPECT_FALSE( static_cast<bool>( list[1].listener ) );
+    EXPECT_FALSE( static_cast<bool>( list[4].batchListener ) );
+
+    // removing most of the list compacts it in order
+    registry.remove( handles[0] );
+    registry.remove( handles[2] );
+    registry.remove( handles[6] );
+    registry.flush();
+
+    EXPECT_EQ( 3, registry.size() );
+    ASSERT_EQ( 3, list.size() );
+
+    EXPECT_TRUE( registry.remove( handles[3] ) );
+    EXPECT_TRUE( registry.remove( handles[5] ) );
+    EXPECT_TRUE( registry.remove( handles[7] ) );
+    registry.flush();
+
+    EXPECT_EQ( 0, registry.size() );
+    EXPECT_EQ( 0, list.size() );
+
+    // freed slots are reused with new handles
+    EventHandle reused = registry.add( 3, &ignore );
+
+    registry.flush();
+
+    for ( i = 0; i < 8; ++i )
+    {
+        EXPECT_NE( handles[i], reused );
+    }
+
+    EXPECT_EQ( 1, list.size() );
+}
+
+TEST( ListenerRegistryTest, Print )
+{
+    using namespace StevensDev::sgde;
+
+    ListenerRegistry registry;
+    std::ostringstream stream;
+
+    registry.add( 0, &ignore );
+    stream << registry;
+
+    EXPECT_EQ( "{ \"size\": 0, \"pending\": 1 }", stream.str() );
+}
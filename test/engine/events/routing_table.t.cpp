@@ -0,0 +1,64 @@
+// routing_table.t.cpp
+#include <engine/events/routing_table.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace
+{
+
+void ignore( const StevensDev::sgde::IEvent* event )
+{
+}
+
+} // End nspc anonymous
+
+TEST( RoutingTableTest, Routes )
+{
+    using namespace StevensDev::sgde;
+
+    EventTypes& types = EventTypes::inst();
+    EventTypeId root = types.intern( "routes" );
+    EventTypeId leaf = types.intern( "routes.leaf" );
+
+    ListenerRegistry registry;
+    RoutingTable table;
+
+    registry.add( root, &ignore );
+    registry.add( leaf, &ignore );
+    EventHandle removed = registry.add( leaf, &ignore );
+    registry.flush();
+    registry.remove( removed );
+    registry.flush();
+
+    table.rebuild( registry );
+
+    // every interned type has a route
+    EXPECT_EQ( types.size(), table.size() );
+    EXPECT_EQ( 1, table.end( root ) - table.begin( root ) );
+    ASSERT_EQ( 2, table.end( leaf ) - table.begin( leaf ) );
+    EXPECT_EQ( &registry.listeners( leaf )[0], &table[table.begin( leaf )] );
+    EXPECT_EQ( &registry.listeners( root )[0],
+               &table[table.begin( leaf ) + 1] );
+
+    // later types are appended without touching earlier routes
+    unsigned int first = table.begin( leaf );
+    EventTypeId later = types.intern( "routes.later" );
+
+    table.extend( registry );
+
+    EXPECT_EQ( types.size(), table.size() );
+    EXPECT_EQ( first, table.begin( leaf ) );
+    EXPECT_EQ( 1, table.end( later ) - table.begin( later ) );
+}
+
+TEST( RoutingTableTest, Print )
+{
+    using namespace StevensDev::sgde;
+
+    RoutingTable table;
+    std::ostringstream stream;
+
+    stream << table;
+
+    EXPECT_EQ( "{ \"size\": 0, \"entries\": 0 }", stream.str() );
+}
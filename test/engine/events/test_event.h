@@ -18,6 +18,9 @@ class TestEvent : public sgde::IEvent
     std::string d_type;
       // The test event type.
 
+    sgde::EventTypeId d_typeId;
+      // The interned test event type.
+
   public:
     // CONSTANTS
     static const std::string DEFAULT_TYPE;
@@ -41,6 +44,9 @@ class TestEvent : public sgde::IEvent
     // MEMBER FUNCTIONS
     virtual const std::string& type() const;
       // Gets the test event type.
+
+    virtual sgde::EventTypeId typeId() const;
+      // Gets the interned test event type.
 };
 
 // FREE OPERATORS
@@ -56,17 +62,21 @@ std::ostream& operator<<( std::ostream& stream, const TestEvent& event )
 
 // CONSTRUCTORS
 inline
-TestEvent::TestEvent() : d_type( DEFAULT_TYPE )
+TestEvent::TestEvent()
+    : d_type( DEFAULT_TYPE ),
+      d_typeId( sgde::EventTypes::inst().intern( DEFAULT_TYPE ) )
 {
 }
 
 inline
-TestEvent::TestEvent( const std::string& type ) : d_type( type )
+TestEvent::TestEvent( const std::string& type )
+    : d_type( type ), d_typeId( sgde::EventTypes::inst().intern( type ) )
 {
 }
 
 inline
-TestEvent::TestEvent( const TestEvent& event ) : d_type( event.d_type )
+TestEvent::TestEvent( const TestEvent& event )
+    : d_type( event.d_type ), d_typeId( event.d_typeId )
 {
 }
 
@@ -80,6 +90,7 @@ inline
 TestEvent& TestEvent::operator=( const TestEvent& event )
 {
     d_type = event.d_type;
+    d_typeId = event.d_typeId;
     return *this;
 }
 
@@ -90,6 +101,12 @@ const std::string& TestEvent::type() const
     return d_type;
 }
 
+inline
+sgde::EventTypeId TestEvent::typeId() const
+{
+    return d_typeId;
+}
+
 } // End nspc sgdt
 
 } // End nspc Stevens Dev
@@ -1,5 +1,6 @@
 // input.t.cpp
 #include <engine/input/input.h>
+#include <engine/input/scripted_input.h>
 #include <gtest/gtest.h>
 
 TEST( InputTest, Singleton )
@@ -20,6 +21,32 @@ TEST( InputTest, TickPhases )
     inst.postTick();
 }
 
+TEST( InputTest, Scripted )
+{
+    using namespace StevensDev::sgdi;
+
+    Input& inst = Input::inst();
+    ScriptedInput script;
+
+    script.tap( 0, Input::KEY_D );
+
+    inst.setSource( &script );
+
+    EXPECT_EQ( &script, inst.source() );
+
+    inst.preTick();
+
+    EXPECT_TRUE( inst.isDown( Input::KEY_D ) );
+    EXPECT_FALSE( inst.wasPressed( Input::KEY_D ) );
+
+    inst.preTick();
+
+    EXPECT_TRUE( inst.isUp( Input::KEY_D ) );
+    EXPECT_TRUE( inst.wasPressed( Input::KEY_D ) );
+
+    inst.setSource( nullptr );
+}
+
 TEST( InputTest, Print )
 {
     using namespace StevensDev::sgdi;
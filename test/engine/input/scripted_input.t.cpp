@@ -0,0 +1,80 @@
+// scripted_input.t.cpp
+#include <engine/input/input.h>
+#include <engine/input/scripted_input.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST( ScriptedInputTest, Construction )
+{
+    using namespace StevensDev::sgdi;
+
+    ScriptedInput script;
+    ScriptedInput copy( script );
+
+    EXPECT_EQ( 0, script.frame() );
+    EXPECT_TRUE( script.isFinished() );
+    EXPECT_EQ( 0, copy.frame() );
+}
+
+TEST( ScriptedInputTest, Polling )
+{
+    using namespace StevensDev::sgdi;
+
+    const unsigned int COUNT = Input::INPUT_TYPE_COUNT;
+
+    ScriptedInput script;
+    bool isDown[COUNT];
+
+    // changes may be added out of order
+    script.release( 3, Input::KEY_W )
+          .press( 1, Input::KEY_W )
+          .tap( 2, Input::KEY_A, 2 );
+
+    EXPECT_FALSE( script.isFinished() );
+
+    script.poll( isDown, COUNT );
+
+    EXPECT_FALSE( isDown[Input::KEY_W] );
+    EXPECT_FALSE( isDown[Input::KEY_A] );
+
+    script.poll( isDown, COUNT );
+
+    EXPECT_TRUE( isDown[Input::KEY_W] );
+    EXPECT_FALSE( isDown[Input::KEY_A] );
+
+    script.poll( isDown, COUNT );
+
+    EXPECT_TRUE( isDown[Input::KEY_W] );
+    EXPECT_TRUE( isDown[Input::KEY_A] );
+
+    script.poll( isDown, COUNT );
+
+    EXPECT_FALSE( isDown[Input::KEY_W] );
+    EXPECT_TRUE( isDown[Input::KEY_A] );
+
+    script.poll( isDown, COUNT );
+
+    EXPECT_FALSE( isDown[Input::KEY_A] );
+    EXPECT_TRUE( script.isFinished() );
+    EXPECT_EQ( 5, script.frame() );
+
+    // rewinding plays it again
+    script.rewind();
+    script.poll( isDown, COUNT );
+    script.poll( isDown, COUNT );
+
+    EXPECT_TRUE( isDown[Input::KEY_W] );
+}
+
+TEST( ScriptedInputTest, Print )
+{
+    using namespace StevensDev::sgdi;
+
+    ScriptedInput script;
+    std::ostringstream oss;
+
+    oss << script;
+
+    EXPECT_STREQ( "{ \"frame\": 0, \"finished\": true }",
+                  oss.str().c_str() );
+}
@@ -0,0 +1,221 @@
+// job_system.t.cpp
+#include <atomic>
+#include <engine/jobs/job_system.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+void increment( void* data )
+  // Increments the atomic counter.
+{
+    ++*static_cast<std::atomic<unsigned int>*>( data );
+}
+
+struct Chain
+{
+    StevensDev::sgdj::Job* jobs;
+      // The jobs that this depends on.
+
+    unsigned int count;
+      // The number of dependencies.
+
+    std::atomic<unsigned int>* value;
+      // The value that the dependencies increment.
+
+    unsigned int seen;
+      // The value once every dependency finished.
+};
+
+void runChain( void* data )
+  // Runs the dependencies of the chain and waits for them.
+{
+    using namespace StevensDev::sgdj;
+
+    Chain* chain = static_cast<Chain*>( data );
+    JobCounter counter( chain->count );
+    unsigned int i;
+
+    for ( i = 0; i < chain->count; ++i )
+    {
+        chain->jobs[i].function = &increment;
+        chain->jobs[i].data = chain->value;
+        chain->jobs[i].counter = &counter;
+    }
+
+    JobSystem::inst().run( chain->jobs, chain->count );
+    JobSystem::inst().wait( counter );
+
+    chain->seen = chain->value->load();
+}
+
+} // End nspc anonymous
+
+TEST( JobCounterTest, Counting )
+{
+    using namespace StevensDev::sgdj;
+
+    JobCounter counter;
+
+    EXPECT_TRUE( counter.isDone() );
+
+    counter.add( 2 );
+    EXPECT_EQ( 2, counter.count() );
+    EXPECT_FALSE( counter.isDone() );
+
+    counter.finish();
+    counter.finish();
+    EXPECT_TRUE( counter.isDone() );
+}
+
+TEST( JobSystemTest, Inline )
+{
+    using namespace StevensDev::sgdj;
+
+    JobSystem& system = JobSystem::inst();
+    std::atomic<unsigned int> value( 0 );
+    JobCounter counter( 1 );
+    Job job;
+
+    EXPECT_FALSE( system.isRunning() );
+    EXPECT_FALSE( system.isWorker() );
+
+    // runs immediately without workers
+    job.function = &increment;
+    job.data = &value;
+    job.counter = &counter;
+
+    system.run( &job );
+    EXPECT_EQ( 1, value.load() );
+    EXPECT_TRUE( counter.isDone() );
+
+    unsigned int sum = 0;
+    system.parallelFor( 100, 10, [&sum]( unsigned int start,
+                                         unsigned int end ) {
+        for ( ; start < end; ++start )
+        {
+            sum += start;
+        }
+    } );
+    EXPECT_EQ( 4950, sum );
+}
+
+TEST( JobSystemTest, Jobs )
+{
+    using namespace StevensDev::sgdj;
+
+    JobSystem& system = JobSystem::inst();
+    std::atomic<unsigned int> value( 0 );
+    unsigned int workers;
+    unsigned int i;
+
+    for ( workers = 0; workers < 4; ++workers )
+    {
+        system.initialize( workers );
+
+        EXPECT_TRUE( system.isRunning() );
+        EXPECT_TRUE( system.isWorker() );
+        EXPECT_EQ( workers, system.workers() );
+
+        // more jobs than fit in a deque
+        Job* jobs = new Job[5000];
+        JobCounter counter( 5000 );
+
+        value = 0;
+        for ( i = 0; i < 5000; ++i )
+        {
+            jobs[i].function = &increment;
+            jobs[i].data = &value;
+            jobs[i].counter = &counter;
+        }
+
+        system.run( jobs, 5000 );
+        system.wait( counter );
+
+        EXPECT_EQ( 5000, value.load() );
+
+        delete[] jobs;
+
+        system.shutdown();
+        EXPECT_FALSE( system.isRunning() );
+    }
+}
+
+TEST( JobSystemTest, Dependencies )
+{
+    using namespace StevensDev::sgdj;
+
+    JobSystem& system = JobSystem::inst();
+    std::atomic<unsigned int> values[8];
+    Job dependencies[8][16];
+    Chain chains[8];
+    Job jobs[8];
+    JobCounter counter( 8 );
+    unsigned int i;
+
+    system.initialize( 3 );
+
+    // each job waits on jobs that it queued itself
+    for ( i = 0; i < 8; ++i )
+    {
+        values[i] = 0;
+
+        chains[i].jobs = dependencies[i];
+        chains[i].count = 16;
+        chains[i].value = &values[i];
+        chains[i].seen = 0;
+
+        jobs[i].function = &runChain;
+        jobs[i].data = &chains[i];
+        jobs[i].counter = &counter;
+    }
+
+    system.run( jobs, 8 );
+    system.wait( counter );
+
+    for ( i = 0; i < 8; ++i )
+    {
+        EXPECT_EQ( 16, chains[i].seen );
+    }
+
+    system.shutdown();
+}
+
+TEST( JobSystemTest, ParallelFor )
+{
+    using namespace StevensDev::sgdj;
+
+    JobSystem& system = JobSystem::inst();
+    unsigned int results[1000];
+    unsigned int i;
+
+    system.initialize( 3 );
+
+    for ( i = 0; i < 1000; ++i )
+    {
+        results[i] = 0;
+    }
+
+    system.parallelFor( 1000, 7, [&results]( unsigned int start,
+                                             unsigned int end ) {
+        for ( ; start < end; ++start )
+        {
+            results[start] += start * 2;
+        }
+    } );
+
+    // every index is visited exactly once
+    for ( i = 0; i < 1000; ++i )
+    {
+        EXPECT_EQ( i * 2, results[i] );
+    }
+
+    // nothing to do
+    system.parallelFor( 0, 7, [&results]( unsigned int start,
+                                          unsigned int end ) {
+        results[0] = 1;
+    } );
+    EXPECT_EQ( 0, results[0] );
+
+    system.shutdown();
+}
@@ -0,0 +1,127 @@
+// work_stealing_deque.t.cpp
+#include <atomic>
+#include <engine/jobs/work_stealing_deque.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+TEST( WorkStealingDequeTest, Construction )
+{
+    using namespace StevensDev::sgdj;
+
+    WorkStealingDeque deque;
+
+    EXPECT_EQ( WorkStealingDeque::DEFAULT_CAPACITY, deque.capacity() );
+    EXPECT_EQ( 0, deque.size() );
+
+    WorkStealingDeque sized( 4 );
+
+    EXPECT_EQ( 4, sized.capacity() );
+    EXPECT_EQ( nullptr, sized.pop() );
+    EXPECT_EQ( nullptr, sized.steal() );
+}
+
+TEST( WorkStealingDequeTest, Ordering )
+{
+    using namespace StevensDev::sgdj;
+
+    WorkStealingDeque deque( 4 );
+    Job jobs[5];
+    unsigned int i;
+
+    for ( i = 0; i < 4; ++i )
+    {
+        EXPECT_TRUE( deque.push( &jobs[i] ) );
+    }
+
+    // full
+    EXPECT_FALSE( deque.push( &jobs[4] ) );
+    EXPECT_EQ( 4, deque.size() );
+
+    // the owner takes the newest and thieves take the oldest
+    EXPECT_EQ( &jobs[3], deque.pop() );
+    EXPECT_EQ( &jobs[0], deque.steal() );
+    EXPECT_EQ( &jobs[1], deque.steal() );
+    EXPECT_EQ( &jobs[2], deque.pop() );
+    EXPECT_EQ( nullptr, deque.pop() );
+    EXPECT_EQ( nullptr, deque.steal() );
+
+    // wraps around the buffer
+    for ( i = 0; i < 4; ++i )
+    {
+        EXPECT_TRUE( deque.push( &jobs[i] ) );
+    }
+
+    EXPECT_EQ( &jobs[0], deque.steal() );
+    EXPECT_EQ( 3, deque.size() );
+}
+
+TEST( WorkStealingDequeTest, ConcurrentSteals )
+{
+    using namespace StevensDev::sgdj;
+
+    const unsigned int COUNT = 20000;
+    const unsigned int THIEVES = 3;
+
+    WorkStealingDeque deque( 256 );
+    Job* jobs = new Job[COUNT];
+    std::atomic<unsigned int>* taken = new std::atomic<unsigned int>[COUNT];
+    std::atomic<bool> done( false );
+    std::thread thieves[THIEVES];
+    unsigned int pushed = 0;
+    unsigned int i;
+    Job* job;
+
+    for ( i = 0; i < COUNT; ++i )
+    {
+        taken[i] = 0;
+    }
+
+    for ( i = 0; i < THIEVES; ++i )
+    {
+        thieves[i] = std::thread( [&]() {
+            Job* stolen;
+            while ( !done.load() || deque.size() > 0 )
+            {
+                stolen = deque.steal();
+                if ( stolen != nullptr )
+                {
+                    ++taken[stolen - jobs];
+                }
+            }
+        } );
+    }
+
+    // the owner pushes everything and pops some of it back
+    while ( pushed < COUNT )
+    {
+        if ( deque.push( &jobs[pushed] ) )
+        {
+            ++pushed;
+        }
+
+        if ( pushed % 3 == 0 && ( job = deque.pop() ) != nullptr )
+        {
+            ++taken[job - jobs];
+        }
+    }
+
+    while ( ( job = deque.pop() ) != nullptr )
+    {
+        ++taken[job - jobs];
+    }
+
+    done = true;
+    for ( i = 0; i < THIEVES; ++i )
+    {
+        thieves[i].join();
+    }
+
+    // every job is taken exactly once
+    for ( i = 0; i < COUNT; ++i )
+    {
+        EXPECT_EQ( 1, taken[i].load() );
+    }
+
+    delete[] taken;
+    delete[] jobs;
+}
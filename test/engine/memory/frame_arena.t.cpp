@@ -0,0 +1,108 @@
+// frame_arena.t.cpp
+#include <engine/memory/frame_arena.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+namespace
+{
+
+class Logged
+{
+  private:
+    std::string* d_log;
+    char d_name;
+
+  public:
+    Logged( std::string* log, char name ) : d_log( log ), d_name( name ) {}
+
+    ~Logged() { *d_log += d_name; }
+
+    char name() const { return d_name; }
+};
+
+} // End nspc anonymous
+
+TEST( FrameArenaTest, Allocation )
+{
+    using namespace StevensDev::sgdm;
+
+    FrameArena arena( 64 );
+
+    EXPECT_EQ( 0, arena.capacity() );
+    EXPECT_EQ( 0, arena.used() );
+
+    char* first = static_cast<char*>( arena.allocate( 1, 1 ) );
+    double* second = static_cast<double*>(
+        arena.allocate( sizeof( double ), alignof( double ) ) );
+
+    EXPECT_EQ( 64, arena.capacity() );
+    EXPECT_EQ( 0, reinterpret_cast<std::size_t>( second ) %
+                  alignof( double ) );
+    EXPECT_LT( static_cast<void*>( first ), static_cast<void*>( second ) );
+    EXPECT_EQ( sizeof( double ) * 2, arena.used() );
+
+    // full blocks are followed by new ones and large requests get their own
+    arena.allocate( 60, 1 );
+    arena.allocate( 200, 1 );
+
+    EXPECT_EQ( 64 + 64 + 200, arena.capacity() );
+
+    unsigned int used = arena.used();
+
+    // resetting keeps every block so the same frame allocates nothing new
+    arena.reset();
+
+    EXPECT_EQ( 0, arena.used() );
+    EXPECT_EQ( used, arena.highWater() );
+    EXPECT_EQ( first, arena.allocate( 1, 1 ) );
+
+    arena.allocate( sizeof( double ), alignof( double ) );
+    arena.allocate( 60, 1 );
+    arena.allocate( 200, 1 );
+
+    EXPECT_EQ( 64 + 64 + 200, arena.capacity() );
+}
+
+TEST( FrameArenaTest, Objects )
+{
+    using namespace StevensDev::sgdm;
+
+    std::string log;
+
+    {
+        FrameArena arena;
+
+        Logged* a = arena.create<Logged>( &log, 'a' );
+        Logged* b = arena.create<Logged>( &log, 'b' );
+        int* value = arena.create<int>( 7 );
+
+        EXPECT_EQ( 'a', a->name() );
+        EXPECT_EQ( 'b', b->name() );
+        EXPECT_EQ( 7, *value );
+
+        // objects are destructed newest first
+        arena.reset();
+
+        EXPECT_EQ( "ba", log );
+
+        arena.create<Logged>( &log, 'c' );
+    }
+
+    // and the rest when the arena is destructed
+    EXPECT_EQ( "bac", log );
+}
+
+TEST( FrameArenaTest, Print )
+{
+    using namespace StevensDev::sgdm;
+
+    FrameArena arena( 16 );
+    std::ostringstream stream;
+
+    arena.allocate( 4, 4 );
+    stream << arena;
+
+    EXPECT_EQ( "{ \"used\": 4, \"highWater\": 4, \"capacity\": 16 }",
+               stream.str() );
+}
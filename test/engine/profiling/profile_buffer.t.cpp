@@ -0,0 +1,115 @@
+// profile_buffer.t.cpp
+#include <engine/profiling/profile_buffer.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+
+TEST( ProfileBufferTest, Construction )
+{
+    using namespace StevensDev::sgdp;
+
+    ProfileBuffer buffer( 3 );
+
+    EXPECT_EQ( 3, buffer.thread() );
+    EXPECT_EQ( ProfileBuffer::DEFAULT_CAPACITY, buffer.capacity() );
+    EXPECT_EQ( 0, buffer.size() );
+    EXPECT_EQ( 0, buffer.dropped() );
+
+    ProfileBuffer small( 0, 4 );
+
+    EXPECT_EQ( 4, small.capacity() );
+}
+
+TEST( ProfileBufferTest, PushAndDrain )
+{
+    using namespace StevensDev::sgdp;
+    using namespace StevensDev::sgdc;
+
+    ProfileBuffer buffer( 2, 4 );
+    DynamicArray<ProfileSample> samples;
+    unsigned int i;
+
+    EXPECT_TRUE( buffer.push( "a", 10, 20, 0 ) );
+    EXPECT_TRUE( buffer.push( "b", 12, 18, 1 ) );
+    EXPECT_EQ( 2, buffer.size() );
+
+    EXPECT_EQ( 2, buffer.drain( samples ) );
+    EXPECT_EQ( 0, buffer.size() );
+    ASSERT_EQ( 2, samples.size() );
+    EXPECT_STREQ( "a", samples[0].name );
+    EXPECT_EQ( 10, samples[0].start );
+    EXPECT_EQ( 20, samples[0].end );
+    EXPECT_EQ( 0, samples[0].depth );
+    EXPECT_EQ( 2, samples[0].thread );
+    EXPECT_STREQ( "b", samples[1].name );
+    EXPECT_EQ( 1, samples[1].depth );
+
+    // a full ring drops instead of overwriting
+    for ( i = 0; i < 6; ++i )
+    {
+        EXPECT_EQ( i < 4, buffer.push( "c", i, i + 1, 0 ) );
+    }
+
+    EXPECT_EQ( 2, buffer.dropped() );
+    EXPECT_EQ( 4, buffer.drain( samples ) );
+    EXPECT_EQ( 6, samples.size() );
+    EXPECT_EQ( 3, samples[5].start );
+
+    // draining makes room again
+    EXPECT_TRUE( buffer.push( "d", 0, 1, 0 ) );
+    EXPECT_EQ( 0, buffer.drain( samples ) - 1 );
+}
+
+TEST( ProfileBufferTest, Concurrent )
+{
+    using namespace StevensDev::sgdp;
+    using namespace StevensDev::sgdc;
+
+    const unsigned int COUNT = 100000;
+
+    ProfileBuffer buffer( 1, 256 );
+    DynamicArray<ProfileSample> samples;
+    unsigned long long pushed = 0;
+    unsigned int i;
+
+    std::thread producer( [&]()
+    {
+        unsigned int j;
+
+        for ( j = 0; j < COUNT; ++j )
+        {
+            pushed += buffer.push( "z", j, j, 0 ) ? 1 : 0;
+        }
+    } );
+
+    while ( samples.size() + buffer.dropped() < COUNT )
+    {
+        buffer.drain( samples );
+    }
+
+    producer.join();
+    buffer.drain( samples );
+
+    EXPECT_EQ( pushed, samples.size() );
+    EXPECT_EQ( COUNT, samples.size() + buffer.dropped() );
+
+    // samples arrive in the order they were recorded
+    for ( i = 1; i < samples.size(); ++i )
+    {
+        EXPECT_LT( samples[i - 1].start, samples[i].start );
+    }
+}
+
+TEST( ProfileBufferTest, Print )
+{
+    using namespace StevensDev::sgdp;
+
+    ProfileBuffer buffer( 1, 8 );
+    std::ostringstream oss;
+
+    buffer.push( "a", 0, 1, 0 );
+    oss << buffer;
+
+    EXPECT_STREQ( "{ \"thread\": 1, \"size\": 1, \"capacity\": 8, "
+                  "\"dropped\": 0 }", oss.str().c_str() );
+}
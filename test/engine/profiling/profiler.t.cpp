@@ -0,0 +1,146 @@
+// profiler.t.cpp
+#include <engine/profiling/profile_scope.h>
+#include <engine/profiling/profiler.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+
+TEST( ProfilerTest, Capture )
+{
+    using namespace StevensDev::sgdp;
+
+    Profiler& profiler = Profiler::inst();
+
+    // nothing is recorded outside a capture
+    {
+        ProfileScope scope( "ignored" );
+    }
+
+    profiler.start();
+
+    EXPECT_TRUE( profiler.isCapturing() );
+    EXPECT_EQ( 0, profiler.size() );
+
+    {
+        ProfileScope outer( "outer" );
+
+        {
+            ProfileScope inner( "inner" );
+        }
+    }
+
+    profiler.stop();
+
+    EXPECT_FALSE( profiler.isCapturing() );
+    ASSERT_EQ( 2, profiler.size() );
+
+    // zones are recorded as they close
+    ProfileSample inner = profiler.sample( 0 );
+    ProfileSample outer = profiler.sample( 1 );
+
+    EXPECT_STREQ( "inner", inner.name );
+    EXPECT_STREQ( "outer", outer.name );
+    EXPECT_EQ( 1, inner.depth );
+    EXPECT_EQ( 0, outer.depth );
+    EXPECT_EQ( inner.thread, outer.thread );
+    EXPECT_LE( outer.start, inner.start );
+    EXPECT_LE( inner.start, inner.end );
+    EXPECT_LE( inner.end, outer.end );
+
+    {
+        ProfileScope late( "late" );
+    }
+
+    profiler.collect();
+
+    EXPECT_EQ( 2, profiler.size() );
+    EXPECT_GE( profiler.threads(), 1 );
+}
+
+TEST( ProfilerTest, Threads )
+{
+    using namespace StevensDev::sgdp;
+
+    Profiler& profiler = Profiler::inst();
+    unsigned int i;
+
+    profiler.start();
+
+    std::thread first( []() { ProfileScope scope( "first" ); } );
+    std::thread second( []() { ProfileScope scope( "second" ); } );
+
+    first.join();
+    second.join();
+
+    profiler.stop();
+
+    ASSERT_EQ( 2, profiler.size() );
+    EXPECT_NE( profiler.sample( 0 ).thread, profiler.sample( 1 ).thread );
+
+    for ( i = 0; i < profiler.size(); ++i )
+    {
+        EXPECT_EQ( 0, profiler.sample( i ).depth );
+    }
+}
+
+TEST( ProfilerTest, Macro )
+{
+    using namespace StevensDev::sgdp;
+
+    Profiler& profiler = Profiler::inst();
+
+    profiler.start();
+
+    {
+        PROFILE_SCOPE( "macro" );
+        PROFILE_SCOPE( "nested" );
+    }
+
+    profiler.stop();
+
+#ifdef GAME_PROFILE
+    EXPECT_EQ( 2, profiler.size() );
+#else
+    // release builds compile the zones out
+    EXPECT_EQ( 0, profiler.size() );
+#endif
+}
+
+TEST( ProfilerTest, ChromeTrace )
+{
+    using namespace StevensDev::sgdp;
+
+    Profiler& profiler = Profiler::inst();
+    std::ostringstream oss;
+    std::string trace;
+
+    profiler.start();
+
+    {
+        ProfileScope scope( "quoted \"zone\"" );
+    }
+
+    profiler.stop();
+    profiler.writeChromeTrace( oss );
+    trace = oss.str();
+
+    EXPECT_EQ( 0, trace.find( "{\"traceEvents\":[" ) );
+    EXPECT_NE( std::string::npos,
+               trace.find( "\"name\":\"quoted \\\"zone\\\"\"" ) );
+    EXPECT_NE( std::string::npos, trace.find( "\"ph\":\"X\"" ) );
+    EXPECT_NE( std::string::npos, trace.find( "\"ts\":" ) );
+    EXPECT_NE( std::string::npos, trace.find( "\"dur\":" ) );
+    EXPECT_NE( std::string::npos,
+               trace.find( "],\"displayTimeUnit\":\"ns\"}" ) );
+
+    // an empty capture is still a valid trace
+    std::ostringstream empty;
+
+    profiler.start();
+    profiler.stop();
+    profiler.writeChromeTrace( empty );
+
+    EXPECT_STREQ( "{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}\n",
+                  empty.str().c_str() );
+}
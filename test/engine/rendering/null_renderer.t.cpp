@@ -0,0 +1,65 @@
+// null_renderer.t.cpp
+#include <engine/rendering/null_renderer.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST( NullRendererTest, Construction )
+{
+    using namespace StevensDev::sgdr;
+
+    NullRenderer renderer;
+    NullRenderer sized( 800, 600 );
+    NullRenderer copy( sized );
+
+    EXPECT_TRUE( renderer.isActive() );
+    EXPECT_EQ( 0, renderer.width() );
+    EXPECT_EQ( 0, renderer.frames() );
+    EXPECT_EQ( 800, copy.width() );
+    EXPECT_EQ( 600, copy.height() );
+
+    renderer = copy;
+
+    EXPECT_EQ( 800, renderer.width() );
+}
+
+TEST( NullRendererTest, Drawing )
+{
+    using namespace StevensDev::sgdr;
+
+    NullRenderer renderer;
+    IRenderer& base = renderer;
+    const RenderableSprite* sprite =
+        reinterpret_cast<const RenderableSprite*>( &renderer );
+
+    base.addSprite( sprite );
+
+    EXPECT_EQ( 1, renderer.sprites() );
+
+    base.draw( 0.5f );
+    base.draw( 0.25f );
+
+    EXPECT_EQ( 2, renderer.frames() );
+    EXPECT_EQ( 0.25f, renderer.interpolation() );
+
+    base.removeSprite( sprite );
+
+    EXPECT_EQ( 0, renderer.sprites() );
+
+    renderer.close();
+
+    EXPECT_FALSE( base.isActive() );
+}
+
+TEST( NullRendererTest, Print )
+{
+    using namespace StevensDev::sgdr;
+
+    NullRenderer renderer;
+    std::ostringstream oss;
+
+    renderer.draw( 1.0f );
+    oss << renderer;
+
+    EXPECT_STREQ( "{ \"isActive\": true, \"frames\": 1 }",
+                  oss.str().c_str() );
+}
@@ -39,6 +39,25 @@ TEST( RendererTest, WindowCreationAndDrawing )
     EXPECT_NO_FATAL_FAILURE( renderer.draw() );
 }
 
+TEST( RendererTest, Pacing )
+{
+    using namespace StevensDev::sgdr;
+
+    Renderer renderer;
+
+    EXPECT_EQ( Renderer::DEFAULT_FRAMERATE_LIMIT, renderer.framerateLimit() );
+    EXPECT_EQ( 1.0f, renderer.interpolation() );
+
+    renderer.setFramerateLimit( 0 );
+
+    EXPECT_EQ( 0, renderer.framerateLimit() );
+
+    renderer.setupWindow( 200, 200 );
+    renderer.draw( 0.25f );
+
+    EXPECT_EQ( 0.25f, renderer.interpolation() );
+}
+
 TEST( RendererTest, TextureLoading )
 {
     using namespace StevensDev::sgdr;
@@ -0,0 +1,176 @@
+// frame_log.t.cpp
+#include <engine/replay/frame_log.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST( FrameLogTest, Construction )
+{
+    using namespace StevensDev::sgdl;
+
+    FrameLog log( 4 );
+    FrameLog copy( log );
+
+    EXPECT_EQ( 4, log.inputCount() );
+    EXPECT_EQ( 0, log.frames() );
+    EXPECT_EQ( 4, copy.inputCount() );
+
+    copy = FrameLog();
+
+    EXPECT_EQ( 0, copy.inputCount() );
+}
+
+TEST( FrameLogTest, Recording )
+{
+    using namespace StevensDev::sgdl;
+
+    FrameLog log( 4 );
+    bool isDown[4] = { false, true, false, true };
+    bool replayed[4] = { false, false, false, false };
+
+    log.addPoll( isDown );
+    log.addEvent( "hit" );
+    log.addEvent( "score" );
+    log.endFrame( 0.25f );
+
+    // a frame may take several steps or none at all
+    isDown[1] = false;
+    log.addPoll( isDown );
+    log.addPoll( isDown );
+    log.addEvent( "hit" );
+    log.endFrame( 0.5f );
+    log.endFrame( 0.125f );
+
+    ASSERT_EQ( 3, log.frames() );
+    EXPECT_EQ( 0.25f, log.dt( 0 ) );
+    EXPECT_EQ( 1, log.polls( 0 ) );
+    EXPECT_EQ( 2, log.events( 0 ) );
+    EXPECT_STREQ( "score", log.event( 0, 1 ).c_str() );
+    EXPECT_EQ( 2, log.polls( 1 ) );
+    EXPECT_STREQ( "hit", log.event( 1, 0 ).c_str() );
+    EXPECT_EQ( 0, log.polls( 2 ) );
+    EXPECT_EQ( 0, log.events( 2 ) );
+
+    log.applyPoll( 0, 0, replayed );
+
+    EXPECT_FALSE( replayed[0] );
+    EXPECT_TRUE( replayed[1] );
+    EXPECT_TRUE( replayed[3] );
+
+    log.applyPoll( 1, 0, replayed );
+    log.applyPoll( 1, 1, replayed );
+
+    EXPECT_FALSE( replayed[1] );
+    EXPECT_TRUE( replayed[3] );
+
+    log.clear();
+
+    EXPECT_EQ( 0, log.frames() );
+    EXPECT_EQ( 4, log.inputCount() );
+}
+
+TEST( FrameLogTest, Serialization )
+{
+    using namespace StevensDev::sgdl;
+
+    const unsigned int COUNT = 300;
+
+    FrameLog log( COUNT );
+    FrameLog read;
+    bool isDown[COUNT];
+    bool replayed[COUNT];
+    std::stringstream stream;
+    unsigned int i;
+    unsigned int j;
+
+    for ( i = 0; i < COUNT; ++i )
+    {
+        isDown[i] = false;
+        replayed[i] = false;
+    }
+
+    for ( i = 0; i < 50; ++i )
+    {
+        isDown[( i * 7 ) % COUNT] = !isDown[( i * 7 ) % COUNT];
+        isDown[299] = i % 3 == 0;
+        log.addPoll( isDown );
+        if ( i % 5 == 0 )
+        {
+            log.addEvent( i % 2 == 0 ? "even" : "odd" );
+        }
+        log.endFrame( 0.01f * i );
+    }
+
+    log.write( stream );
+
+    // idle frames take only a few bytes
+    EXPECT_LT( stream.str().size(), 50 * 16 );
+
+    ASSERT_TRUE( read.read( stream ) );
+    ASSERT_EQ( COUNT, read.inputCount() );
+    ASSERT_EQ( 50, read.frames() );
+
+    for ( i = 0; i < 50; ++i )
+    {
+        EXPECT_EQ( log.dt( i ), read.dt( i ) );
+        ASSERT_EQ( 1, read.polls( i ) );
+        ASSERT_EQ( log.events( i ), read.events( i ) );
+        if ( read.events( i ) > 0 )
+        {
+            EXPECT_EQ( log.event( i, 0 ), read.event( i, 0 ) );
+        }
+        read.applyPoll( i, 0, replayed );
+    }
+
+    for ( j = 0; j < COUNT; ++j )
+    {
+        EXPECT_EQ( isDown[j], replayed[j] );
+    }
+}
+
+TEST( FrameLogTest, Corruption )
+{
+    using namespace StevensDev::sgdl;
+
+    FrameLog log( 2 );
+    FrameLog read( 2 );
+    bool isDown[2] = { true, false };
+    std::stringstream bad( "GREC" );
+    std::stringstream truncated;
+    std::stringstream inputs( std::string( "GREC\x01"
+                                           "\xff\xff\xff\xff\x0f" ) );
+    std::stringstream type( std::string( "GREC\x01\x02\x01"
+                                         "\xff\xff\xff\xff\x0f" ) );
+    std::string bytes;
+
+    EXPECT_FALSE( read.read( bad ) );
+    EXPECT_EQ( 0, read.inputCount() );
+
+    log.addPoll( isDown );
+    log.addEvent( "hit" );
+    log.endFrame( 0.5f );
+    log.write( truncated );
+
+    bytes = truncated.str();
+    truncated.str( bytes.substr( 0, bytes.size() - 1 ) );
+
+    EXPECT_FALSE( read.read( truncated ) );
+    EXPECT_EQ( 0, read.frames() );
+
+    // sizes too large to allocate are rejected instead of thrown
+    EXPECT_FALSE( read.read( inputs ) );
+    EXPECT_FALSE( read.read( type ) );
+    EXPECT_EQ( 0, read.inputCount() );
+}
+
+TEST( FrameLogTest, Print )
+{
+    using namespace StevensDev::sgdl;
+
+    FrameLog log( 3 );
+    std::ostringstream oss;
+
+    log.endFrame( 0.1f );
+    oss << log;
+
+    EXPECT_STREQ( "{ \"inputs\": 3, \"frames\": 1 }", oss.str().c_str() );
+}
@@ -0,0 +1,62 @@
+// recorder.t.cpp
+#include <engine/events/event_dispatcher.h>
+#include <engine/events/test_event.h>
+#include <engine/input/scripted_input.h>
+#include <engine/replay/recorder.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST( RecorderTest, Recording )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdi;
+    using namespace StevensDev::sgdl;
+    using namespace StevensDev::sgdt;
+
+    ScriptedInput script;
+    FrameLog log( 8 );
+    Recorder recorder( &script, &log );
+    EventDispatcher dispatcher;
+    TestEvent event( "fired" );
+    bool isDown[8];
+    bool replayed[8] = { false };
+
+    script.tap( 1, 3, 2 );
+    dispatcher.setObserver( recorder.observer() );
+
+    // what passes through is what the source gave
+    recorder.poll( isDown, 8 );
+    recorder.endFrame( 0.1f );
+    recorder.poll( isDown, 8 );
+    dispatcher.dispatch( &event );
+    recorder.endFrame( 0.2f );
+
+    EXPECT_TRUE( isDown[3] );
+
+    ASSERT_EQ( 2, log.frames() );
+    EXPECT_EQ( 0, log.events( 0 ) );
+    ASSERT_EQ( 1, log.events( 1 ) );
+    EXPECT_STREQ( "fired", log.event( 1, 0 ).c_str() );
+    EXPECT_EQ( 0.2f, log.dt( 1 ) );
+
+    log.applyPoll( 0, 0, replayed );
+    EXPECT_FALSE( replayed[3] );
+    log.applyPoll( 1, 0, replayed );
+    EXPECT_TRUE( replayed[3] );
+}
+
+TEST( RecorderTest, Print )
+{
+    using namespace StevensDev::sgdi;
+    using namespace StevensDev::sgdl;
+
+    ScriptedInput script;
+    FrameLog log( 2 );
+    Recorder recorder( &script, &log );
+    std::ostringstream oss;
+
+    oss << recorder;
+
+    EXPECT_STREQ( "{ \"log\": { \"inputs\": 2, \"frames\": 0 } }",
+                  oss.str().c_str() );
+}
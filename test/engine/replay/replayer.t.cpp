@@ -0,0 +1,152 @@
+// replayer.t.cpp
+#include <engine/events/event_dispatcher.h>
+#include <engine/events/test_event.h>
+#include <engine/input/scripted_input.h>
+#include <engine/replay/recorder.h>
+#include <engine/replay/replayer.h>
+#include <engine/scene/scene.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace
+{
+
+class PollingTickable : public StevensDev::sgds::ITickable
+{
+  private:
+    StevensDev::sgdi::IInputSource* d_source;
+      // Where input is polled from.
+
+    StevensDev::sgde::EventDispatcher* d_dispatcher;
+      // Where events are dispatched.
+
+    StevensDev::sgdt::TestEvent d_event;
+      // The event dispatched while the first input is down.
+
+    bool d_isDown[2];
+      // The input states of the last poll.
+
+  public:
+    bool isExtra;
+      // If an extra event is dispatched on every tick.
+
+    PollingTickable( StevensDev::sgdi::IInputSource* source,
+                     StevensDev::sgde::EventDispatcher* dispatcher )
+        : d_source( source ), d_dispatcher( dispatcher ),
+          d_event( "pressed" ), isExtra( false )
+    {
+    }
+
+    void setSource( StevensDev::sgdi::IInputSource* source )
+    {
+        d_source = source;
+    }
+
+    virtual void preTick()
+    {
+        d_source->poll( d_isDown, 2 );
+    }
+
+    virtual void tick( float dtS )
+    {
+        if ( d_isDown[0] || isExtra )
+        {
+            d_dispatcher->dispatch( &d_event );
+        }
+    }
+
+    virtual void postTick()
+    {
+    }
+};
+
+} // End nspc anonymous
+
+TEST( ReplayerTest, Replaying )
+{
+    using namespace StevensDev::sgde;
+    using namespace StevensDev::sgdi;
+    using namespace StevensDev::sgdl;
+    using namespace StevensDev::sgds;
+
+    Scene& scene = Scene::inst();
+
+    ScriptedInput script;
+    FrameLog log( 2 );
+    Recorder recorder( &script, &log );
+    EventDispatcher dispatcher;
+    PollingTickable tickable( &recorder, &dispatcher );
+    std::stringstream stream;
+    FrameLog read;
+    unsigned int i;
+
+    scene.setStep( 0 );
+    scene.setRenderer( nullptr );
+    scene.addTickable( &tickable );
+
+    // record a few frames where the first input is held for a while
+    script.tap( 2, 0, 3 );
+    dispatcher.setObserver( recorder.observer() );
+    for ( i = 0; i < 8; ++i )
+    {
+        scene.tick( 0.01f * ( i + 1 ) );
+        recorder.endFrame( 0.01f * ( i + 1 ) );
+    }
+
+    ASSERT_EQ( 8, log.frames() );
+    EXPECT_EQ( 0, log.events( 1 ) );
+    EXPECT_EQ( 3, log.events( 2 ) + log.events( 3 ) + log.events( 4 ) );
+    EXPECT_EQ( 0, log.events( 5 ) );
+
+    log.write( stream );
+    ASSERT_TRUE( read.read( stream ) );
+
+    // playing it back produces the same events
+    Replayer replayer( &read );
+
+    tickable.setSource( &replayer );
+    dispatcher.setObserver( replayer.observer() );
+    replayer.run( scene );
+
+    EXPECT_TRUE( replayer.isFinished() );
+    EXPECT_EQ( 8, replayer.frame() );
+    EXPECT_EQ( 0, replayer.divergences() );
+    EXPECT_LE( replayer.min(), replayer.mean() );
+    EXPECT_LE( replayer.mean(), replayer.max() );
+    EXPECT_LE( replayer.percentile( 0.5 ), replayer.max() );
+    EXPECT_GE( replayer.total(), replayer.max() );
+    EXPECT_FALSE( replayer.tick( scene ) );
+
+    // changing the game is noticed on the frames that it changes
+    replayer.rewind();
+    tickable.isExtra = true;
+    replayer.run( scene );
+
+    EXPECT_EQ( 5, replayer.divergences() );
+
+    scene.removeTickable( &tickable );
+    scene.tick( 0 );
+}
+
+TEST( ReplayerTest, Report )
+{
+    using namespace StevensDev::sgdl;
+
+    FrameLog log( 1 );
+    Replayer replayer( &log );
+    std::ostringstream summary;
+    std::ostringstream report;
+
+    summary << replayer;
+    replayer.writeReport( report );
+
+    EXPECT_EQ( 0, replayer.mean() );
+    EXPECT_EQ( 0, replayer.percentile( 0.99 ) );
+    EXPECT_STREQ( "{ \"frames\": 0, \"divergences\": 0, \"totalMs\": 0, "
+                  "\"minMs\": 0, \"meanMs\": 0, \"p99Ms\": 0, "
+                  "\"maxMs\": 0 }",
+                  summary.str().c_str() );
+    EXPECT_STREQ( ( "{ \"summary\": " + summary.str() +
+                    ", \"frameMs\": [ ] }" ).c_str(),
+                  report.str().c_str() );
+}
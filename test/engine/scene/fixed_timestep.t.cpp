@@ -0,0 +1,105 @@
+// fixed_timestep.t.cpp
+#include <engine/scene/fixed_timestep.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST( FixedTimestepTest, Construction )
+{
+    using namespace StevensDev::sgds;
+
+    FixedTimestep variable;
+
+    EXPECT_FALSE( variable.isFixed() );
+    EXPECT_EQ( 0.0f, variable.step() );
+    EXPECT_EQ( FixedTimestep::DEFAULT_MAX_STEPS, variable.maxSteps() );
+    EXPECT_EQ( 1.0f, variable.alpha() );
+
+    FixedTimestep fixed( 0.25f, 3 );
+
+    EXPECT_TRUE( fixed.isFixed() );
+    EXPECT_EQ( 0.25f, fixed.step() );
+    EXPECT_EQ( 0.25f, fixed.dt() );
+    EXPECT_EQ( 3, fixed.maxSteps() );
+    EXPECT_EQ( 0.0f, fixed.alpha() );
+
+    fixed.advance( 0.125f );
+
+    FixedTimestep copy( fixed );
+
+    EXPECT_EQ( 0.25f, copy.step() );
+    EXPECT_EQ( 0.125f, copy.accumulated() );
+
+    variable = fixed;
+
+    EXPECT_TRUE( variable.isFixed() );
+    EXPECT_EQ( 0.5f, variable.alpha() );
+}
+
+TEST( FixedTimestepTest, Variable )
+{
+    using namespace StevensDev::sgds;
+
+    FixedTimestep timestep;
+
+    EXPECT_EQ( 1, timestep.advance( 0.5f ) );
+    EXPECT_EQ( 0.5f, timestep.dt() );
+    EXPECT_EQ( 1, timestep.advance( 0.0f ) );
+    EXPECT_EQ( 0.0f, timestep.dt() );
+    EXPECT_EQ( 0.0f, timestep.accumulated() );
+}
+
+TEST( FixedTimestepTest, Fixed )
+{
+    using namespace StevensDev::sgds;
+
+    FixedTimestep timestep( 0.25f, 4 );
+
+    // accumulates partial steps
+    EXPECT_EQ( 0, timestep.advance( 0.125f ) );
+    EXPECT_EQ( 0.5f, timestep.alpha() );
+    EXPECT_EQ( 1, timestep.advance( 0.125f ) );
+    EXPECT_EQ( 0.0f, timestep.alpha() );
+
+    // takes every whole step that is owed
+    EXPECT_EQ( 3, timestep.advance( 0.875f ) );
+    EXPECT_EQ( 0.25f, timestep.dt() );
+    EXPECT_EQ( 0.5f, timestep.alpha() );
+
+    // drops whole steps beyond the catch-up limit but keeps the remainder
+    EXPECT_EQ( 4, timestep.advance( 2.0f ) );
+    EXPECT_EQ( 0.5f, timestep.alpha() );
+    EXPECT_LT( timestep.accumulated(), timestep.step() );
+
+    timestep.setMaxSteps( 1 );
+
+    EXPECT_EQ( 1, timestep.advance( 1.0f ) );
+    EXPECT_EQ( 0.5f, timestep.alpha() );
+
+    timestep.reset();
+
+    EXPECT_EQ( 0.0f, timestep.accumulated() );
+
+    timestep.setStep( 0.5f );
+    timestep.setMaxSteps( 4 );
+
+    EXPECT_EQ( 0.5f, timestep.step() );
+    EXPECT_EQ( 2, timestep.advance( 1.0f ) );
+
+    timestep.setStep( 0.0f );
+
+    EXPECT_FALSE( timestep.isFixed() );
+    EXPECT_EQ( 1, timestep.advance( 1.0f ) );
+}
+
+TEST( FixedTimestepTest, Print )
+{
+    using namespace StevensDev::sgds;
+
+    FixedTimestep timestep( 0.5f, 2 );
+    std::ostringstream oss;
+
+    oss << timestep;
+
+    EXPECT_STREQ( "{ \"step\": 0.5, \"maxSteps\": 2, \"accumulated\": 0 }",
+                  oss.str().c_str() );
+}
@@ -0,0 +1,99 @@
+// hierarchical_grid.b.cpp
+#include <chrono>
+#include <engine/scene/hierarchical_grid.h>
+#include <engine/scene/nxn_scene_graph.h>
+#include <engine/scene/test_collider.h>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <random>
+
+namespace
+{
+
+const float SIZE = 100.0f;
+  // The width and height of the benchmarked spaces.
+
+const unsigned int DIVISIONS = 32;
+  // The number of divisions in the finest grid.
+
+const unsigned int COLLIDERS = 10000;
+  // The number of colliders that are inserted.
+
+const unsigned int QUERIES = 5000;
+  // The number of queries that are timed.
+
+void generate( StevensDev::sgdt::TestCollider* colliders )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    // mostly small colliders with a long tail of large ones
+    std::minstd_rand random( 585 );
+    std::uniform_real_distribution<float> position( 0.0f, SIZE );
+    std::exponential_distribution<float> extent( 0.5f );
+
+    unsigned int i;
+    for ( i = 0; i < COLLIDERS; ++i )
+    {
+        colliders[i] = TestCollider( RectangleBounds(
+            position( random ), position( random ),
+            0.1f + extent( random ), 0.1f + extent( random ) ) );
+    }
+}
+
+template <typename Index>
+void run( const char* name, Index& index,
+          StevensDev::sgdt::TestCollider* colliders )
+{
+    using namespace StevensDev::sgds;
+
+    unsigned long long found = 0;
+    unsigned int i;
+
+    auto start = std::chrono::steady_clock::now();
+    for ( i = 0; i < COLLIDERS; ++i )
+    {
+        index.addCollider( &colliders[i] );
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double insert = std::chrono::duration<double, std::micro>( end - start )
+        .count();
+
+    std::minstd_rand random( 1337 );
+    std::uniform_real_distribution<float> position( 0.0f, SIZE );
+
+    start = std::chrono::steady_clock::now();
+    for ( i = 0; i < QUERIES; ++i )
+    {
+        found += index.find( position( random ), position( random ),
+                             5.0f, 5.0f ).size();
+    }
+    end = std::chrono::steady_clock::now();
+
+    double query = std::chrono::duration<double, std::micro>( end - start )
+        .count();
+
+    std::cout << name << ": " << ( insert / COLLIDERS ) << " us/insert, "
+              << ( query / QUERIES ) << " us/query, "
+              << ( double( found ) / QUERIES ) << " hits/query" << std::endl;
+}
+
+} // End nspc anonymous
+
+TEST( HierarchicalGridBenchmark, VariableSizes )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    TestCollider* colliders = new TestCollider[COLLIDERS];
+    generate( colliders );
+
+    NxNSceneGraph graph( SIZE, DIVISIONS );
+    run( "NxNSceneGraph", graph, colliders );
+
+    HierarchicalGrid grid( SIZE, DIVISIONS );
+    run( "HierarchicalGrid", grid, colliders );
+
+    delete[] colliders;
+}
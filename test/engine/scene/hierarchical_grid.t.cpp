@@ -0,0 +1,258 @@
+// hierarchical_grid.t.cpp
+#include <engine/scene/hierarchical_grid.h>
+#include <engine/scene/test_collider.h>
+#include <gtest/gtest.h>
+
+TEST( HierarchicalGridTest, Construction )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    HierarchicalGrid grid;
+
+    EXPECT_EQ( 5, grid.levels() );
+    EXPECT_EQ( 16, grid.divisions( 0 ) );
+    EXPECT_EQ( 1, grid.divisions( 4 ) );
+
+    // uneven divisions are rounded up
+    HierarchicalGrid sized( 10.0f, 10 );
+
+    ASSERT_EQ( 5, sized.levels() );
+    EXPECT_EQ( 10, sized.divisions( 0 ) );
+    EXPECT_EQ( 5, sized.divisions( 1 ) );
+    EXPECT_EQ( 3, sized.divisions( 2 ) );
+    EXPECT_EQ( 2, sized.divisions( 3 ) );
+    EXPECT_EQ( 1, sized.divisions( 4 ) );
+
+    TestCollider collider( RectangleBounds( 1.0f, 1.0f, 0.5f, 0.5f ) );
+    sized.addCollider( &collider );
+
+    HierarchicalGrid copy( sized );
+
+    EXPECT_EQ( 1, copy.colliders( 0 ) );
+    EXPECT_EQ( 1, copy.find( 1.0f, 1.0f, 1.0f, 1.0f ).size() );
+
+    grid = copy;
+
+    EXPECT_EQ( 5, grid.levels() );
+    EXPECT_EQ( 1, grid.find( 1.0f, 1.0f, 1.0f, 1.0f ).size() );
+}
+
+TEST( HierarchicalGridTest, ColliderManagement )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    HierarchicalGrid grid( 16.0f, 16 );
+
+    TestCollider small( RectangleBounds( 1.0f, 1.0f, 0.5f, 0.5f ) );
+    TestCollider medium( RectangleBounds( 1.0f, 1.0f, 3.0f, 1.0f ) );
+    TestCollider large( RectangleBounds( -4.0f, 2.0f, 30.0f, 4.0f ) );
+
+    // each collider is stored once at the level that fits its size
+    grid.addCollider( &small );
+    grid.addCollider( &medium );
+    grid.addCollider( &large );
+
+    EXPECT_EQ( 1, grid.colliders( 0 ) );
+    EXPECT_EQ( 0, grid.colliders( 1 ) );
+    EXPECT_EQ( 1, grid.colliders( 2 ) );
+    EXPECT_EQ( 0, grid.colliders( 3 ) );
+    EXPECT_EQ( 1, grid.colliders( 4 ) );
+
+    grid.removeCollider( &medium );
+    EXPECT_EQ( 0, grid.colliders( 2 ) );
+
+    // moved colliders are still found and removed
+    small = TestCollider( RectangleBounds( 9.0f, 9.0f, 0.5f, 0.5f ) );
+    grid.removeCollider( &small );
+    EXPECT_EQ( 0, grid.colliders( 0 ) );
+
+    grid.removeCollider( &large );
+    EXPECT_EQ( 0, grid.colliders( 4 ) );
+}
+
+TEST( HierarchicalGridTest, CollisionDetection )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+
+    HierarchicalGrid grid( 10.0f, 16 );
+    TestCollider colliders[300];
+    unsigned int i;
+    unsigned int j;
+    unsigned int k;
+    unsigned int expected;
+
+    // a mix of sizes lands on every level
+    for ( i = 0; i < 300; ++i )
+    {
+        colliders[i] = TestCollider(
+            RectangleBounds( ( i * 37 % 100 ) * 0.1f - 0.5f,
+                             ( i * 53 % 100 ) * 0.1f - 0.5f,
+                             0.05f + ( i % 11 ) * ( i % 11 ) * 0.08f,
+                             0.05f + ( i % 5 ) * 0.3f ), i % 3 );
+        grid.addCollider( &colliders[i] );
+    }
+
+    // matches a brute force search without duplicates
+    for ( i = 0; i < 50; ++i )
+    {
+        RectangleBounds query( ( i * 7 % 10 ) * 1.0f, ( i * 3 % 10 ) * 1.0f,
+                               ( i % 4 ) * 0.7f, ( i % 3 ) * 0.9f );
+        unsigned short flags = i % 3;
+        DynamicArray<ICollider*> results = grid.find( query, flags );
+
+        expected = 0;
+        for ( j = 0; j < 300; ++j )
+        {
+            if ( !colliders[j].canCollide( flags ) ||
+                 !colliders[j].bounds().doesCollide( query ) )
+            {
+                continue;
+            }
+
+            ++expected;
+
+            unsigned int found = 0;
+            for ( k = 0; k < results.size(); ++k )
+            {
+                found += results[k] == &colliders[j];
+            }
+
+            EXPECT_EQ( 1, found );
+        }
+
+        EXPECT_EQ( expected, results.size() );
+    }
+}
+
+TEST( HierarchicalGridTest, OutOfBounds )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+
+    HierarchicalGrid grid( 10.0f, 16 );
+    TestCollider corner( RectangleBounds( 9.5f, 9.5f, 2.0f, 2.0f ) );
+    TestCollider origin( RectangleBounds( -1.0f, -1.0f, 2.0f, 2.0f ) );
+    DynamicArray<ICollider*> results;
+
+    grid.addCollider( &corner );
+    grid.addCollider( &origin );
+
+    // far beyond the range of a cell index
+    results = grid.find( RectangleBounds( 1e20f, 1e20f, 1.0f, 1.0f ) );
+    EXPECT_EQ( 0, results.size() );
+
+    results = grid.find( RectangleBounds( 9.0f, 9.0f, 1e20f, 1e20f ) );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &corner, results[0] );
+
+    results = grid.find( RectangleBounds( -1e20f, -1e20f, 1e20f, 1e20f ) );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &origin, results[0] );
+}
+
+TEST( HierarchicalGridTest, PreciseColliders )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    HierarchicalGrid grid( 10.0f, 10 );
+    TestCollider collider( RectangleBounds( 1.0f, 1.0f, 1.0f, 1.0f ) );
+
+    grid.addCollider( &collider );
+
+    grid.find( 0.0f, 0.0f, 5.0f, 5.0f );
+    EXPECT_EQ( 0, collider.checks() );
+
+    collider.setPrecise( true );
+    grid.removeCollider( &collider );
+    grid.addCollider( &collider );
+
+    grid.find( 0.0f, 0.0f, 5.0f, 5.0f );
+    EXPECT_EQ( 1, collider.checks() );
+}
+
+TEST( HierarchicalGridTest, Nearest )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+
+    HierarchicalGrid grid( 10.0f, 16 );
+    TestCollider close( RectangleBounds( 5.5f, 5.0f, 0.2f, 0.2f ), 1 );
+    TestCollider middle( RectangleBounds( 3.0f, 5.0f, 0.2f, 0.2f ), 2 );
+    TestCollider spanning( RectangleBounds( 0.5f, 8.0f, 9.0f, 1.0f ), 1 );
+
+    grid.addCollider( &close );
+    grid.addCollider( &middle );
+    grid.addCollider( &spanning );
+
+    DynamicArray<ICollider*> results = grid.nearest( 5.0f, 5.0f, 10 );
+    ASSERT_EQ( 3, results.size() );
+    EXPECT_EQ( &close, results[0] );
+    EXPECT_EQ( &middle, results[1] );
+    EXPECT_EQ( &spanning, results[2] );
+
+    results = grid.nearest( 5.0f, 5.0f, 2, 1 );
+    ASSERT_EQ( 2, results.size() );
+    EXPECT_EQ( &close, results[0] );
+    EXPECT_EQ( &spanning, results[1] );
+
+    EXPECT_EQ( 0, grid.nearest( 5.0f, 5.0f, 0 ).size() );
+
+    // matches a brute force search
+    TestCollider colliders[200];
+    unsigned int i;
+    unsigned int j;
+
+    grid = HierarchicalGrid( 10.0f, 16 );
+    for ( i = 0; i < 200; ++i )
+    {
+        colliders[i] = TestCollider(
+            RectangleBounds( ( i * 37 % 100 ) * 0.1f, ( i * 53 % 100 ) * 0.1f,
+                             0.1f + ( i % 7 ) * ( i % 7 ) * 0.2f, 0.1f ) );
+        grid.addCollider( &colliders[i] );
+    }
+
+    results = grid.nearest( 2.5f, 7.5f, 10 );
+    ASSERT_EQ( 10, results.size() );
+
+    float previous = 0.0f;
+    for ( i = 0; i < results.size(); ++i )
+    {
+        const RectangleBounds& b = results[i]->bounds();
+        float dx = std::max( 0.0f, std::max( b.left() - 2.5f,
+                                             2.5f - b.right() ) );
+        float dy = std::max( 0.0f, std::max( b.top() - 7.5f,
+                                             7.5f - b.bottom() ) );
+        float distance = dx * dx + dy * dy;
+
+        EXPECT_LE( previous, distance );
+        previous = distance;
+    }
+
+    // nothing left out is closer than the farthest result
+    for ( j = 0; j < 200; ++j )
+    {
+        const RectangleBounds& b = colliders[j].bounds();
+        float dx = std::max( 0.0f, std::max( b.left() - 2.5f,
+                                             2.5f - b.right() ) );
+        float dy = std::max( 0.0f, std::max( b.top() - 7.5f,
+                                             7.5f - b.bottom() ) );
+
+        if ( dx * dx + dy * dy < previous )
+        {
+            bool found = false;
+            for ( i = 0; i < results.size(); ++i )
+            {
+                found = found || results[i] == &colliders[j];
+            }
+
+            EXPECT_TRUE( found );
+        }
+    }
+}
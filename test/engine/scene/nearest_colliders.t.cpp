@@ -0,0 +1,77 @@
+// nearest_colliders.t.cpp
+#include <engine/scene/nearest_colliders.h>
+#include <engine/scene/test_collider.h>
+#include <gtest/gtest.h>
+
+TEST( NearestCollidersTest, Construction )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    NearestColliders nearest( 3 );
+
+    EXPECT_EQ( 0, nearest.size() );
+    EXPECT_EQ( 3, nearest.capacity() );
+    EXPECT_FALSE( nearest.isFull() );
+
+    TestCollider collider;
+    nearest.offer( &collider, 1.0f );
+
+    NearestColliders copy( nearest );
+
+    EXPECT_EQ( 1, copy.size() );
+    EXPECT_TRUE( copy.contains( &collider ) );
+
+    nearest = NearestColliders( 0 );
+
+    EXPECT_EQ( 0, nearest.capacity() );
+    EXPECT_FALSE( nearest.offer( &collider, 1.0f ) );
+    EXPECT_EQ( 0, nearest.sorted().size() );
+
+    nearest = copy;
+
+    EXPECT_EQ( 1, nearest.size() );
+    EXPECT_FLOAT_EQ( 1.0f, nearest.farthest() );
+}
+
+TEST( NearestCollidersTest, Offer )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+
+    NearestColliders nearest( 3 );
+    TestCollider colliders[6];
+    float distances[] = { 5.0f, 1.0f, 4.0f, 3.0f, 6.0f, 2.0f };
+    unsigned int i;
+
+    for ( i = 0; i < 3; ++i )
+    {
+        EXPECT_TRUE( nearest.offer( &colliders[i], distances[i] ) );
+    }
+
+    EXPECT_TRUE( nearest.isFull() );
+    EXPECT_FLOAT_EQ( 5.0f, nearest.farthest() );
+
+    // replaces the farthest
+    EXPECT_TRUE( nearest.offer( &colliders[3], distances[3] ) );
+    EXPECT_FLOAT_EQ( 4.0f, nearest.farthest() );
+    EXPECT_FALSE( nearest.contains( &colliders[0] ) );
+
+    // farther than everything kept
+    EXPECT_FALSE( nearest.offer( &colliders[4], distances[4] ) );
+    EXPECT_FALSE( nearest.contains( &colliders[4] ) );
+
+    EXPECT_TRUE( nearest.offer( &colliders[5], distances[5] ) );
+    EXPECT_FLOAT_EQ( 3.0f, nearest.farthest() );
+
+    DynamicArray<ICollider*> sorted = nearest.sorted();
+    ASSERT_EQ( 3, sorted.size() );
+    EXPECT_EQ( &colliders[1], sorted[0] );
+    EXPECT_EQ( &colliders[5], sorted[1] );
+    EXPECT_EQ( &colliders[3], sorted[2] );
+
+    // sorting does not change the heap
+    EXPECT_EQ( 3, nearest.size() );
+    EXPECT_FLOAT_EQ( 3.0f, nearest.farthest() );
+}
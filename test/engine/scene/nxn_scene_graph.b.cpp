@@ -0,0 +1,236 @@
+// nxn_scene_graph.b.cpp
+#include <chrono>
+#include <cmath>
+#include <engine/jobs/job_system.h>
+#include <engine/scene/nxn_scene_graph.h>
+#include <engine/scene/test_collider.h>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <random>
+#include <thread>
+
+namespace
+{
+
+const float SIZE = 100.0f;
+  // The width and height of the benchmarked graph.
+
+const unsigned int DIVISIONS = 25;
+  // The number of divisions in the benchmarked graph.
+
+const unsigned int COLLIDERS = 10000;
+  // The number of colliders in the benchmarked graph.
+
+const unsigned int QUERIES = 5000;
+  // The number of queries that are timed.
+
+void populate( StevensDev::sgdt::TestCollider* colliders,
+               StevensDev::sgds::NxNSceneGraph& graph )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    // fixed seed so each run measures the same scene
+    std::minstd_rand random( 585 );
+    std::uniform_real_distribution<float> position( 0.0f, SIZE );
+    std::uniform_real_distribution<float> extent( 0.1f, 2.0f );
+
+    unsigned int i;
+    for ( i = 0; i < COLLIDERS; ++i )
+    {
+        colliders[i] = TestCollider( RectangleBounds( position( random ),
+                                                      position( random ),
+                                                      extent( random ),
+                                                      extent( random ) ) );
+        graph.addCollider( &colliders[i] );
+    }
+}
+
+} // End nspc anonymous
+
+TEST( NxNSceneGraphBenchmark, Find )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+
+    NxNSceneGraph graph( SIZE, DIVISIONS );
+    TestCollider* colliders = new TestCollider[COLLIDERS];
+    populate( colliders, graph );
+
+    std::minstd_rand random( 1337 );
+    std::uniform_real_distribution<float> position( 0.0f, SIZE );
+
+    unsigned long long found = 0;
+    unsigned int i;
+
+    auto start = std::chrono::steady_clock::now();
+    for ( i = 0; i < QUERIES; ++i )
+    {
+        found += graph.find( position( random ), position( random ),
+                             5.0f, 5.0f ).size();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double us = std::chrono::duration<double, std::micro>( end - start )
+        .count();
+
+    std::cout << "NxNSceneGraph::find: " << ( us / QUERIES )
+              << " us/query, " << ( double( found ) / QUERIES )
+              << " hits/query" << std::endl;
+
+    EXPECT_GT( found, 0u );
+
+    delete[] colliders;
+}
+
+TEST( NxNSceneGraphBenchmark, FindBatch )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+
+    NxNSceneGraph graph( SIZE, DIVISIONS );
+    TestCollider* colliders = new TestCollider[COLLIDERS];
+    populate( colliders, graph );
+
+    std::minstd_rand random( 1337 );
+    std::uniform_real_distribution<float> position( 0.0f, SIZE );
+
+    DynamicArray<NxNSceneGraph::Query> queries;
+    DynamicArray<DynamicArray<ICollider*>> results;
+    unsigned int i;
+
+    for ( i = 0; i < QUERIES; ++i )
+    {
+        NxNSceneGraph::Query query;
+        query.bounds = RectangleBounds( position( random ),
+                                        position( random ), 5.0f, 5.0f );
+        query.flags = 0;
+        queries.push( query );
+    }
+
+    // the calling thread is a worker too
+    unsigned int workers;
+    for ( workers = 1; workers <= std::thread::hardware_concurrency();
+          workers *= 2 )
+    {
+        StevensDev::sgdj::JobSystem::inst().initialize( workers - 1 );
+
+        auto start = std::chrono::steady_clock::now();
+        graph.findBatch( queries, results );
+        auto end = std::chrono::steady_clock::now();
+
+        StevensDev::sgdj::JobSystem::inst().shutdown();
+
+        double us = std::chrono::duration<double, std::micro>( end - start )
+            .count();
+
+        std::cout << "NxNSceneGraph::findBatch (" << workers << " workers): "
+                  << ( us / QUERIES ) << " us/query" << std::endl;
+
+        EXPECT_EQ( QUERIES, results.size() );
+    }
+
+    delete[] colliders;
+}
+
+TEST( NxNSceneGraphBenchmark, Raycast )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+    using gel::math::Vec2;
+
+    NxNSceneGraph graph( SIZE, DIVISIONS );
+    TestCollider* colliders = new TestCollider[COLLIDERS];
+    populate( colliders, graph );
+
+    std::minstd_rand random( 1337 );
+    std::uniform_real_distribution<float> position( 0.0f, SIZE );
+    std::uniform_real_distribution<float> angle( 0.0f, 6.2831853f );
+
+    unsigned long long candidates = 0;
+    unsigned int hits = 0;
+    unsigned int i;
+    float theta;
+
+    auto start = std::chrono::steady_clock::now();
+    for ( i = 0; i < QUERIES; ++i )
+    {
+        theta = angle( random );
+        NxNSceneGraph::RayHit hit = graph.raycast(
+            Vec2( position( random ), position( random ) ),
+            Vec2( std::cos( theta ), std::sin( theta ) ), SIZE, 0 );
+
+        hits += hit.collider != nullptr;
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double us = std::chrono::duration<double, std::micro>( end - start )
+        .count();
+
+    std::cout << "NxNSceneGraph::raycast: " << ( us / QUERIES )
+              << " us/query, " << ( double( hits ) / QUERIES )
+              << " hits/query" << std::endl;
+
+    // the same rays answered by over-querying their bounding rectangles
+    random.seed( 1337 );
+    start = std::chrono::steady_clock::now();
+    for ( i = 0; i < QUERIES; ++i )
+    {
+        theta = angle( random );
+        float x = position( random );
+        float y = position( random );
+        float dx = std::cos( theta ) * SIZE;
+        float dy = std::sin( theta ) * SIZE;
+
+        candidates += graph.find( std::min( x, x + dx ), std::min( y, y + dy ),
+                                  std::abs( dx ), std::abs( dy ) ).size();
+    }
+    end = std::chrono::steady_clock::now();
+
+    us = std::chrono::duration<double, std::micro>( end - start ).count();
+
+    std::cout << "NxNSceneGraph::find (ray bounds): " << ( us / QUERIES )
+              << " us/query, " << ( double( candidates ) / QUERIES )
+              << " candidates/query" << std::endl;
+
+    EXPECT_GT( hits, 0u );
+
+    delete[] colliders;
+}
+
+TEST( NxNSceneGraphBenchmark, Nearest )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    NxNSceneGraph graph( SIZE, DIVISIONS );
+    TestCollider* colliders = new TestCollider[COLLIDERS];
+    populate( colliders, graph );
+
+    std::minstd_rand random( 1337 );
+    std::uniform_real_distribution<float> position( 0.0f, SIZE );
+
+    unsigned long long found = 0;
+    unsigned int i;
+
+    auto start = std::chrono::steady_clock::now();
+    for ( i = 0; i < QUERIES; ++i )
+    {
+        found += graph.nearest( position( random ), position( random ),
+                                8 ).size();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double us = std::chrono::duration<double, std::micro>( end - start )
+        .count();
+
+    std::cout << "NxNSceneGraph::nearest (k = 8): " << ( us / QUERIES )
+              << " us/query" << std::endl;
+
+    EXPECT_EQ( QUERIES * 8ull, found );
+
+    delete[] colliders;
+}
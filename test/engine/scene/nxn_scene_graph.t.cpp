@@ -1,4 +1,5 @@
 // nxn_scene_graph.t.cpp
+#include <engine/jobs/job_system.h>
 #include <engine/scene/nxn_scene_graph.h>
 #include <engine/scene/test_collider.h>
 #include <gtest/gtest.h>
@@ -68,6 +69,457 @@ TEST( NxNSceneGraphTest, CollisionDetection )
 
     results = graph.find( ra, 1 );
     EXPECT_EQ( 0, results.size() );
-    
+
     graph.removeCollider( &a );
-}
\ No newline at end of file
+}
+
+TEST( NxNSceneGraphTest, SpanningColliders )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+
+    NxNSceneGraph graph( 10.0f, 10 );
+
+    // spans many cells but must only be reported once
+    TestCollider large( RectangleBounds( 0.5f, 0.5f, 8.0f, 8.0f ) );
+    TestCollider small( RectangleBounds( 4.2f, 4.2f, 0.5f, 0.5f ) );
+
+    DynamicArray<ICollider*> results;
+
+    graph.addCollider( &large );
+    graph.addCollider( &small );
+
+    results = graph.find( 0.0f, 0.0f, 10.0f, 10.0f );
+    EXPECT_EQ( 2, results.size() );
+
+    results = graph.find( 3.0f, 3.0f, 4.0f, 4.0f );
+    EXPECT_EQ( 2, results.size() );
+
+    results = graph.find( 8.0f, 8.0f, 1.0f, 1.0f );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &large, results[0] );
+
+    graph.removeCollider( &large );
+
+    results = graph.find( 0.0f, 0.0f, 10.0f, 10.0f );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &small, results[0] );
+}
+
+TEST( NxNSceneGraphTest, OutOfBounds )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+    using gel::math::Vec2;
+
+    NxNSceneGraph graph( 10.0f, 10 );
+    NxNSceneGraph::RayHit hit;
+
+    // partially outside of the graph on every side
+    TestCollider corner( RectangleBounds( 9.5f, 9.5f, 2.0f, 2.0f ) );
+    TestCollider origin( RectangleBounds( -1.0f, -1.0f, 2.0f, 2.0f ) );
+
+    DynamicArray<ICollider*> results;
+
+    graph.addCollider( &corner );
+    graph.addCollider( &origin );
+
+    results = graph.find( 9.0f, 9.0f, 5.0f, 5.0f );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &corner, results[0] );
+
+    results = graph.find( -5.0f, -5.0f, 5.5f, 5.5f );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &origin, results[0] );
+
+    results = graph.find( 20.0f, 20.0f, 1.0f, 1.0f );
+    EXPECT_EQ( 0, results.size() );
+
+    // far beyond the range of a cell index
+    results = graph.find( 1e20f, 1e20f, 1.0f, 1.0f );
+    EXPECT_EQ( 0, results.size() );
+
+    results = graph.find( 9.0f, 9.0f, 1e20f, 1e20f );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &corner, results[0] );
+
+    results = graph.find( -1e20f, -1e20f, 1e20f, 1e20f );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &origin, results[0] );
+
+    results = graph.nearest( 1e10f, 1e10f, 1 );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &corner, results[0] );
+
+    // rays and segments that never enter the graph still hit the parts of
+    // colliders outside of it
+    hit = graph.raycast( Vec2( 12.0f, 10.5f ), Vec2( -1.0f, 0.0f ), 100.0f,
+                         0 );
+    EXPECT_EQ( &corner, hit.collider );
+    EXPECT_FLOAT_EQ( 0.5f, hit.distance );
+
+    hit = graph.raycast( Vec2( -0.5f, -5.0f ), Vec2( 0.0f, 1.0f ), 100.0f,
+                         0 );
+    EXPECT_EQ( &origin, hit.collider );
+    EXPECT_FLOAT_EQ( 4.0f, hit.distance );
+
+    hit = graph.raycast( Vec2( 20.0f, 20.0f ), Vec2( 1.0f, 1.0f ), 100.0f,
+                         0 );
+    EXPECT_EQ( nullptr, hit.collider );
+
+    results = graph.segmentQuery( Vec2( -5.0f, -0.5f ),
+                                  Vec2( 15.0f, -0.5f ) );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &origin, results[0] );
+}
+
+TEST( NxNSceneGraphTest, PreciseColliders )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+
+    NxNSceneGraph graph( 10.0f, 10 );
+
+    TestCollider simple( RectangleBounds( 1.0f, 1.0f, 1.0f, 1.0f ) );
+    TestCollider precise( RectangleBounds( 1.0f, 1.0f, 1.0f, 1.0f ) );
+    precise.setPrecise( true );
+
+    DynamicArray<ICollider*> results;
+
+    graph.addCollider( &simple );
+    graph.addCollider( &precise );
+
+    results = graph.find( 0.0f, 0.0f, 5.0f, 5.0f );
+    EXPECT_EQ( 2, results.size() );
+
+    // only precise colliders are asked to confirm the overlap
+    EXPECT_EQ( 0, simple.checks() );
+    EXPECT_EQ( 1, precise.checks() );
+
+    // neither is asked when the bounds do not overlap
+    results = graph.find( 5.0f, 5.0f, 1.0f, 1.0f );
+    EXPECT_EQ( 0, results.size() );
+    EXPECT_EQ( 1, precise.checks() );
+}
+
+TEST( NxNSceneGraphTest, BatchQueries )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+
+    NxNSceneGraph graph( 10.0f, 10 );
+    TestCollider colliders[100];
+    unsigned int i;
+    unsigned int j;
+
+    for ( i = 0; i < 100; ++i )
+    {
+        colliders[i] = TestCollider(
+            RectangleBounds( ( i % 10 ) * 1.0f, ( i / 10 ) * 1.0f,
+                             0.5f, 0.5f ), i % 2 );
+        graph.addCollider( &colliders[i] );
+    }
+
+    DynamicArray<NxNSceneGraph::Query> queries;
+    for ( i = 0; i < 500; ++i )
+    {
+        NxNSceneGraph::Query query;
+        query.bounds = RectangleBounds( ( i % 9 ) * 1.1f, ( i % 7 ) * 1.3f,
+                                        2.0f, 2.0f );
+        query.flags = i % 2;
+        queries.push( query );
+    }
+
+    DynamicArray<DynamicArray<ICollider*>> results;
+
+    // results match individual queries regardless of worker count
+    unsigned int workers[] = { 0, 1, 3, 7 };
+    for ( j = 0; j <= 4; ++j )
+    {
+        // the last pass runs without the job system
+        if ( j < 4 )
+        {
+            StevensDev::sgdj::JobSystem::inst().initialize( workers[j] );
+        }
+
+        graph.findBatch( queries, results );
+
+        if ( j < 4 )
+        {
+            StevensDev::sgdj::JobSystem::inst().shutdown();
+        }
+
+        ASSERT_EQ( queries.size(), results.size() );
+        for ( i = 0; i < queries.size(); ++i )
+        {
+            DynamicArray<ICollider*> expected =
+                graph.find( queries[i].bounds, queries[i].flags );
+
+            ASSERT_EQ( expected.size(), results[i].size() );
+            unsigned int k;
+            for ( k = 0; k < expected.size(); ++k )
+            {
+                EXPECT_EQ( expected[k], results[i][k] );
+            }
+        }
+    }
+
+    // empty batches produce no results
+    graph.findBatch( DynamicArray<NxNSceneGraph::Query>(), results );
+    EXPECT_EQ( 0, results.size() );
+}
+
+TEST( NxNSceneGraphTest, Raycast )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using gel::math::Vec2;
+
+    NxNSceneGraph graph( 10.0f, 10 );
+    TestCollider near( RectangleBounds( 3.5f, 4.5f, 1.0f, 1.0f ), 1 );
+    TestCollider far( RectangleBounds( 7.5f, 4.0f, 2.0f, 2.0f ), 1 );
+    TestCollider other( RectangleBounds( 1.5f, 4.5f, 1.0f, 1.0f ), 2 );
+
+    graph.addCollider( &near );
+    graph.addCollider( &far );
+    graph.addCollider( &other );
+
+    // first hit along the ray with matching flags
+    NxNSceneGraph::RayHit hit = graph.raycast( Vec2( 0.0f, 5.0f ),
+                                               Vec2( 1.0f, 0.0f ), 100.0f, 1 );
+    EXPECT_EQ( &near, hit.collider );
+    EXPECT_FLOAT_EQ( 3.5f, hit.distance );
+
+    // without flags the first collider along the ray is hit
+    hit = graph.raycast( Vec2( 0.0f, 5.0f ), Vec2( 2.0f, 0.0f ), 100.0f, 0 );
+    EXPECT_EQ( &other, hit.collider );
+    EXPECT_FLOAT_EQ( 1.5f, hit.distance );
+
+    // reversed direction
+    hit = graph.raycast( Vec2( 10.0f, 5.0f ), Vec2( -1.0f, 0.0f ), 100.0f, 1 );
+    EXPECT_EQ( &far, hit.collider );
+    EXPECT_FLOAT_EQ( 0.5f, hit.distance );
+
+    // too short to reach anything
+    hit = graph.raycast( Vec2( 0.0f, 5.0f ), Vec2( 1.0f, 0.0f ), 1.0f, 0 );
+    EXPECT_EQ( nullptr, hit.collider );
+
+    // misses everything
+    hit = graph.raycast( Vec2( 0.0f, 1.0f ), Vec2( 1.0f, 0.0f ), 100.0f, 0 );
+    EXPECT_EQ( nullptr, hit.collider );
+
+    // diagonal from outside of the graph
+    hit = graph.raycast( Vec2( -1.0f, -1.0f ), Vec2( 1.0f, 1.0f ), 100.0f, 1 );
+    EXPECT_EQ( &near, hit.collider );
+    EXPECT_FLOAT_EQ( 5.5f * std::sqrt( 2.0f ), hit.distance );
+
+    // starting inside a collider
+    hit = graph.raycast( Vec2( 8.0f, 5.0f ), Vec2( 0.0f, 1.0f ), 100.0f, 1 );
+    EXPECT_EQ( &far, hit.collider );
+    EXPECT_FLOAT_EQ( 0.0f, hit.distance );
+}
+
+TEST( NxNSceneGraphTest, SegmentQuery )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+    using gel::math::Vec2;
+
+    NxNSceneGraph graph( 10.0f, 10 );
+    TestCollider small( RectangleBounds( 1.5f, 1.5f, 0.5f, 0.5f ) );
+    TestCollider large( RectangleBounds( 4.2f, 0.5f, 3.5f, 8.0f ) );
+    TestCollider corner( RectangleBounds( 8.5f, 1.0f, 1.0f, 1.0f ) );
+
+    graph.addCollider( &small );
+    graph.addCollider( &large );
+    graph.addCollider( &corner );
+
+    // spanning colliders are only reported once in order along the segment
+    DynamicArray<ICollider*> results =
+        graph.segmentQuery( Vec2( 0.0f, 0.0f ), Vec2( 9.0f, 9.0f ) );
+    ASSERT_EQ( 2, results.size() );
+    EXPECT_EQ( &small, results[0] );
+    EXPECT_EQ( &large, results[1] );
+
+    results = graph.segmentQuery( Vec2( 9.0f, 9.0f ), Vec2( 0.0f, 0.0f ) );
+    ASSERT_EQ( 2, results.size() );
+    EXPECT_EQ( &large, results[0] );
+    EXPECT_EQ( &small, results[1] );
+
+    // segment ends before reaching the large collider
+    results = graph.segmentQuery( Vec2( 0.0f, 0.0f ), Vec2( 3.0f, 3.0f ) );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &small, results[0] );
+
+    // horizontal segment along a row
+    results = graph.segmentQuery( Vec2( 0.0f, 1.8f ), Vec2( 10.0f, 1.8f ) );
+    EXPECT_EQ( 3, results.size() );
+
+    // the bounding rectangle of the segment overlaps the corner collider
+    // but the segment does not
+    results = graph.segmentQuery( Vec2( 7.0f, 0.0f ), Vec2( 9.0f, 4.0f ) );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &large, results[0] );
+
+    // the segment crosses the cell the thin collider starts in before it
+    // reaches the collider itself, which it only hits in the next cell
+    TestCollider thin( RectangleBounds( 0.9f, 0.0f, 0.6f, 0.1f ) );
+    NxNSceneGraph coarse( 10.0f, 10 );
+
+    coarse.addCollider( &thin );
+
+    results = coarse.segmentQuery( Vec2( 0.0f, 0.5f ), Vec2( 2.0f, -0.1f ) );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &thin, results[0] );
+    EXPECT_EQ( &thin, coarse.raycast( Vec2( 0.0f, 0.5f ),
+                                      Vec2( 2.0f, -0.6f ), 100.0f,
+                                      0 ).collider );
+
+    // a collider on the cell edges is reported once by a segment through
+    // the cell corners
+    TestCollider aligned( RectangleBounds( 2.0f, 2.0f, 2.0f, 2.0f ) );
+
+    coarse.addCollider( &aligned );
+
+    results = coarse.segmentQuery( Vec2( 1.0f, 1.0f ), Vec2( 6.0f, 6.0f ) );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &aligned, results[0] );
+
+    results = coarse.segmentQuery( Vec2( 6.0f, 6.0f ), Vec2( 1.0f, 1.0f ) );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &aligned, results[0] );
+}
+
+TEST( NxNSceneGraphTest, CircleQuery )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+    using gel::math::Vec2;
+
+    NxNSceneGraph graph( 10.0f, 10 );
+    TestCollider inside( RectangleBounds( 4.5f, 4.5f, 1.0f, 1.0f ), 1 );
+    TestCollider edge( RectangleBounds( 5.0f, 7.5f, 1.0f, 1.0f ), 2 );
+    TestCollider corner( RectangleBounds( 7.5f, 7.5f, 1.0f, 1.0f ), 1 );
+    TestCollider spanning( RectangleBounds( 0.5f, 2.5f, 9.0f, 0.5f ), 1 );
+
+    graph.addCollider( &inside );
+    graph.addCollider( &edge );
+    graph.addCollider( &corner );
+    graph.addCollider( &spanning );
+
+    // corner is inside of the circle's bounds but outside of the circle
+    DynamicArray<ICollider*> results =
+        graph.circleQuery( Vec2( 5.0f, 5.0f ), 3.0f );
+    ASSERT_EQ( 3, results.size() );
+    EXPECT_NE( &corner, results[0] );
+    EXPECT_NE( &corner, results[1] );
+    EXPECT_NE( &corner, results[2] );
+
+    results = graph.circleQuery( Vec2( 5.0f, 5.0f ), 3.0f, 2 );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &edge, results[0] );
+
+    results = graph.circleQuery( Vec2( 5.0f, 5.0f ), 3.6f );
+    EXPECT_EQ( 4, results.size() );
+}
+
+TEST( NxNSceneGraphTest, Nearest )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+
+    NxNSceneGraph graph( 10.0f, 10 );
+    TestCollider close( RectangleBounds( 5.5f, 5.0f, 0.2f, 0.2f ), 1 );
+    TestCollider middle( RectangleBounds( 3.0f, 5.0f, 0.2f, 0.2f ), 2 );
+    TestCollider spanning( RectangleBounds( 0.5f, 8.0f, 9.0f, 1.0f ), 1 );
+    TestCollider distant( RectangleBounds( 9.5f, 0.5f, 0.2f, 0.2f ), 1 );
+
+    graph.addCollider( &close );
+    graph.addCollider( &middle );
+    graph.addCollider( &spanning );
+    graph.addCollider( &distant );
+
+    DynamicArray<ICollider*> results = graph.nearest( 5.0f, 5.0f, 2 );
+    ASSERT_EQ( 2, results.size() );
+    EXPECT_EQ( &close, results[0] );
+    EXPECT_EQ( &middle, results[1] );
+
+    // spanning colliders are only reported once
+    results = graph.nearest( 5.0f, 5.0f, 10 );
+    ASSERT_EQ( 4, results.size() );
+    EXPECT_EQ( &close, results[0] );
+    EXPECT_EQ( &middle, results[1] );
+    EXPECT_EQ( &spanning, results[2] );
+    EXPECT_EQ( &distant, results[3] );
+
+    results = graph.nearest( 5.0f, 5.0f, 2, 1 );
+    ASSERT_EQ( 2, results.size() );
+    EXPECT_EQ( &close, results[0] );
+    EXPECT_EQ( &spanning, results[1] );
+
+    // points outside of the graph
+    results = graph.nearest( 20.0f, -5.0f, 1 );
+    ASSERT_EQ( 1, results.size() );
+    EXPECT_EQ( &distant, results[0] );
+
+    EXPECT_EQ( 0, graph.nearest( 5.0f, 5.0f, 0 ).size() );
+
+    // matches a brute force search
+    TestCollider colliders[200];
+    unsigned int i;
+    unsigned int j;
+
+    graph = NxNSceneGraph( 10.0f, 10 );
+    for ( i = 0; i < 200; ++i )
+    {
+        colliders[i] = TestCollider(
+            RectangleBounds( ( i * 37 % 100 ) * 0.1f, ( i * 53 % 100 ) * 0.1f,
+                             0.1f + ( i % 7 ) * 0.3f, 0.1f ) );
+        graph.addCollider( &colliders[i] );
+    }
+
+    results = graph.nearest( 2.5f, 7.5f, 10 );
+    ASSERT_EQ( 10, results.size() );
+
+    float previous = 0.0f;
+    for ( i = 0; i < results.size(); ++i )
+    {
+        const RectangleBounds& b = results[i]->bounds();
+        float dx = std::max( 0.0f, std::max( b.left() - 2.5f,
+                                             2.5f - b.right() ) );
+        float dy = std::max( 0.0f, std::max( b.top() - 7.5f,
+                                             7.5f - b.bottom() ) );
+        float distance = dx * dx + dy * dy;
+
+        EXPECT_LE( previous, distance );
+        previous = distance;
+    }
+
+    // nothing left out is closer than the farthest result
+    for ( j = 0; j < 200; ++j )
+    {
+        const RectangleBounds& b = colliders[j].bounds();
+        float dx = std::max( 0.0f, std::max( b.left() - 2.5f,
+                                             2.5f - b.right() ) );
+        float dy = std::max( 0.0f, std::max( b.top() - 7.5f,
+                                             7.5f - b.bottom() ) );
+
+        if ( dx * dx + dy * dy < previous )
+        {
+            bool found = false;
+            for ( i = 0; i < results.size(); ++i )
+            {
+                found = found || results[i] == &colliders[j];
+            }
+
+            EXPECT_TRUE( found );
+        }
+    }
+}
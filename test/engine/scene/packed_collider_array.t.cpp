@@ -0,0 +1,114 @@
+// packed_collider_array.t.cpp
+#include <engine/scene/packed_collider_array.h>
+#include <engine/scene/test_collider.h>
+#include <gtest/gtest.h>
+
+TEST( PackedColliderArrayTest, Construction )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    PackedColliderArray array;
+
+    EXPECT_EQ( 0, array.size() );
+
+    TestCollider collider;
+    array.push( &collider );
+
+    PackedColliderArray copy( array );
+
+    EXPECT_EQ( 1, copy.size() );
+    EXPECT_EQ( &collider, copy.collider( 0 ) );
+
+    array = PackedColliderArray();
+
+    EXPECT_EQ( 0, array.size() );
+
+    array = copy;
+
+    EXPECT_EQ( 1, array.size() );
+}
+
+TEST( PackedColliderArrayTest, Management )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    PackedColliderArray array;
+    TestCollider colliders[20];
+    unsigned int i;
+
+    // force the array to grow several times
+    for ( i = 0; i < 20; ++i )
+    {
+        colliders[i] = TestCollider( RectangleBounds( i, i * 2.0f, 1, 2 ) );
+        array.push( &colliders[i] );
+    }
+
+    EXPECT_EQ( 20, array.size() );
+
+    for ( i = 0; i < 20; ++i )
+    {
+        EXPECT_EQ( &colliders[i], array.collider( i ) );
+        EXPECT_FLOAT_EQ( i, array.left( i ) );
+        EXPECT_FLOAT_EQ( i * 2.0f, array.top( i ) );
+        EXPECT_FLOAT_EQ( i + 1.0f, array.right( i ) );
+        EXPECT_FLOAT_EQ( i * 2.0f + 2.0f, array.bottom( i ) );
+        EXPECT_FALSE( array.isPrecise( i ) );
+    }
+
+    // the last item fills the hole
+    EXPECT_TRUE( array.remove( &colliders[3] ) );
+    EXPECT_EQ( 19, array.size() );
+    EXPECT_EQ( &colliders[19], array.collider( 3 ) );
+    EXPECT_FLOAT_EQ( 19.0f, array.left( 3 ) );
+
+    EXPECT_FALSE( array.remove( &colliders[3] ) );
+    EXPECT_EQ( 19, array.size() );
+}
+
+TEST( PackedColliderArrayTest, Overlap )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    PackedColliderArray array;
+
+    TestCollider a( RectangleBounds( 0.0f, 0.0f, 1.0f, 1.0f ) );
+    TestCollider b( RectangleBounds( 2.0f, 0.0f, 1.0f, 1.0f ) );
+    TestCollider c( RectangleBounds( 0.0f, 2.0f, 1.0f, 1.0f ) );
+    TestCollider d( RectangleBounds( 0.5f, 0.5f, 2.0f, 2.0f ) );
+    TestCollider e( RectangleBounds( 1.0f, 1.0f, 0.5f, 0.5f ) );
+
+    array.push( &a );
+    array.push( &b );
+    array.push( &c );
+    array.push( &d );
+    array.push( &e );
+
+    EXPECT_EQ( 0x9u, array.overlapMask( 0, RectangleBounds( 0, 0, 1, 1 ) ) );
+    EXPECT_EQ( 0x1u, array.overlapMask( 4, RectangleBounds( 0, 0, 1, 1 ) ) );
+    EXPECT_EQ( 0xFu, array.overlapMask( 0, RectangleBounds( 0, 0, 3, 3 ) ) );
+    EXPECT_EQ( 0x0u, array.overlapMask( 0, RectangleBounds( 5, 5, 1, 1 ) ) );
+    EXPECT_EQ( 0x0u, array.overlapMask( 4, RectangleBounds( 5, 5, 1, 1 ) ) );
+
+    // the last item takes the place of a removed item
+    array.remove( &a );
+    EXPECT_EQ( 4, array.size() );
+    EXPECT_EQ( 0xFu, array.overlapMask( 0, RectangleBounds( 0, 0, 3, 3 ) ) );
+    EXPECT_EQ( 0x8u, array.overlapMask( 0, RectangleBounds( 0, 0, 0.6f,
+                                                            0.6f ) ) );
+}
+
+TEST( PackedColliderArrayTest, Print )
+{
+    using namespace StevensDev::sgds;
+
+    PackedColliderArray array;
+
+    std::ostringstream oss;
+
+    oss << array;
+
+    EXPECT_STREQ( "{ \"size\": 0 }", oss.str().c_str() );
+}
@@ -1,6 +1,6 @@
 // scene.t.cpp
 #include <engine/scene/scene.h>
-#include <engine/rendering/renderer.h>
+#include <engine/rendering/null_renderer.h>
 #include <engine/scene/test_tickable.h>
 #include <gtest/gtest.h>
 
@@ -39,6 +39,286 @@ TEST( SceneTest, Ticking )
     EXPECT_FALSE( tickable.wasPostTicked() );
 }
 
+TEST( SceneTest, ParallelTicking )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    Scene& scene = Scene::inst();
+
+    TestTickable reader;
+    TestTickable writer;
+
+    reader.setAccess( TickAccess().reads( 0 ) );
+    writer.setAccess( TickAccess().writes( 1 ) );
+
+    EXPECT_FALSE( scene.isParallel() );
+
+    scene.setParallel( true );
+    scene.addTickable( &reader );
+    scene.addTickable( &writer );
+
+    EXPECT_TRUE( scene.isParallel() );
+
+    scene.tick();
+
+    EXPECT_TRUE( reader.wasTicked() );
+    EXPECT_TRUE( writer.wasPostTicked() );
+
+    // removing a tickable rebuilds the schedule
+    scene.removeTickable( &writer );
+
+    reader.reset();
+    writer.reset();
+
+    scene.tick();
+
+    EXPECT_TRUE( reader.wasPreTicked() );
+    EXPECT_FALSE( writer.wasPreTicked() );
+
+    scene.removeTickable( &reader );
+    scene.setParallel( false );
+}
+
+TEST( SceneTest, FixedStep )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    Scene& scene = Scene::inst();
+
+    TestTickable tickable;
+
+    EXPECT_EQ( 0.0f, scene.step() );
+
+    scene.setStep( 0.1f );
+    scene.setMaxSteps( 4 );
+    scene.addTickable( &tickable );
+
+    EXPECT_FLOAT_EQ( 0.1f, scene.step() );
+    EXPECT_EQ( 4, scene.maxSteps() );
+
+    // not enough time for a step
+    scene.tick( 0.05f );
+
+    EXPECT_EQ( 0, tickable.ticks() );
+    EXPECT_NEAR( 0.5f, scene.interpolation(), 0.0001f );
+
+    // every step sees the same delta time
+    scene.tick( 0.2f );
+
+    EXPECT_EQ( 2, tickable.ticks() );
+    EXPECT_FLOAT_EQ( 0.1f, tickable.lastDt() );
+    EXPECT_NEAR( 0.5f, scene.interpolation(), 0.0001f );
+
+    // catching up is capped
+    tickable.reset();
+    scene.tick( 10.0f );
+
+    EXPECT_EQ( 4, tickable.ticks() );
+    EXPECT_LT( scene.interpolation(), 1.0f );
+
+    // variable steps take one step of the elapsed time
+    scene.setStep( 0.0f );
+    tickable.reset();
+    scene.tick( 0.3f );
+
+    EXPECT_EQ( 1, tickable.ticks() );
+    EXPECT_FLOAT_EQ( 0.3f, tickable.lastDt() );
+    EXPECT_EQ( 1.0f, scene.interpolation() );
+
+    scene.removeTickable( &tickable );
+}
+
+TEST( SceneTest, Clock )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdk;
+    using namespace StevensDev::sgdt;
+
+    Scene& scene = Scene::inst();
+
+    TestTickable tickable;
+
+    EXPECT_EQ( &EngineClock::inst().clock(), scene.clock().parent() );
+
+    // a paused scene still steps but no time passes
+    scene.clock().setPaused( true );
+    scene.addTickable( &tickable );
+    scene.tick();
+
+    EXPECT_EQ( 1, tickable.ticks() );
+    EXPECT_EQ( 0.0f, tickable.lastDt() );
+
+    scene.removeTickable( &tickable );
+    scene.clock().setPaused( false );
+}
+
+TEST( SceneTest, Handles )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    Scene& scene = Scene::inst();
+
+    TestTickable first;
+    TestTickable second;
+    TickableHandle firstHandle = scene.addTickable( &first, 1 );
+    TickableHandle secondHandle = scene.addTickable( &second, -1 );
+
+    scene.tick();
+
+    EXPECT_TRUE( first.wasTicked() );
+    EXPECT_TRUE( second.wasTicked() );
+
+    EXPECT_TRUE( scene.removeTickable( firstHandle ) );
+    EXPECT_FALSE( scene.removeTickable( firstHandle ) );
+
+    first.reset();
+    second.reset();
+    scene.tick();
+
+    EXPECT_FALSE( first.wasPreTicked() );
+    EXPECT_TRUE( second.wasPreTicked() );
+
+    EXPECT_TRUE( scene.removeTickable( secondHandle ) );
+
+    scene.tick();
+}
+
+TEST( SceneTest, TickRate )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    Scene& scene = Scene::inst();
+
+    TestTickable first;
+    TestTickable second;
+    TestTickable deferred;
+    TickableHandle firstHandle = scene.addTickable( &first, 0, 2 );
+    TickableHandle secondHandle = scene.addTickable( &second, 0, 2 );
+    TickableHandle deferredHandle;
+    unsigned int i;
+
+    // each runs every other step with the time of both
+    for ( i = 0; i < 4; ++i )
+    {
+        scene.tick( 0.1f );
+    }
+
+    EXPECT_EQ( 2, first.ticks() );
+    EXPECT_EQ( 2, second.ticks() );
+    EXPECT_FLOAT_EQ( 0.2f, first.lastDt() );
+    EXPECT_FLOAT_EQ( 0.2f, second.lastDt() );
+
+    scene.removeTickable( firstHandle );
+    scene.removeTickable( secondHandle );
+
+    // deferrable work is deferred once the budget is used up
+    first.reset();
+    deferredHandle = scene.addTickable( &deferred, 1, 1, true );
+    firstHandle = scene.addTickable( &first );
+    scene.setTickBudget( 1e-9f );
+
+    EXPECT_FLOAT_EQ( 1e-9f, scene.tickBudget() );
+
+    scene.tick( 0.1f );
+    scene.tick( 0.1f );
+
+    EXPECT_EQ( 0, deferred.ticks() );
+    EXPECT_EQ( 2, first.ticks() );
+
+    scene.setTickBudget( 0 );
+    scene.tick( 0.1f );
+
+    EXPECT_EQ( 1, deferred.ticks() );
+    EXPECT_FLOAT_EQ( 0.3f, deferred.lastDt() );
+
+    scene.removeTickable( deferredHandle );
+    scene.removeTickable( firstHandle );
+    scene.tick( 0.1f );
+}
+
+TEST( SceneTest, OverBudget )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    Scene& scene = Scene::inst();
+
+    TestTickable first;
+    TestTickable deferred;
+    TestTickable late;
+    TickableHandle firstHandle = scene.addTickable( &first );
+    TickableHandle deferredHandle = scene.addTickable( &deferred, 1, 1,
+                                                       true );
+    TickableHandle lateHandle = scene.addTickable( &late, 1 );
+    unsigned int i;
+
+    // every frame is over budget but deferrable work still runs after it
+    // has been deferred as often as allowed and the rest is never deferred
+    scene.setTickBudget( 1e-9f );
+
+    for ( i = 0; i < Scene::MAX_DEFERRALS; ++i )
+    {
+        scene.tick( 0.1f );
+    }
+
+    EXPECT_EQ( 0, deferred.ticks() );
+
+    scene.tick( 0.1f );
+
+    EXPECT_EQ( 1, deferred.ticks() );
+    EXPECT_FLOAT_EQ( 0.1f * ( Scene::MAX_DEFERRALS + 1 ),
+                     deferred.lastDt() );
+
+    for ( i = 0; i <= Scene::MAX_DEFERRALS; ++i )
+    {
+        scene.tick( 0.1f );
+    }
+
+    EXPECT_EQ( 2, deferred.ticks() );
+    EXPECT_EQ( 2 * ( Scene::MAX_DEFERRALS + 1 ), first.ticks() );
+    EXPECT_EQ( 2 * ( Scene::MAX_DEFERRALS + 1 ), late.ticks() );
+
+    scene.setTickBudget( 0 );
+    scene.removeTickable( lateHandle );
+    scene.removeTickable( deferredHandle );
+    scene.removeTickable( firstHandle );
+    scene.tick( 0.1f );
+}
+
+TEST( SceneTest, Headless )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdr;
+    using namespace StevensDev::sgdt;
+
+    Scene& scene = Scene::inst();
+
+    NullRenderer renderer( 800, 600 );
+    TestTickable tickable;
+    unsigned int i;
+
+    scene.setRenderer( &renderer );
+    scene.addTickable( &tickable );
+
+    EXPECT_EQ( 800, scene.getWidth() );
+    EXPECT_EQ( 600, scene.getHeight() );
+
+    for ( i = 0; i < 100; ++i )
+    {
+        scene.tick( 0.01f );
+    }
+
+    EXPECT_EQ( 100, renderer.frames() );
+    EXPECT_EQ( 100, tickable.ticks() );
+
+    scene.removeTickable( &tickable );
+    scene.setRenderer( nullptr );
+}
+
 TEST( SceneTest, Print )
 {
     using namespace StevensDev::sgds;
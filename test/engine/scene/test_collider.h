@@ -19,6 +19,12 @@ class TestCollider : public sgds::ICollider
     unsigned short d_flags;
       // The collision flags.
 
+    bool d_isPrecise;
+      // If the collider reports that it has a precise shape.
+
+    mutable unsigned int d_checks;
+      // The number of times doesCollide was called.
+
   public:
     TestCollider();
       // Constructs a new test collider.
@@ -49,6 +55,15 @@ class TestCollider : public sgds::ICollider
 
     virtual bool doesCollide( const sgds::RectangleBounds& candidate ) const;
       // Checks if this does collide with another set of bounds.
+
+    virtual bool isPrecise() const;
+      // Checks if this reports a precise shape.
+
+    void setPrecise( bool isPrecise );
+      // Sets if this reports a precise shape.
+
+    unsigned int checks() const;
+      // Gets the number of times doesCollide was called.
 };
 
 // FREE OPERATORS
@@ -66,26 +81,30 @@ std::ostream& operator<<( std::ostream& stream, const TestCollider& collider )
 
 // CONSTRUCTORS
 inline
-TestCollider::TestCollider() : d_bounds(), d_flags( 0 )
+TestCollider::TestCollider() : d_bounds(), d_flags( 0 ), d_isPrecise( false ),
+                               d_checks( 0 )
 {
 }
 
 inline
 TestCollider::TestCollider( const sgds::RectangleBounds& bounds )
-    : d_bounds( bounds ), d_flags( 0 )
+    : d_bounds( bounds ), d_flags( 0 ), d_isPrecise( false ), d_checks( 0 )
 {
 }
 
 inline
 TestCollider::TestCollider( const sgds::RectangleBounds& bounds,
                             unsigned short flags ) : d_bounds( bounds ),
-                                                     d_flags( flags )
+                                                     d_flags( flags ),
+                                                     d_isPrecise( false ),
+                                                     d_checks( 0 )
 {
 }
 
 inline
 TestCollider::TestCollider( const TestCollider& collider )
-    : d_bounds( collider.d_bounds ), d_flags( collider.d_flags )
+    : d_bounds( collider.d_bounds ), d_flags( collider.d_flags ),
+      d_isPrecise( collider.d_isPrecise ), d_checks( 0 )
 {
 }
 
@@ -125,9 +144,28 @@ bool TestCollider::canCollide( unsigned short flags ) const
 inline
 bool TestCollider::doesCollide( const sgds::RectangleBounds& candidate ) const
 {
+    ++d_checks;
     return d_bounds.doesCollide( candidate );
 }
 
+inline
+bool TestCollider::isPrecise() const
+{
+    return d_isPrecise;
+}
+
+inline
+void TestCollider::setPrecise( bool isPrecise )
+{
+    d_isPrecise = isPrecise;
+}
+
+inline
+unsigned int TestCollider::checks() const
+{
+    return d_checks;
+}
+
 } // End nspc sgdt
 
 } // End nspc StevensDev
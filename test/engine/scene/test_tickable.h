@@ -23,6 +23,15 @@ class TestTickable : public sgds::ITickable
     bool d_wasPostTicked;
       // If it was post-ticked.
 
+    sgds::TickAccess d_access;
+      // The declared access.
+
+    unsigned int d_ticks;
+      // The number of times it was ticked.
+
+    float d_dtS;
+      // The delta time of the last tick.
+
   public:
     // CONSTRUCTORS
     TestTickable();
@@ -44,6 +53,12 @@ class TestTickable : public sgds::ITickable
     virtual void postTick();
       // Sets the post-ticked flag.
 
+    virtual sgds::TickAccess access() const;
+      // Gets the declared access.
+
+    void setAccess( const sgds::TickAccess& access );
+      // Sets the declared access.
+
     bool wasPreTicked() const;
       // Checks if the item was pre-ticked.
 
@@ -53,8 +68,14 @@ class TestTickable : public sgds::ITickable
     bool wasPostTicked() const;
       // Checks if the item was post-ticked.
 
+    unsigned int ticks() const;
+      // Gets the number of times the item was ticked.
+
+    float lastDt() const;
+      // Gets the delta time of the last tick.
+
     void reset();
-      // Resets the ticked flags.
+      // Resets the ticked flags and count.
 };
 
 // FREE OPERATORS
@@ -67,7 +88,8 @@ std::ostream& operator<<( std::ostream& stream, const TestTickable& collider )
 // CONSTRUCTORS
 inline
 TestTickable::TestTickable() : d_wasPreTicked( false ), d_wasTicked( false ),
-                               d_wasPostTicked( false )
+                               d_wasPostTicked( false ), d_access(),
+                               d_ticks( 0 ), d_dtS( 0 )
 {
 }
 
@@ -75,7 +97,9 @@ inline
 TestTickable::TestTickable( const TestTickable& tickable )
     : d_wasPreTicked( tickable.d_wasPreTicked ),
       d_wasTicked( tickable.d_wasTicked ),
-      d_wasPostTicked( tickable.d_wasPostTicked )
+      d_wasPostTicked( tickable.d_wasPostTicked ),
+      d_access( tickable.d_access ), d_ticks( tickable.d_ticks ),
+      d_dtS( tickable.d_dtS )
 {
 }
 
@@ -95,6 +119,8 @@ inline
 void TestTickable::tick( float dtS )
 {
     d_wasTicked = true;
+    d_dtS = dtS;
+    ++d_ticks;
 }
 
 inline
@@ -103,6 +129,18 @@ void TestTickable::postTick()
     d_wasPostTicked = true;
 }
 
+inline
+sgds::TickAccess TestTickable::access() const
+{
+    return d_access;
+}
+
+inline
+void TestTickable::setAccess( const sgds::TickAccess& access )
+{
+    d_access = access;
+}
+
 inline
 bool TestTickable::wasPreTicked() const
 {
@@ -121,12 +159,25 @@ bool TestTickable::wasPostTicked() const
     return d_wasPostTicked;
 }
 
+inline
+unsigned int TestTickable::ticks() const
+{
+    return d_ticks;
+}
+
+inline
+float TestTickable::lastDt() const
+{
+    return d_dtS;
+}
+
 inline
 void TestTickable::reset()
 {
     d_wasPreTicked = false;
     d_wasTicked = false;
     d_wasPostTicked = false;
+    d_ticks = 0;
 }
 
 } // End nspc sgdt
@@ -0,0 +1,87 @@
+// tick_access.t.cpp
+#include <engine/scene/tick_access.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST( TickAccessTest, Construction )
+{
+    using namespace StevensDev::sgds;
+
+    TickAccess access;
+
+    EXPECT_TRUE( access.isExclusive() );
+    EXPECT_EQ( 0, access.readSet() );
+    EXPECT_EQ( 0, access.writeSet() );
+    EXPECT_EQ( 0, access.group() );
+
+    access.reads( 1 ).writes( 3 ).inGroup( 2 );
+
+    EXPECT_FALSE( access.isExclusive() );
+    EXPECT_EQ( 2, access.readSet() );
+    EXPECT_EQ( 8, access.writeSet() );
+    EXPECT_EQ( 2, access.group() );
+
+    TickAccess copy( access );
+
+    EXPECT_EQ( access.readSet(), copy.readSet() );
+    EXPECT_EQ( access.writeSet(), copy.writeSet() );
+    EXPECT_EQ( access.group(), copy.group() );
+
+    copy.exclusive();
+
+    EXPECT_TRUE( copy.isExclusive() );
+
+    copy = access;
+
+    EXPECT_FALSE( copy.isExclusive() );
+
+    access.writes( TickAccess::MAX_RESOURCES - 1 );
+
+    EXPECT_EQ( 1ull << 63 | 8, access.writeSet() );
+}
+
+TEST( TickAccessTest, Conflicts )
+{
+    using namespace StevensDev::sgds;
+
+    TickAccess exclusive;
+    TickAccess readerA;
+    TickAccess readerB;
+    TickAccess writer;
+    TickAccess other;
+
+    readerA.reads( 0 );
+    readerB.reads( 0 ).reads( 1 );
+    writer.writes( 0 );
+    other.writes( 2 ).reads( 1 );
+
+    // readers can share
+    EXPECT_FALSE( readerA.conflicts( readerB ) );
+    EXPECT_FALSE( readerB.conflicts( other ) );
+
+    // writers cannot share with readers or writers
+    EXPECT_TRUE( readerA.conflicts( writer ) );
+    EXPECT_TRUE( writer.conflicts( readerB ) );
+    EXPECT_TRUE( writer.conflicts( writer ) );
+
+    // disjoint resources never conflict
+    EXPECT_FALSE( writer.conflicts( other ) );
+
+    // undeclared accesses conflict with everything
+    EXPECT_TRUE( exclusive.conflicts( readerA ) );
+    EXPECT_TRUE( other.conflicts( exclusive ) );
+}
+
+TEST( TickAccessTest, Print )
+{
+    using namespace StevensDev::sgds;
+
+    TickAccess access;
+    std::ostringstream oss;
+
+    access.reads( 0 ).writes( 1 ).inGroup( 3 );
+    oss << access;
+
+    EXPECT_STREQ( "{ \"reads\": 1, \"writes\": 2, \"group\": 3, "
+                  "\"exclusive\": false }", oss.str().c_str() );
+}
@@ -0,0 +1,297 @@
+// tick_schedule.t.cpp
+#include <atomic>
+#include <engine/jobs/job_system.h>
+#include <engine/scene/test_tickable.h>
+#include <engine/scene/tick_schedule.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace
+{
+
+class OrderedTickable : public StevensDev::sgds::ITickable
+{
+  private:
+    std::atomic<unsigned int>* d_sequence;
+      // The shared sequence used to order phases.
+
+    StevensDev::sgds::TickAccess d_access;
+      // The declared access.
+
+  public:
+    unsigned int preTicked;
+      // The sequence number when pre-ticked.
+
+    unsigned int ticked;
+      // The sequence number when ticked.
+
+    unsigned int postTicked;
+      // The sequence number when post-ticked.
+
+    unsigned int ticks;
+      // The number of phases run.
+
+    float dtS;
+      // The delta time of the last tick.
+
+    OrderedTickable( std::atomic<unsigned int>* sequence,
+                     const StevensDev::sgds::TickAccess& access )
+      // Constructs a new tickable that orders itself using the sequence.
+        : d_sequence( sequence ), d_access( access ), preTicked( 0 ),
+          ticked( 0 ), postTicked( 0 ), ticks( 0 ), dtS( 0 )
+    {
+    }
+
+    virtual void preTick()
+    {
+        preTicked = ( *d_sequence )++;
+        ++ticks;
+    }
+
+    virtual void tick( float dtS )
+    {
+        ticked = ( *d_sequence )++;
+        this->dtS = dtS;
+        ++ticks;
+    }
+
+    virtual void postTick()
+    {
+        postTicked = ( *d_sequence )++;
+        ++ticks;
+    }
+
+    virtual StevensDev::sgds::TickAccess access() const
+    {
+        return d_access;
+    }
+};
+
+} // End nspc anonymous
+
+TEST( TickScheduleTest, Construction )
+{
+    using namespace StevensDev::sgds;
+
+    TickSchedule schedule;
+
+    EXPECT_EQ( 0, schedule.size() );
+    EXPECT_EQ( 0, schedule.waves() );
+
+    // an empty schedule does nothing
+    schedule.preTick();
+    schedule.tick( 0.1f );
+    schedule.postTick();
+
+    TickSchedule copy( schedule );
+
+    EXPECT_EQ( 0, copy.size() );
+}
+
+TEST( TickScheduleTest, Build )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+
+    DynamicArray<ITickable*> tickables;
+    TestTickable writer;
+    TestTickable readerA;
+    TestTickable readerB;
+    TestTickable late;
+    TestTickable undeclared;
+    TickSchedule schedule;
+
+    writer.setAccess( TickAccess().writes( 0 ) );
+    readerA.setAccess( TickAccess().reads( 0 ).writes( 1 ) );
+    readerB.setAccess( TickAccess().reads( 0 ) );
+    late.setAccess( TickAccess().reads( 5 ).inGroup( 1 ) );
+
+    // groups run in order no matter when they were added
+    tickables.push( &late );
+    tickables.push( &writer );
+    tickables.push( &readerA );
+    tickables.push( &readerB );
+
+    schedule.build( tickables );
+
+    ASSERT_EQ( 4, schedule.size() );
+    ASSERT_EQ( 3, schedule.waves() );
+    ASSERT_EQ( 1, schedule.waveSize( 0 ) );
+    ASSERT_EQ( 2, schedule.waveSize( 1 ) );
+    ASSERT_EQ( 1, schedule.waveSize( 2 ) );
+    EXPECT_EQ( &writer, schedule.get( 0, 0 ) );
+    EXPECT_EQ( &readerA, schedule.get( 1, 0 ) );
+    EXPECT_EQ( &readerB, schedule.get( 1, 1 ) );
+    EXPECT_EQ( &late, schedule.get( 2, 0 ) );
+
+    // undeclared tickables run alone
+    tickables.push( &undeclared );
+    schedule.build( tickables );
+
+    ASSERT_EQ( 5, schedule.size() );
+    ASSERT_EQ( 4, schedule.waves() );
+    EXPECT_EQ( 1, schedule.waveSize( 2 ) );
+    EXPECT_EQ( &undeclared, schedule.get( 2, 0 ) );
+    EXPECT_EQ( &late, schedule.get( 3, 0 ) );
+
+    // independent tickables share a wave
+    tickables.remove( &undeclared );
+    tickables.remove( &writer );
+    schedule.build( tickables );
+
+    ASSERT_EQ( 2, schedule.waves() );
+    EXPECT_EQ( 2, schedule.waveSize( 0 ) );
+
+    schedule.clear();
+
+    EXPECT_EQ( 0, schedule.size() );
+    EXPECT_EQ( 0, schedule.waves() );
+}
+
+TEST( TickScheduleTest, Ticking )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdc;
+    using namespace StevensDev::sgdj;
+
+    const unsigned int COUNT = 64;
+    const unsigned int WORKERS[] = { 0, 3 };
+
+    unsigned int i;
+    unsigned int j;
+    unsigned int w;
+
+    for ( w = 0; w < sizeof( WORKERS ) / sizeof( WORKERS[0] ); ++w )
+    {
+        std::atomic<unsigned int> sequence( 0 );
+        DynamicArray<OrderedTickable*> ordered;
+        DynamicArray<ITickable*> tickables;
+        TickSchedule schedule;
+
+        // alternate between writers and readers of a few resources with a
+        // group of tickables that must follow all of them
+        for ( i = 0; i < COUNT; ++i )
+        {
+            TickAccess access;
+
+            if ( i % 4 == 0 )
+            {
+                access.writes( i % 3 );
+            }
+            else
+            {
+                access.reads( i % 3 );
+            }
+
+            access.inGroup( i >= COUNT - 8 ? 1 : 0 );
+
+            ordered.push( new OrderedTickable( &sequence, access ) );
+            tickables.push( ordered[i] );
+        }
+
+        JobSystem::inst().initialize( WORKERS[w] );
+
+        schedule.build( tickables );
+        schedule.preTick();
+        schedule.tick( 0.25f );
+        schedule.postTick();
+
+        JobSystem::inst().shutdown();
+
+        for ( i = 0; i < COUNT; ++i )
+        {
+            EXPECT_EQ( 3, ordered[i]->ticks );
+            EXPECT_EQ( 0.25f, ordered[i]->dtS );
+
+            // phases never overlap
+            EXPECT_LT( ordered[i]->preTicked, COUNT );
+            EXPECT_GE( ordered[i]->ticked, COUNT );
+            EXPECT_LT( ordered[i]->ticked, 2 * COUNT );
+            EXPECT_GE( ordered[i]->postTicked, 2 * COUNT );
+
+            for ( j = 0; j < i; ++j )
+            {
+                if ( tickables[i]->access().group() !=
+                     tickables[j]->access().group() ||
+                     tickables[i]->access().conflicts(
+                         tickables[j]->access() ) )
+                {
+                    EXPECT_LT( ordered[j]->preTicked,
+                               ordered[i]->preTicked );
+                    EXPECT_LT( ordered[j]->ticked, ordered[i]->ticked );
+                    EXPECT_LT( ordered[j]->postTicked,
+                               ordered[i]->postTicked );
+                }
+            }
+        }
+
+        for ( i = 0; i < COUNT; ++i )
+        {
+            delete ordered[i];
+        }
+    }
+}
+
+TEST( TickScheduleTest, Due )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdc;
+    using namespace StevensDev::sgdj;
+
+    const unsigned int COUNT = 16;
+
+    std::atomic<unsigned int> sequence( 0 );
+    DynamicArray<OrderedTickable*> ordered;
+    DynamicArray<ITickable*> tickables;
+    TickSchedule schedule;
+    unsigned int i;
+
+    for ( i = 0; i < COUNT; ++i )
+    {
+        ordered.push( new OrderedTickable( &sequence,
+                                           TickAccess().reads( i % 2 ) ) );
+        tickables.push( ordered[i] );
+    }
+
+    JobSystem::inst().initialize( 3 );
+
+    // only the even indices are due and each ticks with its own time
+    schedule.build( tickables );
+    schedule.preTick( []( unsigned int index ) { return index % 2 == 0; } );
+    schedule.tick( []( unsigned int index ) { return index % 2 == 0; },
+                   []( unsigned int index ) { return index * 0.5f; } );
+    schedule.postTick( []( unsigned int index ) { return index % 2 == 0; } );
+
+    JobSystem::inst().shutdown();
+
+    for ( i = 0; i < COUNT; ++i )
+    {
+        if ( i % 2 == 0 )
+        {
+            EXPECT_EQ( 3, ordered[i]->ticks );
+            EXPECT_EQ( i * 0.5f, ordered[i]->dtS );
+        }
+        else
+        {
+            EXPECT_EQ( 0, ordered[i]->ticks );
+        }
+    }
+
+    for ( i = 0; i < COUNT; ++i )
+    {
+        delete ordered[i];
+    }
+}
+
+TEST( TickScheduleTest, Print )
+{
+    using namespace StevensDev::sgds;
+
+    TickSchedule schedule;
+    std::ostringstream oss;
+
+    oss << schedule;
+
+    EXPECT_STREQ( "{ \"size\": 0, \"waves\": 0 }", oss.str().c_str() );
+}
@@ -0,0 +1,249 @@
+// tickable_registry.t.cpp
+#include <engine/scene/test_tickable.h>
+#include <engine/scene/tickable_registry.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST( TickableRegistryTest, Construction )
+{
+    using namespace StevensDev::sgds;
+
+    TickableRegistry registry;
+
+    EXPECT_EQ( 0, registry.size() );
+    EXPECT_EQ( 0, registry.pending() );
+    EXPECT_FALSE( registry.contains( TickableRegistry::INVALID_HANDLE ) );
+    EXPECT_FALSE( registry.contains( 0 ) );
+    EXPECT_FALSE( registry.flush() );
+
+    TickableRegistry copy( registry );
+
+    EXPECT_EQ( 0, copy.size() );
+}
+
+TEST( TickableRegistryTest, Deferred )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    TickableRegistry registry;
+    TestTickable a;
+    TestTickable b;
+    TickableHandle handleA = registry.add( &a );
+    TickableHandle handleB;
+
+    // nothing changes until a flush
+    EXPECT_TRUE( registry.contains( handleA ) );
+    EXPECT_EQ( 0, registry.size() );
+    EXPECT_EQ( 1, registry.pending() );
+
+    EXPECT_TRUE( registry.flush() );
+    ASSERT_EQ( 1, registry.size() );
+    EXPECT_EQ( &a, registry.tickables()[0] );
+    EXPECT_EQ( handleA, registry.find( &a ) );
+
+    EXPECT_TRUE( registry.remove( handleA ) );
+    EXPECT_FALSE( registry.contains( handleA ) );
+    EXPECT_FALSE( registry.remove( handleA ) );
+    EXPECT_EQ( 1, registry.size() );
+
+    EXPECT_TRUE( registry.flush() );
+    EXPECT_EQ( 0, registry.size() );
+    EXPECT_EQ( TickableRegistry::INVALID_HANDLE, registry.find( &a ) );
+
+    // added and removed before a flush is never listed
+    handleB = registry.add( &b );
+
+    EXPECT_TRUE( registry.remove( handleB ) );
+    EXPECT_FALSE( registry.flush() );
+    EXPECT_EQ( 0, registry.size() );
+
+    // reused slots do not revive old handles
+    handleB = registry.add( &b );
+    registry.flush();
+
+    EXPECT_NE( handleA, handleB );
+    EXPECT_FALSE( registry.contains( handleA ) );
+    EXPECT_FALSE( registry.remove( handleA ) );
+    EXPECT_TRUE( registry.contains( handleB ) );
+    EXPECT_EQ( 1, registry.size() );
+}
+
+TEST( TickableRegistryTest, Priority )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    TickableRegistry registry;
+    TestTickable late;
+    TestTickable first;
+    TestTickable second;
+    TestTickable early;
+    TickableHandle handle;
+
+    registry.add( &late, 10 );
+    registry.add( &first );
+    handle = registry.add( &second );
+    registry.add( &early, -5 );
+    registry.flush();
+
+    ASSERT_EQ( 4, registry.size() );
+    EXPECT_EQ( &early, registry.tickables()[0] );
+    EXPECT_EQ( &first, registry.tickables()[1] );
+    EXPECT_EQ( &second, registry.tickables()[2] );
+    EXPECT_EQ( &late, registry.tickables()[3] );
+
+    // readding moves to the back of the priority
+    registry.remove( handle );
+    registry.add( &second, -5 );
+    registry.flush();
+
+    ASSERT_EQ( 4, registry.size() );
+    EXPECT_EQ( &early, registry.tickables()[0] );
+    EXPECT_EQ( &second, registry.tickables()[1] );
+    EXPECT_EQ( &first, registry.tickables()[2] );
+}
+
+TEST( TickableRegistryTest, Churn )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+    using namespace StevensDev::sgdc;
+
+    const unsigned int COUNT = 5000;
+
+    TickableRegistry registry;
+    TestTickable* tickables = new TestTickable[COUNT];
+    DynamicArray<TickableHandle> handles;
+    unsigned int i;
+
+    for ( i = 0; i < COUNT; ++i )
+    {
+        handles.push( registry.add( tickables + i, i % 7 ) );
+    }
+
+    registry.flush();
+
+    EXPECT_EQ( COUNT, registry.size() );
+
+    for ( i = 0; i < COUNT; i += 2 )
+    {
+        EXPECT_TRUE( registry.remove( handles[i] ) );
+    }
+
+    registry.flush();
+
+    ASSERT_EQ( COUNT / 2, registry.size() );
+
+    for ( i = 1; i < registry.size(); ++i )
+    {
+        TestTickable* previous =
+            static_cast<TestTickable*>( registry.tickables()[i - 1] );
+        TestTickable* current =
+            static_cast<TestTickable*>( registry.tickables()[i] );
+
+        // sorted by priority and then by when they were added
+        EXPECT_TRUE( ( previous - tickables ) % 7 <
+                     ( current - tickables ) % 7 ||
+                     ( ( previous - tickables ) % 7 ==
+                       ( current - tickables ) % 7 &&
+                       previous < current ) );
+    }
+
+    delete[] tickables;
+}
+
+TEST( TickableRegistryTest, Interval )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    const unsigned int COUNT = 8;
+    const unsigned int INTERVAL = 4;
+
+    TickableRegistry registry;
+    TestTickable tickables[COUNT];
+    unsigned int due;
+    unsigned int step;
+    unsigned int i;
+
+    for ( i = 0; i < COUNT; ++i )
+    {
+        registry.add( &tickables[i], 0, INTERVAL );
+    }
+
+    registry.flush();
+
+    ASSERT_EQ( COUNT, registry.size() );
+    EXPECT_EQ( INTERVAL, registry.interval( 0 ) );
+
+    // a quarter runs each step with the time of the last four steps
+    for ( step = 0; step < 2 * INTERVAL; ++step )
+    {
+        registry.beginStep( step, 0.25f );
+
+        for ( i = 0, due = 0; i < COUNT; ++i )
+        {
+            EXPECT_EQ( step % INTERVAL == i % INTERVAL,
+                       registry.isDue( i ) );
+
+            if ( registry.isDue( i ) )
+            {
+                EXPECT_FLOAT_EQ( step < INTERVAL ? ( step + 1 ) * 0.25f
+                                                 : 1.0f,
+                                 registry.dt( i ) );
+                ++due;
+            }
+        }
+
+        EXPECT_EQ( COUNT / INTERVAL, due );
+
+        registry.endStep();
+    }
+
+    // a deferred tickable runs on the next step with the time of both
+    registry.beginStep( 0, 0.25f );
+    registry.defer( 0 );
+
+    EXPECT_FALSE( registry.isDue( 0 ) );
+
+    registry.endStep();
+    registry.beginStep( 1, 0.25f );
+
+    EXPECT_TRUE( registry.isDue( 0 ) );
+    EXPECT_FLOAT_EQ( 1.25f, registry.dt( 0 ) );
+
+    registry.endStep();
+    registry.beginStep( 2, 0.25f );
+
+    EXPECT_FALSE( registry.isDue( 0 ) );
+    EXPECT_FLOAT_EQ( 0.25f, registry.dt( 0 ) );
+
+    registry.endStep();
+
+    // a tickable added during a step waits for the next one
+    registry.beginStep( 4, 0.25f );
+    registry.add( &tickables[0], -1 );
+    registry.flush();
+
+    EXPECT_EQ( -1, registry.priority( 0 ) );
+    EXPECT_FALSE( registry.isDue( 0 ) );
+    EXPECT_TRUE( registry.isDue( 1 ) );
+
+    registry.endStep();
+}
+
+TEST( TickableRegistryTest, Print )
+{
+    using namespace StevensDev::sgds;
+    using namespace StevensDev::sgdt;
+
+    TickableRegistry registry;
+    TestTickable tickable;
+    std::ostringstream oss;
+
+    registry.add( &tickable );
+    oss << registry;
+
+    EXPECT_STREQ( "{ \"size\": 0, \"pending\": 1 }", oss.str().c_str() );
+}
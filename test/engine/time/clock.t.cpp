@@ -0,0 +1,136 @@
+// clock.t.cpp
+#include <engine/time/clock.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST( ClockTest, Construction )
+{
+    using namespace StevensDev::sgdk;
+
+    Clock clock;
+
+    EXPECT_EQ( nullptr, clock.parent() );
+    EXPECT_EQ( 0, clock.time() );
+    EXPECT_EQ( 0, clock.elapsed() );
+    EXPECT_EQ( 1.0f, clock.timeScale() );
+    EXPECT_FALSE( clock.isPaused() );
+
+    Clock scaled( 0.5f );
+
+    EXPECT_EQ( 0.5f, scaled.timeScale() );
+
+    Clock child( &clock, 2.0f );
+
+    EXPECT_EQ( &clock, child.parent() );
+    EXPECT_EQ( 2.0f, child.timeScale() );
+
+    Clock copy( child );
+
+    EXPECT_EQ( &clock, copy.parent() );
+
+    copy = scaled;
+
+    EXPECT_EQ( nullptr, copy.parent() );
+    EXPECT_EQ( 0.5f, copy.timeScale() );
+}
+
+TEST( ClockTest, Update )
+{
+    using namespace StevensDev::sgdk;
+
+    Clock clock;
+
+    clock.update( 1500 );
+
+    EXPECT_EQ( 1500, clock.time() );
+    EXPECT_EQ( 1500, clock.elapsed() );
+
+    clock.setTimeScale( 0.5f );
+    clock.update( 1000 );
+
+    EXPECT_EQ( 2000, clock.time() );
+    EXPECT_EQ( 500, clock.elapsed() );
+    EXPECT_FLOAT_EQ( 0.0000005f, clock.elapsedSeconds() );
+
+    clock.setPaused( true );
+    clock.update( 1000 );
+
+    EXPECT_TRUE( clock.isPaused() );
+    EXPECT_EQ( 2000, clock.time() );
+    EXPECT_EQ( 0, clock.elapsed() );
+
+    clock.setPaused( false );
+    clock.setTimeScale( 1.0f );
+
+    // hours of nanoseconds stay exact
+    clock.update( 36000 * TimeUnits::NANOS_PER_SECOND );
+    clock.update( 1 );
+
+    EXPECT_EQ( 36000 * TimeUnits::NANOS_PER_SECOND + 2001, clock.time() );
+}
+
+TEST( ClockTest, Children )
+{
+    using namespace StevensDev::sgdk;
+
+    Clock root;
+    Clock slow( &root, 0.5f );
+    Clock slower( &slow, 0.5f );
+    Clock paused( &root );
+
+    paused.setPaused( true );
+
+    root.update( 800 );
+    slow.update();
+    slower.update();
+    paused.update();
+
+    EXPECT_EQ( 800, root.elapsed() );
+    EXPECT_EQ( 400, slow.elapsed() );
+    EXPECT_EQ( 200, slower.elapsed() );
+    EXPECT_EQ( 0, paused.elapsed() );
+
+    // children catch up on everything the parent did since they last ran
+    root.update( 100 );
+    root.update( 100 );
+    slow.update();
+
+    EXPECT_EQ( 100, slow.elapsed() );
+    EXPECT_EQ( 500, slow.time() );
+
+    // a child that is not updated again sees no time pass
+    slow.update();
+
+    EXPECT_EQ( 0, slow.elapsed() );
+
+    // reparenting starts from the new parent's current time
+    paused.setPaused( false );
+    paused.setParent( &slow );
+    paused.update();
+
+    EXPECT_EQ( 0, paused.elapsed() );
+
+    root.update( 200 );
+    slow.update();
+    paused.update();
+
+    EXPECT_EQ( 100, paused.elapsed() );
+
+    paused.setParent( nullptr );
+
+    EXPECT_EQ( nullptr, paused.parent() );
+}
+
+TEST( ClockTest, Print )
+{
+    using namespace StevensDev::sgdk;
+
+    Clock clock;
+    std::ostringstream oss;
+
+    clock.update( 5 );
+    oss << clock;
+
+    EXPECT_STREQ( "{ \"time\": 5, \"elapsed\": 5, \"timeScale\": 1, "
+                  "\"isPaused\": false }", oss.str().c_str() );
+}
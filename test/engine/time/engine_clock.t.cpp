@@ -0,0 +1,34 @@
+// engine_clock.t.cpp
+#include <chrono>
+#include <engine/time/engine_clock.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+TEST( EngineClockTest, Update )
+{
+    using namespace StevensDev::sgdk;
+
+    EngineClock& engine = EngineClock::inst();
+    Clock child( &engine.clock() );
+    TimePoint before;
+
+    // starting does not advance
+    engine.restart();
+    engine.update();
+    child.update();
+
+    EXPECT_EQ( 0, engine.clock().elapsed() );
+    EXPECT_EQ( 0, child.elapsed() );
+
+    before = engine.lastUpdate();
+
+    std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) );
+
+    engine.update();
+    child.update();
+
+    EXPECT_EQ( engine.lastUpdate() - before,
+               static_cast<TimePoint>( engine.clock().elapsed() ) );
+    EXPECT_GE( engine.clock().elapsed(), 2 * TimeUnits::NANOS_PER_MILLI );
+    EXPECT_EQ( engine.clock().elapsed(), child.elapsed() );
+}
@@ -0,0 +1,28 @@
+// time_source.t.cpp
+#include <chrono>
+#include <engine/time/time_source.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+TEST( TimeSourceTest, Monotonic )
+{
+    using namespace StevensDev::sgdk;
+
+    TimePoint previous = TimeSource::now();
+    TimePoint current;
+    unsigned int i;
+
+    for ( i = 0; i < 1000; ++i )
+    {
+        current = TimeSource::now();
+
+        EXPECT_GE( current, previous );
+
+        previous = current;
+    }
+
+    std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) );
+
+    EXPECT_GE( TimeSource::now() - previous,
+               static_cast<TimePoint>( 2 * TimeUnits::NANOS_PER_MILLI ) );
+}
@@ -0,0 +1,23 @@
+// time_units.t.cpp
+#include <engine/time/time_units.h>
+#include <gtest/gtest.h>
+
+TEST( TimeUnitsTest, Conversion )
+{
+    using namespace StevensDev::sgdk;
+
+    EXPECT_EQ( 1.5, TimeUnits::toSeconds( 1500000000ll ) );
+    EXPECT_EQ( 2.0, TimeUnits::toMilliseconds( 2000000ll ) );
+    EXPECT_EQ( 3.0, TimeUnits::toMicroseconds( 3000ll ) );
+
+    EXPECT_EQ( 250000000ll, TimeUnits::fromSeconds( 0.25 ) );
+    EXPECT_EQ( -250000000ll, TimeUnits::fromSeconds( -0.25 ) );
+    EXPECT_EQ( 16666667ll, TimeUnits::fromSeconds( 1.0 / 60.0 ) );
+
+    // a day of uptime is still exact to the nanosecond
+    EXPECT_EQ( 86400000000000ll, TimeUnits::fromSeconds( 86400.0 ) );
+    EXPECT_EQ( TimeUnits::NANOS_PER_SECOND,
+               TimeUnits::NANOS_PER_MILLI * 1000 );
+    EXPECT_EQ( TimeUnits::NANOS_PER_MILLI,
+               TimeUnits::NANOS_PER_MICRO * 1000 );
+}
@@ -0,0 +1,38 @@
+// actor.t.cpp
+#include <game/objects/actor.h>
+#include <gtest/gtest.h>
+
+TEST( ActorTest, Copy )
+{
+    using namespace StevensDev::mgo;
+    using namespace StevensDev::sgdd;
+    using namespace StevensDev::sgdn;
+    using namespace StevensDev::sgdr;
+    using namespace StevensDev::sgds;
+
+    EntityStore store;
+    Actor actor( "block", RenderableSprite(), RectangleBounds( 1, 2, 3, 4 ),
+                 5, JsonEntity(), &store );
+
+    // fill the pool so the copy's bounds reallocate it
+    while ( store.bounds().size() < 32 )
+    {
+        store.bounds().add( store.create(), RectangleBounds() );
+    }
+
+    Actor copy( actor );
+
+    EXPECT_EQ( actor.id(), copy.id() );
+    EXPECT_NE( actor.entity(), copy.entity() );
+    EXPECT_FLOAT_EQ( 1.0f, copy.bounds().x() );
+    EXPECT_FLOAT_EQ( 2.0f, copy.bounds().y() );
+    EXPECT_FLOAT_EQ( 3.0f, copy.bounds().width() );
+    EXPECT_FLOAT_EQ( 4.0f, copy.bounds().height() );
+    EXPECT_EQ( 5, copy.flags() );
+
+    // the copy has bounds of its own
+    copy.move( 1, 1 );
+
+    EXPECT_FLOAT_EQ( 1.0f, actor.getPositionX() );
+    EXPECT_FLOAT_EQ( 2.0f, copy.getPositionX() );
+}